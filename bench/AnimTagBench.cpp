@@ -0,0 +1,144 @@
+// Tag classification: legacy predicate chain vs. SF::Core::AnimTag::Classify.
+//
+// The corpus approximates what a melee NPC's behavior graph emits during a fight:
+// mostly footsteps, sounds and idle/graph bookkeeping, with ~5% tags we actually use.
+
+#include "Bench.h"
+
+#include "SF/Core/AnimTag.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+	// Copy of the predicates LightAttackStaminaCost/JumpStaminaCost used before the classifier.
+	namespace Legacy
+	{
+		inline bool IsWeaponHandSwingTag(std::string_view t)
+		{
+			return (t == "weaponLeftSwing") || (t == "weaponRightSwing") ||
+			       (t == "WeaponLeftSwing") || (t == "WeaponRightSwing");
+		}
+
+		inline bool IsWeaponSwingAmbiguous(std::string_view t)
+		{
+			return (t == "weaponSwing") || (t == "WeaponSwing");
+		}
+
+		inline bool IsUnarmedSwingSoundTag(std::string_view t)
+		{
+			return (t == "SoundPlay.WPNSwingUnarmed");
+		}
+
+		inline bool IsAttackStartTag(std::string_view t)
+		{
+			return (t == "attackStart") || (t == "attackStartLeft") || (t == "attackStartRight") ||
+			       (t == "AttackStart") || (t == "AttackStartLeft") || (t == "AttackStartRight");
+		}
+
+		inline bool IsSpendTag(std::string_view t)
+		{
+			return IsWeaponHandSwingTag(t) || IsWeaponSwingAmbiguous(t);
+		}
+
+		inline bool TagHasLeft(std::string_view t)
+		{
+			return (t.find("Left") != std::string_view::npos) || (t.find("left") != std::string_view::npos);
+		}
+
+		inline bool TagHasRight(std::string_view t)
+		{
+			return (t.find("Right") != std::string_view::npos) || (t.find("right") != std::string_view::npos);
+		}
+
+		// Per-event work of the old AnimEventSink + JumpAnimEventSink, minus the lock.
+		inline std::uint32_t Classify(std::string_view t)
+		{
+			std::uint32_t bits = 0;
+			if (TagHasLeft(t) || t == "weaponLeftSwing" || t == "WeaponLeftSwing") {
+				bits |= 1u;
+			} else if (TagHasRight(t) || t == "weaponRightSwing" || t == "WeaponRightSwing") {
+				bits |= 2u;
+			}
+			if (IsUnarmedSwingSoundTag(t)) {
+				return bits | 4u;
+			}
+			if (IsAttackStartTag(t)) {
+				bits |= 8u;
+			}
+			if (IsSpendTag(t)) {
+				bits |= 16u;
+			}
+			if (t == "JumpUp") {
+				bits |= 32u;
+			}
+			return bits;
+		}
+	}
+
+	constexpr std::array kNoise{
+		"FootLeft", "FootRight", "FootSprintLeft", "FootSprintRight",
+		"SoundPlay.NPCHumanFootstepWalk", "SoundPlay.NPCHumanFootstepRun",
+		"SoundPlay.NPCHumanCombatIdleA", "SoundPlay.WPNSwordUnsheathe",
+		"IdleStop", "IdleFurnitureExit", "TurnLeft", "TurnRight",
+		"tailCombatIdle", "tailCombatState", "tailMTIdle", "tailMTLocomotion",
+		"preHitFrame", "HitFrame", "attackStop", "weaponDraw",
+		"BeginWeaponDraw", "blockStartOut", "blockStop", "AddCharacterControllerToWorld",
+		"animClipEnd", "GraphDeleting", "MTState", "CastOKStart",
+		"Collision_AttackStart", "Collision_Add", "SyncLeft", "SyncRight",
+		"LandEnd", "JumpDown", "RemoveCharacterControllerFromWorld", "PickNewIdle",
+	};
+
+	constexpr std::array kOurs{
+		"attackStart", "weaponSwing", "attackStartLeft", "weaponLeftSwing",
+		"AttackStartRight", "WeaponRightSwing", "SoundPlay.WPNSwingUnarmed", "JumpUp",
+	};
+
+	std::vector<std::string> BuildStream(std::size_t a_count)
+	{
+		std::vector<std::string> out;
+		out.reserve(a_count);
+		std::uint32_t rng = 0x9E3779B9u;
+		for (std::size_t i = 0; i < a_count; ++i) {
+			rng ^= rng << 13;
+			rng ^= rng >> 17;
+			rng ^= rng << 5;
+			if (rng % 100 < 5) {
+				out.emplace_back(kOurs[rng % kOurs.size()]);
+			} else {
+				out.emplace_back(kNoise[rng % kNoise.size()]);
+			}
+		}
+		return out;
+	}
+}
+
+int main()
+{
+	const auto stream = BuildStream(4096);
+	std::vector<std::string_view> views(stream.begin(), stream.end());
+	const std::size_t mask = views.size() - 1;
+
+	constexpr std::uint64_t kOps = 20'000'000;
+
+	std::printf("AnimTag classification (%zu-tag stream, ~5%% relevant)\n", views.size());
+
+	SF::Bench::Run("legacy predicate chain", kOps, [&](std::uint64_t i) {
+		SF::Bench::DoNotOptimize(Legacy::Classify(views[i & mask]));
+	});
+
+	SF::Bench::Run("AnimTag::Classify", kOps, [&](std::uint64_t i) {
+		SF::Bench::DoNotOptimize(SF::Core::AnimTag::Classify(views[i & mask]));
+	});
+
+	SF::Bench::Run("AnimTag::Classify (relevant only)", kOps, [&](std::uint64_t i) {
+		SF::Bench::DoNotOptimize(SF::Core::AnimTag::Classify(kOurs[i % kOurs.size()]));
+	});
+
+	return 0;
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace SF::Bench
+{
+	// Minimal host-side timing harness. No framework dependency so it builds anywhere
+	// the portable SF/Core headers build.
+
+	template <class T>
+	inline void DoNotOptimize(const T& a_value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(a_value) : "memory");
+#else
+		static volatile const void* sink;
+		sink = &a_value;
+#endif
+	}
+
+	namespace detail
+	{
+		// Bumped by the operator new replacement in BenchAlloc.h. Benchmarks that don't include
+		// it report no allocation column.
+		inline std::atomic<std::uint64_t> g_allocations{ 0 };
+		inline bool g_countingAllocations = false;
+	}
+
+	[[nodiscard]] inline std::uint64_t Allocations() noexcept
+	{
+		return detail::g_allocations.load(std::memory_order_relaxed);
+	}
+
+	struct Result
+	{
+		std::string_view name;
+		std::uint64_t ops{ 0 };
+		double nsPerOp{ 0.0 };
+		double allocsPerOp{ 0.0 };
+	};
+
+	// Runs a_fn(i) for a_ops iterations (after a short warm-up) and prints ns/op.
+	template <class Fn>
+	inline Result Run(std::string_view a_name, std::uint64_t a_ops, Fn&& a_fn)
+	{
+		using clock = std::chrono::steady_clock;
+
+		for (std::uint64_t i = 0; i < a_ops / 10; ++i) {
+			a_fn(i);
+		}
+
+		const auto a0 = Allocations();
+		const auto t0 = clock::now();
+		for (std::uint64_t i = 0; i < a_ops; ++i) {
+			a_fn(i);
+		}
+		const auto t1 = clock::now();
+		const auto a1 = Allocations();
+
+		Result r{ a_name, a_ops,
+			std::chrono::duration<double, std::nano>(t1 - t0).count() / static_cast<double>(a_ops),
+			static_cast<double>(a1 - a0) / static_cast<double>(a_ops) };
+		if (detail::g_countingAllocations) {
+			std::printf("%-48.*s %12llu ops %10.2f ns/op %8.3f allocs/op\n",
+				static_cast<int>(r.name.size()), r.name.data(),
+				static_cast<unsigned long long>(r.ops), r.nsPerOp, r.allocsPerOp);
+		} else {
+			std::printf("%-48.*s %12llu ops %10.2f ns/op\n",
+				static_cast<int>(r.name.size()), r.name.data(),
+				static_cast<unsigned long long>(r.ops), r.nsPerOp);
+		}
+		return r;
+	}
+
+	// One result per line, so baselines diff cleanly and ReadBaseline() needs no JSON parser:
+	//   {"suite": "...", "results": [
+	//     {"name": "...", "ops": N, "ns_per_op": X, "allocs_per_op": Y},
+	//   ...]}
+	inline bool WriteJson(const char* a_path, std::string_view a_suite, const std::vector<Result>& a_results)
+	{
+		std::FILE* f = std::fopen(a_path, "w");
+		if (!f) {
+			std::fprintf(stderr, "cannot write %s\n", a_path);
+			return false;
+		}
+
+		std::fprintf(f, "{\"suite\": \"%.*s\", \"results\": [\n", static_cast<int>(a_suite.size()), a_suite.data());
+		for (std::size_t i = 0; i < a_results.size(); ++i) {
+			const auto& r = a_results[i];
+			std::fprintf(f, "  {\"name\": \"%.*s\", \"ops\": %llu, \"ns_per_op\": %.3f, \"allocs_per_op\": %.4f}%s\n",
+				static_cast<int>(r.name.size()), r.name.data(),
+				static_cast<unsigned long long>(r.ops), r.nsPerOp, r.allocsPerOp,
+				i + 1 < a_results.size() ? "," : "");
+		}
+		std::fprintf(f, "]}\n");
+		return std::fclose(f) == 0;
+	}
+
+	struct BaselineEntry
+	{
+		std::string name;
+		double nsPerOp{ 0.0 };
+		double allocsPerOp{ 0.0 };
+	};
+
+	// Reads a file written by WriteJson().
+	inline std::vector<BaselineEntry> ReadBaseline(const char* a_path)
+	{
+		std::vector<BaselineEntry> out;
+		std::ifstream in(a_path);
+		std::string line;
+		while (std::getline(in, line)) {
+			constexpr std::string_view kName = "{\"name\": \"";
+			const auto n = line.find(kName);
+			if (n == std::string::npos) {
+				continue;
+			}
+			const auto begin = n + kName.size();
+			const auto end = line.find('"', begin);
+			const auto ns = line.find("\"ns_per_op\": ");
+			const auto al = line.find("\"allocs_per_op\": ");
+			if (end == std::string::npos || ns == std::string::npos || al == std::string::npos) {
+				continue;
+			}
+
+			BaselineEntry e;
+			e.name = line.substr(begin, end - begin);
+			e.nsPerOp = std::strtod(line.c_str() + ns + 13, nullptr);
+			e.allocsPerOp = std::strtod(line.c_str() + al + 17, nullptr);
+			out.push_back(std::move(e));
+		}
+		return out;
+	}
+
+	// Prints current vs. baseline per case. Returns false if the baseline could not be read.
+	inline bool CompareBaseline(const char* a_path, const std::vector<Result>& a_results)
+	{
+		const auto baseline = ReadBaseline(a_path);
+		if (baseline.empty()) {
+			std::fprintf(stderr, "no results in baseline %s\n", a_path);
+			return false;
+		}
+
+		std::printf("\nvs. baseline %s\n", a_path);
+		for (const auto& r : a_results) {
+			const BaselineEntry* base = nullptr;
+			for (const auto& b : baseline) {
+				if (b.name == r.name) {
+					base = &b;
+					break;
+				}
+			}
+
+			if (!base) {
+				std::printf("%-48.*s %10.2f ns/op   (new)\n", static_cast<int>(r.name.size()), r.name.data(), r.nsPerOp);
+				continue;
+			}
+
+			const double pct = base->nsPerOp > 0.0 ? (r.nsPerOp / base->nsPerOp - 1.0) * 100.0 : 0.0;
+			std::printf("%-48.*s %10.2f -> %10.2f ns/op %+7.1f%%   allocs %.3f -> %.3f\n",
+				static_cast<int>(r.name.size()), r.name.data(),
+				base->nsPerOp, r.nsPerOp, pct, base->allocsPerOp, r.allocsPerOp);
+		}
+		return true;
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+// Counts heap allocations for Bench::Run(). Include from exactly one translation unit per
+// benchmark executable: it replaces the global operator new/delete.
+
+#include "Bench.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace SF::Bench::detail
+{
+	inline const bool g_allocCounterInstalled = (g_countingAllocations = true);
+
+	// Every replaced operator below allocates and frees through these, so memory is never
+	// released by an allocator other than the one that handed it out. Aligned blocks come from
+	// the aligned pair (_aligned_malloc has its own free on MSVC).
+	inline void* Allocate(std::size_t a_size, std::size_t a_align) noexcept
+	{
+		g_allocations.fetch_add(1, std::memory_order_relaxed);
+		a_size = a_size ? a_size : 1;
+		if (a_align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+			return std::malloc(a_size);
+		}
+#if defined(_MSC_VER)
+		return _aligned_malloc(a_size, a_align);
+#else
+		return std::aligned_alloc(a_align, (a_size + a_align - 1) / a_align * a_align);
+#endif
+	}
+
+	inline void Release(void* a_ptr, std::size_t a_align) noexcept
+	{
+#if defined(_MSC_VER)
+		if (a_align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+			_aligned_free(a_ptr);
+			return;
+		}
+#endif
+		(void)a_align;
+		std::free(a_ptr);
+	}
+
+	inline void* AllocateOrThrow(std::size_t a_size, std::size_t a_align)
+	{
+		if (void* p = Allocate(a_size, a_align)) {
+			return p;
+		}
+		throw std::bad_alloc();
+	}
+
+	inline constexpr std::size_t kDefaultAlign = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+}
+
+// Plain
+void* operator new(std::size_t a_size) { return SF::Bench::detail::AllocateOrThrow(a_size, SF::Bench::detail::kDefaultAlign); }
+void* operator new[](std::size_t a_size) { return SF::Bench::detail::AllocateOrThrow(a_size, SF::Bench::detail::kDefaultAlign); }
+void* operator new(std::size_t a_size, const std::nothrow_t&) noexcept { return SF::Bench::detail::Allocate(a_size, SF::Bench::detail::kDefaultAlign); }
+void* operator new[](std::size_t a_size, const std::nothrow_t&) noexcept { return SF::Bench::detail::Allocate(a_size, SF::Bench::detail::kDefaultAlign); }
+
+void operator delete(void* a_ptr) noexcept { SF::Bench::detail::Release(a_ptr, SF::Bench::detail::kDefaultAlign); }
+void operator delete[](void* a_ptr) noexcept { SF::Bench::detail::Release(a_ptr, SF::Bench::detail::kDefaultAlign); }
+void operator delete(void* a_ptr, std::size_t) noexcept { SF::Bench::detail::Release(a_ptr, SF::Bench::detail::kDefaultAlign); }
+void operator delete[](void* a_ptr, std::size_t) noexcept { SF::Bench::detail::Release(a_ptr, SF::Bench::detail::kDefaultAlign); }
+void operator delete(void* a_ptr, const std::nothrow_t&) noexcept { SF::Bench::detail::Release(a_ptr, SF::Bench::detail::kDefaultAlign); }
+void operator delete[](void* a_ptr, const std::nothrow_t&) noexcept { SF::Bench::detail::Release(a_ptr, SF::Bench::detail::kDefaultAlign); }
+
+// Over-aligned (alignas > __STDCPP_DEFAULT_NEW_ALIGNMENT__, e.g. the store's 64-byte shards)
+void* operator new(std::size_t a_size, std::align_val_t a_align) { return SF::Bench::detail::AllocateOrThrow(a_size, static_cast<std::size_t>(a_align)); }
+void* operator new[](std::size_t a_size, std::align_val_t a_align) { return SF::Bench::detail::AllocateOrThrow(a_size, static_cast<std::size_t>(a_align)); }
+void* operator new(std::size_t a_size, std::align_val_t a_align, const std::nothrow_t&) noexcept { return SF::Bench::detail::Allocate(a_size, static_cast<std::size_t>(a_align)); }
+void* operator new[](std::size_t a_size, std::align_val_t a_align, const std::nothrow_t&) noexcept { return SF::Bench::detail::Allocate(a_size, static_cast<std::size_t>(a_align)); }
+
+void operator delete(void* a_ptr, std::align_val_t a_align) noexcept { SF::Bench::detail::Release(a_ptr, static_cast<std::size_t>(a_align)); }
+void operator delete[](void* a_ptr, std::align_val_t a_align) noexcept { SF::Bench::detail::Release(a_ptr, static_cast<std::size_t>(a_align)); }
+void operator delete(void* a_ptr, std::size_t, std::align_val_t a_align) noexcept { SF::Bench::detail::Release(a_ptr, static_cast<std::size_t>(a_align)); }
+void operator delete[](void* a_ptr, std::size_t, std::align_val_t a_align) noexcept { SF::Bench::detail::Release(a_ptr, static_cast<std::size_t>(a_align)); }
+void operator delete(void* a_ptr, std::align_val_t a_align, const std::nothrow_t&) noexcept { SF::Bench::detail::Release(a_ptr, static_cast<std::size_t>(a_align)); }
+void operator delete[](void* a_ptr, std::align_val_t a_align, const std::nothrow_t&) noexcept { SF::Bench::detail::Release(a_ptr, static_cast<std::size_t>(a_align)); }
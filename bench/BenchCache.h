@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(__linux__)
+#	include <linux/perf_event.h>
+#	include <sys/ioctl.h>
+#	include <sys/syscall.h>
+#	include <unistd.h>
+
+#	include <cstring>
+#endif
+
+namespace SF::Bench
+{
+	// L1 data-cache read misses of this thread, from the CPU's counters (Linux perf events).
+	// Available() is false elsewhere, in VMs without a PMU, or with perf_event_paranoid > 2;
+	// benchmarks then print n/a instead of a count.
+	class CacheMisses
+	{
+	public:
+		CacheMisses()
+		{
+#if defined(__linux__)
+			perf_event_attr attr;
+			std::memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.type = PERF_TYPE_HW_CACHE;
+			attr.config = PERF_COUNT_HW_CACHE_L1D |
+			              (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+			              (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+			attr.disabled = 1;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			_fd = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+		}
+
+		~CacheMisses()
+		{
+#if defined(__linux__)
+			if (_fd >= 0) {
+				::close(_fd);
+			}
+#endif
+		}
+
+		CacheMisses(const CacheMisses&) = delete;
+		CacheMisses& operator=(const CacheMisses&) = delete;
+
+		[[nodiscard]] bool Available() const noexcept { return _fd >= 0; }
+
+		// Counting between Start() and Stop() adds up over several pairs.
+		void Start() noexcept
+		{
+#if defined(__linux__)
+			if (_fd >= 0) {
+				::ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+			}
+#endif
+		}
+
+		void Stop() noexcept
+		{
+#if defined(__linux__)
+			if (_fd >= 0) {
+				::ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0);
+			}
+#endif
+		}
+
+		[[nodiscard]] std::uint64_t Read() const noexcept
+		{
+			std::uint64_t value = 0;
+#if defined(__linux__)
+			if (_fd >= 0 && ::read(_fd, &value, sizeof(value)) != sizeof(value)) {
+				value = 0;
+			}
+#endif
+			return value;
+		}
+
+		void Reset() noexcept
+		{
+#if defined(__linux__)
+			if (_fd >= 0) {
+				::ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+			}
+#endif
+		}
+
+	private:
+		int _fd{ -1 };
+	};
+}
@@ -0,0 +1,808 @@
+// Per-event cost of the plugin's hot paths, run against the mock world.
+//
+//   classify   : AnimTag::Classify (constexpr built-in table) on a combat-like stream (~5% tags
+//                we use), and the runtime AnimTagDict the sinks use: built-ins only, and with an
+//                animation pack's worth of extra tags (some of them project-scoped)
+//   weapon tbl : WeaponCost::Table lookup that replaced the per-swing form queries
+//   perk cache : CostMultCache hit path that replaced the per-swing perk entry-point walk
+//   resolve    : LightAttack::ResolveHandForTag on left/right/ambiguous/unarmed-sound streams
+//   anim sink  : what Events::AnimEventBus does per event (classify, tag-class fast reject,
+//                actor lookup, fan-out to the LightAttack tracker) for 1, 20 and 200 fighting actors
+//   blocked hit: HitEventHook::ProcessHit's stamina/health split (BlockedHit::Apply), and the
+//                policy with every Shield.* factor group on (ApplyPolicy<all>)
+//   input sink : DualWielding's InputSink per frame: Input::Bindings::Dispatch over the
+//                InputEvent chain, parry action -> Parry::OnPress -> the parry coroutine
+//                (2 frames -> drain -> 40 ms -> bash); plus a chord + hold binding set
+//   scheduler  : Frame::Scheduler start + tick with ~5 parry sequences in flight
+//   av queue   : a frame's stamina/AttackDamageMult writes for 20 actors coalesced by
+//                AvWriteQueue, then flushed (one net write per actor and layer)
+//   av reads   : a light-attack spend's reads (3x stamina, write, stamina) through AvReadCache,
+//                on and off; the engine side is a virtual call per value, like ActorValueOwner
+//   latency    : what SF_LATENCY_SCOPE adds to every hook and sink call, recording and
+//                "Latency.Enabled": false; the Collect() the report runs is timed once
+//   clock      : Core::Clock::FrameMs() (what the hot paths read) against PreciseMs()
+//   state      : one event's access to its actor's light-attack state, 200 actors: the old
+//                layout (ActorState with its debug/penalty fields inline, one unordered_map node
+//                per actor) against the store's slot arena (SessionState hot line + ActorCold);
+//                in cache, with actor churn, and after evicting the caches like a game frame
+//                would (L1D read misses per event where the CPU counters are readable)
+//
+// The input sink and scheduler cases run on a Core::Clock::Fake stepped 16 ms per frame.
+//
+// Usage: sf_bench_hotpaths [--json out.json] [--baseline old.json] [--scale N]
+//   --scale multiplies the iteration counts (default 1; use 0.1 under sanitizers).
+
+#include "Bench.h"
+#include "BenchAlloc.h"
+#include "BenchCache.h"
+
+#include "SF/Core/AnimTag.h"
+#include "SF/Core/AnimTagDict.h"
+#include "SF/Core/AvReadCache.h"
+#include "SF/Core/AvWriteQueue.h"
+#include "SF/Core/Clock.h"
+#include "SF/Core/FrameScheduler.h"
+#include "SF/Core/Latency.h"
+#include "SF/Engine/Input.h"
+#include "SF/Engine/Mock/World.h"
+#include "SF/Logic/BlockedHit.h"
+#include "SF/Logic/CostMultCache.h"
+#include "SF/Logic/LightAttackTracker.h"
+#include "SF/Logic/Parry.h"
+#include "SF/Logic/WeaponCostTable.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	namespace AnimTag = SF::Core::AnimTag;
+	namespace LA = SF::Logic::LightAttack;
+	namespace Mock = SF::Engine::Mock;
+	using SF::Engine::Weapon;
+	using SF::Engine::WeaponKind;
+
+	// Tiny deterministic RNG (xorshift32): every run sees the same streams.
+	struct Rng
+	{
+		std::uint32_t state{ 0x9E3779B9u };
+
+		std::uint32_t Next() noexcept
+		{
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return state;
+		}
+	};
+
+	constexpr std::array<std::string_view, 24> kNoise{
+		"FootLeft", "FootRight", "FootSprintLeft", "FootSprintRight",
+		"SoundPlay.NPCHumanFootstepWalk", "SoundPlay.NPCHumanFootstepRun",
+		"SoundPlay.NPCHumanCombatIdleA", "SoundPlay.WPNSwordUnsheathe",
+		"TurnLeft", "TurnRight", "tailCombatIdle", "tailCombatState",
+		"preHitFrame", "HitFrame", "attackStop", "weaponDraw",
+		"blockStartOut", "blockStop", "animClipEnd", "MTState",
+		"Collision_AttackStart", "SyncLeft", "SyncRight", "PickNewIdle",
+	};
+
+	// One light attack as the behavior graph emits it (the tags we react to, in order).
+	constexpr std::array<std::array<std::string_view, 3>, 5> kAttacks{ {
+		{ "attackStart", "weaponSwing", "" },
+		{ "attackStartLeft", "weaponLeftSwing", "" },
+		{ "AttackStartRight", "WeaponRightSwing", "" },
+		{ "attackStart", "SoundPlay.WPNSwingUnarmed", "weaponSwing" },
+		{ "attackStartLeft", "weaponSwing", "" },
+	} };
+
+	constexpr std::array<std::array<Weapon, 2>, 4> kLoadouts{ {
+		{ { { WeaponKind::kOneHand, 0x801, 10.0f }, { WeaponKind::kOneHand, 0x802, 12.0f } } },  // dual wield
+		{ { { WeaponKind::kTwoHand, 0x803, 22.0f }, { WeaponKind::kTwoHand, 0x803, 22.0f } } },  // greatsword
+		{ { {}, { WeaponKind::kOneHand, 0x804, 9.0f } } },                                       // sword + free hand
+		{ { {}, {} } },                                                                          // fists
+	} };
+
+	struct AnimEvent
+	{
+		std::uint32_t actor;
+		std::string_view tag;
+	};
+
+	// Interleaves noise with every actor's attack sequences, ~5% of events are ours.
+	std::vector<AnimEvent> BuildAnimStream(std::size_t a_count, std::uint32_t a_actors)
+	{
+		struct Cursor
+		{
+			std::uint32_t attack{ 0 };
+			std::uint32_t step{ 0 };
+		};
+		std::vector<Cursor> cursors(a_actors);
+
+		std::vector<AnimEvent> out;
+		out.reserve(a_count);
+		Rng rng;
+		while (out.size() < a_count) {
+			const std::uint32_t r = rng.Next();
+			const std::uint32_t actor = 0x14 + (r >> 8) % a_actors;
+			if (r % 100 >= 5) {
+				out.push_back({ actor, kNoise[(r >> 16) % kNoise.size()] });
+				continue;
+			}
+
+			auto& c = cursors[actor - 0x14];
+			const auto& attack = kAttacks[c.attack];
+			out.push_back({ actor, attack[c.step] });
+			if (++c.step == attack.size() || attack[c.step].empty()) {
+				c.step = 0;
+				c.attack = (c.attack + 1 + (r >> 24)) % kAttacks.size();
+			}
+		}
+		return out;
+	}
+
+	Mock::Actor& SpawnFighter(Mock::World& a_world, std::uint32_t a_formID)
+	{
+		auto& actor = a_world.Spawn(a_formID, 150.0f);
+		const auto& loadout = kLoadouts[a_formID % kLoadouts.size()];
+		actor.Equip(true, loadout[0]);
+		actor.Equip(false, loadout[1]);
+		actor.SetCostMult(a_formID % 3 == 0 ? 0.75f : 1.0f);
+		return actor;
+	}
+
+	// Stands in for RE::ActorValueOwner: one virtual call per value read.
+	struct AvOwner
+	{
+		virtual ~AvOwner() = default;
+		virtual float GetActorValue(SF::Core::AvRead a_read) const = 0;
+	};
+
+	struct MockAvOwner : AvOwner
+	{
+		explicit MockAvOwner(const Mock::Actor& a_actor) :
+			actor(a_actor)
+		{}
+
+		float GetActorValue(SF::Core::AvRead a_read) const override
+		{
+			return a_read == SF::Core::AvRead::kStamina ? actor.Stamina() : 100.0f;
+		}
+
+		const Mock::Actor& actor;
+	};
+
+	// DualWielding's ParrySequence on the mock: interrupt (no graph here), drain two frames
+	// later, bash visual 40 ms after that.
+	SF::Core::Frame::Task ParrySequence(Mock::Actor& a_player, std::uint64_t& a_bashes)
+	{
+		using namespace std::chrono_literals;
+
+		co_await SF::Core::Frame::Frames(2);
+		SF::Logic::Parry::Drain(a_player);
+		co_await SF::Core::Frame::Delay(40ms);
+		++a_bashes;
+	}
+
+	// The per-actor light-attack state before the slot arena: one struct per actor in a node of
+	// the shard's unordered_map, the sessions' debug fields and the penalty details in between
+	// the fields every event touches (120 bytes over two or three cache lines).
+	namespace Legacy
+	{
+		using Ms = SF::Core::Clock::Ms;
+
+		struct HandSession
+		{
+			bool active{ false };
+			bool spent{ false };
+			Ms startMs{ 0 };
+			float startStamina{ 0.0f };
+			std::uint32_t startWeapFormID{ 0u };
+			bool startWasTwoHanded{ false };
+		};
+
+		struct ActorState
+		{
+			std::array<Ms, 2> lastExplicitHandMs{ 0u, 0u };
+			std::array<HandSession, 2> session{};
+			Ms lastUnarmedSoundMs{ 0 };
+			bool lastUnarmedHandIsLeft{ false };
+			bool lastUnarmedHandValid{ false };
+			bool dmgScaleApplied{ false };
+			Ms dmgScaleUntilMs{ 0 };
+			float dmgScaleDelta{ 0.0f };
+		};
+
+		// The old ActorStateStore: 64 shards of mutex + unordered_map.
+		class Store
+		{
+			struct alignas(64) Shard
+			{
+				std::mutex lock;
+				std::unordered_map<std::uint32_t, ActorState> map;
+			};
+
+		public:
+			struct Accessor
+			{
+				std::unique_lock<std::mutex> lock;
+				ActorState* value;
+
+				ActorState* operator->() const noexcept { return value; }
+				ActorState& operator*() const noexcept { return *value; }
+			};
+
+			Accessor Acquire(std::uint32_t a_id)
+			{
+				auto& shard = _shards[SF::Core::ActorStateStore<int>::ShardIndex(a_id)];
+				std::unique_lock lock{ shard.lock };
+				return { std::move(lock), &shard.map[a_id] };
+			}
+
+			void Erase(std::uint32_t a_id)
+			{
+				auto& shard = _shards[SF::Core::ActorStateStore<int>::ShardIndex(a_id)];
+				std::scoped_lock _{ shard.lock };
+				shard.map.erase(a_id);
+			}
+
+		private:
+			std::array<Shard, 64> _shards{};
+		};
+	}
+
+	// The state side of one Process() call: explicit-hand note, session window check, start or
+	// spend, the penalty flag read. Legacy starts also wrote the session's debug weapon.
+	template <class State>
+	void TouchState(State& a_st, SF::Core::Clock::Ms a_now, std::uint32_t a_step)
+	{
+		const auto idx = a_step & 1;
+		a_st.lastExplicitHandMs[idx] = a_now;
+		auto& s = a_st.session[idx];
+		if (!s.active || a_now - s.startMs > 800) {
+			s.active = true;
+			s.spent = false;
+			s.startMs = a_now;
+			s.startStamina = 100.0f;
+		} else {
+			s.spent = true;
+			s.active = false;
+		}
+		SF::Bench::DoNotOptimize(a_st.lastUnarmedSoundMs + a_st.dmgScaleApplied);
+	}
+
+	void LegacyEvent(Legacy::Store& a_store, std::uint32_t a_id, SF::Core::Clock::Ms a_now, std::uint32_t a_step)
+	{
+		auto st = a_store.Acquire(a_id);
+		TouchState(*st, a_now, a_step);
+		if (st->session[a_step & 1].active) {
+			st->session[a_step & 1].startWeapFormID = a_id;
+		}
+	}
+
+	void ArenaEvent(LA::Tracker::Store& a_store, std::uint32_t a_id, SF::Core::Clock::Ms a_now, std::uint32_t a_step)
+	{
+		auto st = a_store.Acquire(a_id);
+		TouchState(*st, a_now, a_step);
+	}
+
+	struct Options
+	{
+		const char* json{ nullptr };
+		const char* baseline{ nullptr };
+		double scale{ 1.0 };
+	};
+
+	bool ParseArgs(int a_argc, char** a_argv, Options& a_out)
+	{
+		for (int i = 1; i < a_argc; ++i) {
+			const std::string_view arg = a_argv[i];
+			const bool hasValue = i + 1 < a_argc;
+			if (arg == "--json" && hasValue) {
+				a_out.json = a_argv[++i];
+			} else if (arg == "--baseline" && hasValue) {
+				a_out.baseline = a_argv[++i];
+			} else if (arg == "--scale" && hasValue) {
+				a_out.scale = std::strtod(a_argv[++i], nullptr);
+			} else {
+				std::fprintf(stderr, "usage: sf_bench_hotpaths [--json out.json] [--baseline old.json] [--scale N]\n");
+				return false;
+			}
+		}
+		return a_out.scale > 0.0;
+	}
+}
+
+int main(int a_argc, char** a_argv)
+{
+	Options opt;
+	if (!ParseArgs(a_argc, a_argv, opt)) {
+		return 2;
+	}
+
+	const auto ops = [&](std::uint64_t a_n) {
+		return std::max<std::uint64_t>(1000, static_cast<std::uint64_t>(static_cast<double>(a_n) * opt.scale));
+	};
+
+	std::vector<SF::Bench::Result> results;
+
+	// --- tag classification ---
+	{
+		const auto stream = BuildAnimStream(4096, 20);
+		const std::size_t mask = stream.size() - 1;
+
+		std::printf("tag classification\n");
+		results.push_back(SF::Bench::Run("classify: combat stream", ops(20'000'000), [&](std::uint64_t i) {
+			SF::Bench::DoNotOptimize(AnimTag::Classify(stream[i & mask].tag));
+		}));
+		results.push_back(SF::Bench::Run("classify: dictionary, built-ins", ops(20'000'000), [&](std::uint64_t i) {
+			SF::Bench::DoNotOptimize(SF::Core::AnimTagDict::Get().Classify(stream[i & mask].tag));
+		}));
+
+		// An attack-behavior pack: per-direction start/swing tags, a few scoped to one project.
+		std::vector<SF::Core::AnimTagDict::Rule> rules;
+		for (int i = 0; i < 24; ++i) {
+			const auto n = std::to_string(i);
+			rules.push_back({ "MCO_AttackStart" + n + "L", {}, AnimTag::kFlagStart | AnimTag::kFlagLeft });
+			rules.push_back({ "MCO_AttackStart" + n + "R", {}, AnimTag::kFlagStart | AnimTag::kFlagRight });
+			rules.push_back({ "MCO_WeaponSwing" + n, {}, AnimTag::kFlagSpend });
+			rules.push_back({ "BFCO_Swipe" + n, i % 4 ? std::string{} : std::string{ "WerewolfBeastProject" }, AnimTag::kFlagSpend });
+		}
+		const SF::Core::AnimTagDict::Dictionary pack{ rules };
+		results.push_back(SF::Bench::Run("classify: dictionary, +96 pack tags", ops(20'000'000), [&](std::uint64_t i) {
+			SF::Bench::DoNotOptimize(pack.Classify(stream[i & mask].tag));
+		}));
+		std::printf("  pack dictionary: %zu tags (%zu project-scoped), longest probe %zu\n", pack.Size(), pack.Scoped(), pack.MaxProbe());
+	}
+
+	// --- hand resolution ---
+	{
+		std::printf("\nResolveHandForTag\n");
+
+		constexpr std::array<std::string_view, 4> kExplicit{ "weaponLeftSwing", "weaponRightSwing", "attackStartLeft", "AttackStartRight" };
+		constexpr std::array<std::string_view, 4> kAmbiguous{ "weaponSwing", "attackStart", "WeaponSwing", "AttackStart" };
+		constexpr std::array<std::string_view, 8> kMixed{
+			"attackStartLeft", "weaponSwing", "attackStart", "SoundPlay.WPNSwingUnarmed",
+			"weaponSwing", "WeaponRightSwing", "attackStart", "weaponLeftSwing",
+		};
+
+		const auto run = [&](std::string_view a_name, const auto& a_tags, const std::array<Weapon, 2>& a_loadout) {
+			std::vector<AnimTag::Info> infos;
+			for (const auto t : a_tags) {
+				infos.push_back(AnimTag::Classify(t));
+			}
+
+			Mock::Actor actor{ 0x14 };
+			actor.Equip(true, a_loadout[0]);
+			actor.Equip(false, a_loadout[1]);
+			LA::SessionState st;
+
+			results.push_back(SF::Bench::Run(a_name, ops(20'000'000), [&](std::uint64_t i) {
+				const auto& tag = infos[i % infos.size()];
+				const auto now = static_cast<std::uint32_t>(i * 7);
+				LA::NoteExplicitHandIfAny(tag, st, now);
+				bool ambiguous = false;
+				bool unarmed = false;
+				SF::Bench::DoNotOptimize(LA::ResolveHandForTag(actor, tag, st, now, ambiguous, unarmed));
+				SF::Bench::DoNotOptimize(ambiguous);
+			}));
+		};
+
+		run("resolve: explicit, dual wield", kExplicit, kLoadouts[0]);
+		run("resolve: ambiguous, dual wield", kAmbiguous, kLoadouts[0]);
+		run("resolve: ambiguous, sword + free hand", kAmbiguous, kLoadouts[2]);
+		run("resolve: mixed, fists", kMixed, kLoadouts[3]);
+		run("resolve: mixed, dual wield", kMixed, kLoadouts[0]);
+	}
+
+	// --- weapon cost table ---
+	{
+		std::printf("\nWeaponCost::Table (per Equipped() lookup)\n");
+
+		// Roughly a modded load order: a few thousand weapons spread over many plugins.
+		std::vector<Weapon> weapons;
+		Rng rng;
+		for (std::uint32_t plugin = 0; plugin < 64; ++plugin) {
+			for (std::uint32_t i = 0; i < 48; ++i) {
+				const auto kind = static_cast<WeaponKind>(1 + rng.Next() % 4);
+				weapons.push_back({ kind, (plugin << 24) | (0x800 + i * 3), static_cast<float>(rng.Next() % 30) });
+			}
+		}
+		auto& table = SF::Logic::WeaponCost::Table::GetSingleton();
+		table.Build(weapons);
+
+		results.push_back(SF::Bench::Run("weapon table: Find + BaseCost", ops(50'000'000), [&](std::uint64_t i) {
+			const auto* e = table.Find(weapons[(i * 2654435761u) % weapons.size()].formID);
+			SF::Bench::DoNotOptimize(LA::BaseCost(e->ToWeapon()));
+		}));
+	}
+
+	// --- perk multiplier cache ---
+	{
+		std::printf("\nCostMultCache (per CostMult() on a spend, 200 actors x 2 weapons)\n");
+
+		auto& cache = SF::Logic::CostMultCache::GetSingleton();
+		cache.SetTtlMs(0);
+		const auto before = cache.GetCounters();
+
+		results.push_back(SF::Bench::Run("perk mult cache: lookup", ops(20'000'000), [&](std::uint64_t i) {
+			const auto actor = 0x14 + static_cast<std::uint32_t>((i * 2654435761u) % 200);
+			const auto weapon = 0x800 + static_cast<std::uint32_t>(i & 1);
+			SF::Bench::DoNotOptimize(cache.Get(actor, weapon, [] { return 0.75f; }));
+		}));
+
+		const auto after = cache.GetCounters();
+		std::printf("  hits=%llu misses=%llu\n",
+			static_cast<unsigned long long>(after.hits - before.hits),
+			static_cast<unsigned long long>(after.misses - before.misses));
+		cache.InvalidateAll();
+	}
+
+	// --- AnimEventBus sink -> LightAttack ---
+	{
+		std::printf("\nAnimEventBus sink -> LightAttack (per animation event, ~5%% relevant)\n");
+
+		static constexpr std::array<std::uint32_t, 3> kActorCounts{ 1, 20, 200 };
+		static constexpr std::array<std::string_view, 3> kNames{
+			"anim sink: 1 actor", "anim sink: 20 actors", "anim sink: 200 actors"
+		};
+
+		for (std::size_t c = 0; c < kActorCounts.size(); ++c) {
+			const std::uint32_t actors = kActorCounts[c];
+			const auto stream = BuildAnimStream(1u << 16, actors);
+			const std::size_t mask = stream.size() - 1;
+
+			Mock::World world;
+			for (std::uint32_t i = 0; i < actors; ++i) {
+				SpawnFighter(world, 0x14 + i);
+			}
+			LA::Tracker tracker;
+
+			results.push_back(SF::Bench::Run(kNames[c], ops(10'000'000), [&](std::uint64_t i) {
+				const auto& e = stream[i & mask];
+				const auto tag = SF::Core::AnimTagDict::Get().Classify(e.tag);
+
+				// The bus's reject: no subscriber's tag class, and no penalty waiting to expire.
+				if (!tag.Any(AnimTag::kFlagStaminaMask | AnimTag::kFlagJump) && tracker.ActiveDamageScales() == 0) {
+					return;
+				}
+
+				auto* actor = world.Find(e.actor);
+				if (!actor) {
+					return;
+				}
+
+				if (!tracker.WantsEvent(tag)) {
+					return;
+				}
+
+				// Stamina regenerates between attacks in the game; keep fighters from running dry.
+				if (tag.IsStart() && actor->Stamina() < 40.0f) {
+					actor->SetStamina(150.0f);
+				}
+
+				SF::Bench::DoNotOptimize(tracker.OnEvent(*actor, tag, static_cast<std::uint32_t>(i)));
+			}));
+		}
+	}
+
+	// --- HitEventHook::ProcessHit ---
+	{
+		std::printf("\nHitEventHook::ProcessHit blocked-hit math\n");
+
+		std::array<float, 64> incoming{};
+		std::array<float, 64> stamina{};
+		Rng rng;
+		for (std::size_t i = 0; i < incoming.size(); ++i) {
+			incoming[i] = 5.0f + static_cast<float>(rng.Next() % 600) / 10.0f;
+			stamina[i] = static_cast<float>(rng.Next() % 1200) / 10.0f;  // some hits drain it fully
+		}
+
+		results.push_back(SF::Bench::Run("blocked hit: Resolve", ops(50'000'000), [&](std::uint64_t i) {
+			SF::Bench::DoNotOptimize(SF::Logic::BlockedHit::Resolve(incoming[i & 63], stamina[(i >> 6) & 63], 1.0f));
+		}));
+
+		Mock::Actor target{ 0x14 };
+		results.push_back(SF::Bench::Run("blocked hit: Apply (mock actor)", ops(20'000'000), [&](std::uint64_t i) {
+			target.SetStamina(stamina[(i >> 6) & 63]);
+			SF::Bench::DoNotOptimize(SF::Logic::BlockedHit::Apply(target, incoming[i & 63], 1.0f));
+		}));
+
+		// Every factor group configured: the most expensive instantiation the hook can select.
+		namespace BH = SF::Logic::BlockedHit;
+		BH::ShieldConfig cfg{};
+		cfg.playerMult = 0.8f;
+		cfg.weaponBlockMult = 1.5f;
+		cfg.twoHandMult = 1.25f;
+		cfg.guardBreakThreshold = 40.0f;
+		constexpr std::uint8_t kAll = BH::kSides | BH::kBlockType | BH::kWeaponClass | BH::kGuardBreak;
+		results.push_back(SF::Bench::Run("blocked hit: ApplyPolicy<all> (mock actor)", ops(20'000'000), [&](std::uint64_t i) {
+			target.SetStamina(stamina[(i >> 6) & 63]);
+			const BH::Hit hit{ .incoming = incoming[i & 63],
+				.defenderIsPlayer = (i & 1) != 0,
+				.weaponBlock = (i & 2) != 0,
+				.attackerWeapon = (i & 4) != 0 ? SF::Engine::WeaponKind::kTwoHand : SF::Engine::WeaponKind::kOneHand };
+			SF::Bench::DoNotOptimize(BH::ApplyPolicy<kAll>(target, hit, cfg).healthDamage);
+		}));
+	}
+
+	// --- DualWielding InputSink::ProcessEvent ---
+	{
+		std::printf("\nDualWielding InputSink::ProcessEvent (per input frame)\n");
+
+		constexpr std::uint32_t kParryKey = 48;
+		using Input = Mock::InputEvent;
+
+		// A busy frame: mouse look, stick, a held movement key and (every 10th frame) the parry key.
+		std::array<Input, 8> chain{ {
+			{ Input::Type::kMouseMove },
+			{ Input::Type::kThumbstick },
+			{ Input::Type::kButton, nullptr, 17, 1.0f, 0.4f },   // W held
+			{ Input::Type::kButton, nullptr, 42, 1.0f, 1.2f },   // shift held
+			{ Input::Type::kButton, nullptr, 256, 0.0f, 0.3f },  // LMB released
+			{ Input::Type::kChar },
+			{ Input::Type::kMouseMove },
+			{ Input::Type::kButton, nullptr, kParryKey, 1.0f, 0.0f },
+		} };
+		for (std::size_t i = 0; i + 1 < chain.size(); ++i) {
+			chain[i].next = &chain[i + 1];
+		}
+
+		Mock::World world;
+		auto& player = SpawnFighter(world, 0x14);
+		SF::Core::Clock::Fake clock;
+		SF::Core::Frame::Scheduler scheduler;
+		std::uint64_t bashes = 0;
+		SF::Engine::Input::Bindings bindings;
+		bindings.Add({ .action = 0, .key = kParryKey, .debounceMs = SF::Core::Config::Get().dualWielding.parryDebounceMs });
+
+		results.push_back(SF::Bench::Run("input sink: 8-event chain, parry every 10th", ops(5'000'000), [&](std::uint64_t i) {
+			// Frames without the parry press end one event earlier.
+			chain[6].next = i % 10 == 0 ? &chain[7] : nullptr;
+
+			bindings.Dispatch(&chain[0], SF::Core::Clock::FrameMs(), [&](std::uint8_t) {
+				if (SF::Logic::Parry::OnPress(player) != SF::Logic::Parry::Result::kParry) {
+					return;
+				}
+				scheduler.Start(ParrySequence(player, bashes));
+			});
+
+			world.RunFrame();
+			clock.Step();
+			scheduler.Tick();
+			if (player.Stamina() < SF::Core::Config::Get().dualWielding.parryStaminaCost) {
+				player.SetStamina(150.0f);
+			}
+		}));
+
+		// Twelve bindings spread over keyboard, mouse and gamepad: shift+key chords, a hold and a
+		// release on the held keys of the same chain.
+		SF::Engine::Input::Bindings busy;
+		for (std::uint8_t a = 0; a < 8; ++a) {
+			busy.Add({ .action = a, .key = 2u + a, .modifier = 42 });
+		}
+		busy.Add({ .action = 8, .key = 17, .trigger = SF::Engine::Input::Trigger::kHold, .holdMs = 300 });
+		busy.Add({ .action = 9, .key = 256, .trigger = SF::Engine::Input::Trigger::kRelease });
+		busy.Add({ .action = 10, .key = SF::Engine::Input::kGamepadOffset + 10 });
+		busy.Add({ .action = 11, .key = kParryKey, .modifier = 42, .debounceMs = 120 });
+
+		std::uint64_t fired = 0;
+		results.push_back(SF::Bench::Run("input sink: 8-event chain, 12 bindings", ops(5'000'000), [&](std::uint64_t i) {
+			chain[6].next = i % 10 == 0 ? &chain[7] : nullptr;
+			busy.Dispatch(&chain[0], i * 16, [&](std::uint8_t a_action) { fired += a_action; });
+		}));
+		SF::Bench::DoNotOptimize(fired);
+	}
+
+	// --- Core::AvWriteQueue ---
+	{
+		std::printf("\nAvWriteQueue (per frame)\n");
+
+		// Per actor and frame: swing spend, penalty applied and undone, a blocked hit, a parry drain.
+		SF::Core::AvWriteQueue queue;
+		std::uint64_t engineWrites = 0;
+		float sink = 0.0f;
+		results.push_back(SF::Bench::Run("av queue: 20 actors x 5 writes + flush", ops(500'000), [&](std::uint64_t i) {
+			for (std::uint32_t a = 0; a < 20; ++a) {
+				const std::uint32_t id = 0x14 + a;
+				queue.Add(id, SF::Core::AvSlot::kStaminaDamage, -12.0f);
+				queue.Add(id, SF::Core::AvSlot::kAttackDamageMultTemporary, -0.5f);
+				queue.Add(id, SF::Core::AvSlot::kAttackDamageMultTemporary, 0.5f);
+				queue.Add(id, SF::Core::AvSlot::kStaminaDamage, -(static_cast<float>(i & 7)));
+				queue.Add(id, SF::Core::AvSlot::kStaminaPermanent, -20.0f);
+			}
+			engineWrites += queue.Flush([&](std::uint32_t, SF::Core::AvSlot, float a_delta) { sink += a_delta; });
+		}));
+		SF::Bench::DoNotOptimize(sink);
+
+		const auto c = queue.GetCounters();
+		std::printf("  %llu writes queued -> %llu applied\n", static_cast<unsigned long long>(c.queued),
+			static_cast<unsigned long long>(c.applied));
+	}
+
+	// --- Core::AvReadCache ---
+	{
+		std::printf("\nAvReadCache (light-attack spend, new frame every 8 spends)\n");
+
+		using SF::Core::AvRead;
+		SF::Core::AvWriteQueue queue;
+		SF::Core::AvReadCache cache{ queue };
+		Mock::Actor actor{ 0x14, 150.0f };
+		MockAvOwner owner{ actor };
+		const AvOwner* avo = &owner;
+		SF::Bench::DoNotOptimize(avo);
+
+		const auto fill = [&](SF::Core::AvReadCache::EngineValues& a_out) {
+			for (std::size_t r = 0; r < SF::Core::AvReadCache::kReads; ++r) {
+				a_out.value[r] = avo->GetActorValue(static_cast<AvRead>(r));
+			}
+			a_out.staminaDamage = actor.StaminaDamage();
+		};
+
+		float sink = 0.0f;
+		for (const bool enabled : { true, false }) {
+			cache.SetEnabled(enabled);
+			const char* name = enabled ? "av reads: spend via cache" : "av reads: spend, cache off";
+			results.push_back(SF::Bench::Run(name, ops(5'000'000), [&](std::uint64_t i) {
+				sink += cache.Get(0x14, AvRead::kStamina, fill);
+				sink += cache.Get(0x14, AvRead::kStamina, fill);
+				sink += cache.Get(0x14, AvRead::kStamina, fill);
+				cache.Write(0x14, SF::Core::AvSlot::kStaminaDamage, -1.0f);
+				sink += cache.Get(0x14, AvRead::kStamina, fill);
+				if ((i & 7) == 7) {
+					queue.Flush([&](std::uint32_t, SF::Core::AvSlot, float a_delta) { actor.ModStaminaDamage(-a_delta); });  // keep the mock topped up
+					cache.NextFrame();
+				}
+			}));
+		}
+		SF::Bench::DoNotOptimize(sink);
+
+		const auto c = cache.GetCounters();
+		std::printf("  hits=%llu fills=%llu\n", static_cast<unsigned long long>(c.hits), static_cast<unsigned long long>(c.fills));
+	}
+
+	// --- Frame::Scheduler ---
+	{
+		std::printf("\nFrame::Scheduler (main-thread coroutine sequences)\n");
+
+		Mock::World world;
+		auto& player = SpawnFighter(world, 0x14);
+		SF::Core::Clock::Fake clock;
+		SF::Core::Frame::Scheduler scheduler;
+		std::uint64_t bashes = 0;
+
+		// One new sequence per 16 ms frame; each lives ~5 frames, so ~5 are suspended at a time.
+		results.push_back(SF::Bench::Run("scheduler: start parry sequence + tick", ops(5'000'000), [&](std::uint64_t) {
+			scheduler.Start(ParrySequence(player, bashes));
+			world.RunFrame();
+			clock.Step();
+			scheduler.Tick();
+			if (player.Stamina() < 50.0f) {
+				player.SetStamina(150.0f);
+			}
+		}));
+		SF::Bench::DoNotOptimize(bashes);
+
+		const auto stats = scheduler.GetStats();
+		std::printf("  waiting=%zu pool=%zu/%zu heap=%llu\n", stats.waiting, stats.poolFree, stats.poolFrames,
+			static_cast<unsigned long long>(stats.heapFrames));
+	}
+
+	// --- Core::Latency ---
+	{
+		std::printf("\nCore::Latency (SF_LATENCY_SCOPE per hook call)\n");
+
+		for (const bool enabled : { true, false }) {
+			SF::Core::Latency::SetEnabled(enabled);
+			const char* name = enabled ? "latency: empty scope, recording" : "latency: empty scope, disabled";
+			results.push_back(SF::Bench::Run(name, ops(20'000'000), [&](std::uint64_t i) {
+				SF_LATENCY_SCOPE(kProcessHit);
+				SF::Bench::DoNotOptimize(i);
+			}));
+		}
+		SF::Core::Latency::SetEnabled(true);
+
+		const auto t0 = std::chrono::steady_clock::now();
+		const auto summaries = SF::Core::Latency::Collect();
+		const auto collectUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+		const auto& hit = summaries[static_cast<std::size_t>(SF::Core::Latency::Probe::kProcessHit)];
+		std::printf("  collect=%.0fus n=%llu p50=%.3fus p99=%.3fus p99.9=%.3fus max=%.3fus\n", collectUs,
+			static_cast<unsigned long long>(hit.count), hit.p50Us, hit.p99Us, hit.p999Us, hit.maxUs);
+	}
+
+	// --- actor state layout ---
+	{
+		std::printf("\nactor state layout (200 actors, one state access per event)\n");
+
+		constexpr std::uint32_t kActors = 200;
+		const auto actorOf = [](std::uint64_t a_i) {
+			return 0xFF000800u + static_cast<std::uint32_t>((a_i * 2654435761u) >> 7) % kActors;
+		};
+
+		Legacy::Store legacy;
+		LA::Tracker::Store arena;
+		results.push_back(SF::Bench::Run("state: map nodes, legacy layout", ops(20'000'000), [&](std::uint64_t i) {
+			LegacyEvent(legacy, actorOf(i), i * 16, static_cast<std::uint32_t>(i));
+		}));
+		results.push_back(SF::Bench::Run("state: slot arena, hot/cold split", ops(20'000'000), [&](std::uint64_t i) {
+			ArenaEvent(arena, actorOf(i), i * 16, static_cast<std::uint32_t>(i));
+		}));
+
+		// Actors leaving and coming back (unload, respawn): a node per return vs a reused slot.
+		results.push_back(SF::Bench::Run("state churn: map nodes, erase + acquire", ops(5'000'000), [&](std::uint64_t i) {
+			legacy.Erase(actorOf(i));
+			LegacyEvent(legacy, actorOf(i), i * 16, static_cast<std::uint32_t>(i));
+		}));
+		results.push_back(SF::Bench::Run("state churn: slot arena, erase + acquire", ops(5'000'000), [&](std::uint64_t i) {
+			arena.Erase(actorOf(i), [](std::uint32_t, LA::SessionState&) {});
+			ArenaEvent(arena, actorOf(i), i * 16, static_cast<std::uint32_t>(i));
+		}));
+
+		// In game the engine runs between two events of one actor and the state has left L1/L2.
+		// Stream over a buffer between events, time only the state access.
+		std::vector<std::uint64_t> engine(2u << 20 >> 3);
+		SF::Bench::CacheMisses misses;
+		const auto coldRun = [&](const char* a_name, auto&& a_event) {
+			const auto events = ops(50'000);
+			std::uint64_t sink = 0;
+			double ns = 0.0;
+			misses.Reset();
+			for (std::uint64_t i = 0; i < events; ++i) {
+				for (std::size_t w = 0; w < engine.size(); w += 8) {
+					sink += engine[w]++;
+				}
+				const auto t0 = std::chrono::steady_clock::now();
+				misses.Start();
+				a_event(i);
+				misses.Stop();
+				ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+			}
+			SF::Bench::DoNotOptimize(sink);
+			if (misses.Available()) {
+				std::printf("  %-44s %8.1f ns/event %6.2f L1D misses/event\n", a_name, ns / static_cast<double>(events),
+					static_cast<double>(misses.Read()) / static_cast<double>(events));
+			} else {
+				std::printf("  %-44s %8.1f ns/event (L1D misses: n/a, no CPU counters)\n", a_name, ns / static_cast<double>(events));
+			}
+		};
+		coldRun("cache-cold: map nodes, legacy layout", [&](std::uint64_t i) {
+			LegacyEvent(legacy, actorOf(i), i * 16, static_cast<std::uint32_t>(i));
+		});
+		coldRun("cache-cold: slot arena, hot/cold split", [&](std::uint64_t i) {
+			ArenaEvent(arena, actorOf(i), i * 16, static_cast<std::uint32_t>(i));
+		});
+
+		const auto stats = arena.GetStats();
+		std::printf("  legacy state %zu bytes/actor + node; SessionState %zu + ActorCold %zu; arena %zu actors in %zu bytes\n",
+			sizeof(Legacy::ActorState), sizeof(LA::SessionState), sizeof(LA::ActorCold), stats.entries, stats.bytes);
+	}
+
+	// --- Core::Clock ---
+	{
+		std::printf("\nCore::Clock (per timestamp an animation event takes)\n");
+
+		SF::Core::Clock::NextFrame();
+		results.push_back(SF::Bench::Run("clock: FrameMs", ops(50'000'000), [&](std::uint64_t) {
+			SF::Bench::DoNotOptimize(SF::Core::Clock::FrameMs());
+		}));
+		results.push_back(SF::Bench::Run("clock: PreciseMs", ops(20'000'000), [&](std::uint64_t) {
+			SF::Bench::DoNotOptimize(SF::Core::Clock::PreciseMs());
+		}));
+	}
+
+	if (opt.json && !SF::Bench::WriteJson(opt.json, "hotpaths", results)) {
+		return 1;
+	}
+	if (opt.baseline && !SF::Bench::CompareBaseline(opt.baseline, results)) {
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,148 @@
+// Per-actor state store under contention: N threads firing events for M actors.
+//
+//   legacy : one global mutex + unordered_map, locked/looked up 6 times per event
+//            (what AnimEventSink did for a spend event)
+//   sharded: SF::Core::ActorStateStore, one Acquire() per event
+//
+// Usage: sf_bench_statestore [events-per-thread]
+
+#include "Bench.h"
+
+#include "SF/Core/ActorStateStore.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	// Roughly the size/shape of LightAttackStaminaCost's ActorState.
+	struct State
+	{
+		std::array<std::uint32_t, 2> lastExplicitHandMs{};
+		std::array<std::uint32_t, 2> sessionStartMs{};
+		std::array<float, 2> sessionStartStamina{};
+		std::uint32_t spends{ 0 };
+		float dmgScaleDelta{ 0.0f };
+	};
+
+	// Simulated per-event work on one actor's state.
+	inline void Touch(State& a_st, std::uint32_t a_now, int a_step)
+	{
+		switch (a_step) {
+		case 0:
+			a_st.lastExplicitHandMs[a_now & 1] = a_now;
+			break;
+		case 1:
+			a_st.sessionStartMs[a_now & 1] = a_now;
+			break;
+		case 2:
+			a_st.sessionStartStamina[a_now & 1] = static_cast<float>(a_now & 0xFF);
+			break;
+		case 3:
+			a_st.dmgScaleDelta = 0.0f;
+			break;
+		case 4:
+			a_st.spends++;
+			break;
+		default:
+			a_st.dmgScaleDelta -= 0.01f;
+			break;
+		}
+	}
+
+	constexpr int kStepsPerEvent = 6;
+
+	class Legacy
+	{
+	public:
+		void Event(std::uint32_t a_id, std::uint32_t a_now)
+		{
+			for (int step = 0; step < kStepsPerEvent; ++step) {
+				std::scoped_lock _{ _lock };
+				Touch(_state[a_id], a_now, step);
+			}
+		}
+
+	private:
+		std::mutex _lock;
+		std::unordered_map<std::uint32_t, State> _state;
+	};
+
+	class Sharded
+	{
+	public:
+		void Event(std::uint32_t a_id, std::uint32_t a_now)
+		{
+			auto st = _state.Acquire(a_id);
+			for (int step = 0; step < kStepsPerEvent; ++step) {
+				Touch(*st, a_now, step);
+			}
+		}
+
+	private:
+		SF::Core::ActorStateStore<State> _state;
+	};
+
+	template <class Store>
+	double RunContended(unsigned a_threads, std::uint32_t a_actors, std::uint64_t a_eventsPerThread)
+	{
+		Store store;
+		std::atomic<bool> go{ false };
+		std::vector<std::thread> workers;
+		workers.reserve(a_threads);
+
+		for (unsigned t = 0; t < a_threads; ++t) {
+			workers.emplace_back([&, t]() {
+				while (!go.load(std::memory_order_acquire)) {
+					std::this_thread::yield();
+				}
+				std::uint32_t rng = 0x12345u + t * 7919u;
+				for (std::uint64_t i = 0; i < a_eventsPerThread; ++i) {
+					rng ^= rng << 13;
+					rng ^= rng >> 17;
+					rng ^= rng << 5;
+					// Reference FormIDs live in the FF000000 range for created refs.
+					const std::uint32_t id = 0xFF000800u + (rng % a_actors);
+					store.Event(id, static_cast<std::uint32_t>(i));
+				}
+			});
+		}
+
+		const auto t0 = std::chrono::steady_clock::now();
+		go.store(true, std::memory_order_release);
+		for (auto& w : workers) {
+			w.join();
+		}
+		const auto t1 = std::chrono::steady_clock::now();
+
+		const double totalEvents = static_cast<double>(a_eventsPerThread) * a_threads;
+		return std::chrono::duration<double, std::nano>(t1 - t0).count() / totalEvents;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const std::uint64_t eventsPerThread = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 500'000;
+
+	std::printf("ActorStateStore contention (%llu events/thread, hw threads=%u)\n",
+		static_cast<unsigned long long>(eventsPerThread), std::thread::hardware_concurrency());
+	std::printf("%8s %8s %16s %16s\n", "threads", "actors", "legacy ns/ev", "sharded ns/ev");
+
+	for (const unsigned threads : { 1u, 2u, 4u, 8u }) {
+		for (const std::uint32_t actors : { 1u, 30u, 200u }) {
+			const double legacy = RunContended<Legacy>(threads, actors, eventsPerThread);
+			const double sharded = RunContended<Sharded>(threads, actors, eventsPerThread);
+			std::printf("%8u %8u %16.2f %16.2f\n", threads, actors, legacy, sharded);
+		}
+	}
+
+	return 0;
+}
@@ -1,40 +1,53 @@
 #include "SF/Combat/DualWielding.h"
 
+#include "SF/Core/Clock.h"
+#include "SF/Core/Config.h"
+#include "SF/Core/FrameScheduler.h"
+#include "SF/Core/Latency.h"
+#include "SF/Core/Log.h"
+#include "SF/Engine/Input.h"
+#include "SF/Engine/SkyrimActor.h"
+#include "SF/Logic/Parry.h"
+
 #include <RE/Skyrim.h>
 #include <SKSE/SKSE.h>
 
 #include <atomic>
-#include <cctype>
+#include <chrono>
 #include <cstdint>
-#include <filesystem>
-#include <fstream>
-#include <string>
-
-#include <windows.h>
 
 namespace SF::Combat
 {
 	namespace
 	{
-		// ================= CONFIG =================
-		std::atomic<int> g_keyBlock{ 47 };
-		std::atomic<int> g_keyParry{ 48 };
-		static constexpr const char* kConfigRelPath = "Data/SKSE/Plugins/SunderForge.json";
+		// ================= PARRY =================
+		// Cost and the drain live in SF/Logic/Parry.h, debounce in the key binding.
+		namespace Parry = Logic::Parry;
 
-		// ================= AUTO-RELOAD =================
-		std::atomic<bool> g_configLoaded{ false };
-		std::uint64_t g_lastCheckTickMs = 0;
-		std::filesystem::file_time_type g_lastWriteTime{};
-		bool g_hasLastWriteTime = false;
+		// ================= BINDINGS =================
+		// Input sink runs on one thread; the table is rebuilt when a new config is published.
+		enum Action : std::uint8_t
+		{
+			kActionParry,
+		};
 
-		// ================= PARRY =================
-		static constexpr float kParryStaminaCost = 20.0f;
+		Engine::Input::Bindings g_bindings;
+		std::uint64_t g_boundVersion = ~0ull;  // Config version the bindings were built from; none yet
 
-		std::atomic<bool> g_pendingParryVisual{ false };
-		std::uint64_t g_pendingParryVisualUntilMs = 0;
+		static void Rebind(const Core::Config::Snapshot& a_cfg)
+		{
+			using namespace Engine::Input;
+			const auto& cfg = a_cfg.dualWielding;
 
-		// анти-дребезг/автоповтор
-		std::atomic<std::uint64_t> g_lastParryPressMs{ 0 };
+			g_bindings.Clear();
+			g_bindings.Add({ .action = kActionParry,
+				.key = static_cast<std::uint32_t>(cfg.parryKey),
+				.modifier = static_cast<std::uint32_t>(cfg.parryModifierKey),
+				.trigger = cfg.parryHoldMs ? Trigger::kHold : Trigger::kPress,
+				.holdMs = cfg.parryHoldMs,
+				.debounceMs = cfg.parryDebounceMs });
+			g_boundVersion = a_cfg.version;
+		}
 
 		// ================= HELPERS =================
 		static RE::PlayerCharacter* Player()
@@ -50,25 +63,6 @@ namespace SF::Combat
 			return false;
 		}
 
-		static bool GetGraphBool(RE::Actor* a, const char* name, bool& out)
-		{
-			if (!a) {
-				return false;
-			}
-			return a->GetGraphVariableBool(name, out);
-		}
-
-		static bool IsPowerAttacking(RE::Actor* a)
-		{
-			if (!a) {
-				return false;
-			}
-			bool v = false;
-			if (GetGraphBool(a, "IsPowerAttacking", v) && v) return true;
-			if (GetGraphBool(a, "bInPowerAttack", v) && v) return true;
-			return false;
-		}
-
 		static void InterruptAttackSoft(RE::Actor* a)
 		{
 			if (!a) {
@@ -79,60 +73,10 @@ namespace SF::Combat
 			a->NotifyAnimationGraph("AttackStop");
 		}
 
-		// ================= STAMINA =================
-		static RE::ActorValueOwner* AVO(RE::Actor* a)
-		{
-			return a ? a->As<RE::ActorValueOwner>() : nullptr;
-		}
-
-		static float GetStamina(RE::Actor* a)
-		{
-			auto* avo = AVO(a);
-			return avo ? avo->GetActorValue(RE::ActorValue::kStamina) : 0.0f;
-		}
-
-		static bool CanAfford(RE::Actor* a, float amount)
-		{
-			return GetStamina(a) + 1e-3f >= amount;
-		}
-
-		// ВАЖНО:
-		// kDamage слой легко “перетирается/нормализуется” чужими системами (типа твоего LightAttackStaminaCost),
-		// поэтому тут используем kPermanent (это реально уменьшает стамину).
-		static void DrainStaminaPermanent(RE::Actor* actor, float amount)
+		static RE::Actor* Resolve(const RE::ActorHandle& h)
 		{
-			if (!actor || amount <= 0.0f) {
-				return;
-			}
-			auto* avo = AVO(actor);
-			if (!avo) {
-				return;
-			}
-			avo->RestoreActorValue(RE::ACTOR_VALUE_MODIFIER::kPermanent, RE::ActorValue::kStamina, -amount);
-		}
-
-		static void ScheduleDrainInTwoTicks(RE::ActorHandle h, float amount)
-		{
-			auto* task = SKSE::GetTaskInterface();
-			if (!task) {
-				return;
-			}
-
-			task->AddTask([h, amount]() {
-				auto* task2 = SKSE::GetTaskInterface();
-				if (!task2) {
-					return;
-				}
-
-				task2->AddTask([h, amount]() {
-					auto ptr = h.get();
-					auto* actor = ptr ? ptr.get() : nullptr;
-					if (!actor) {
-						return;
-					}
-					DrainStaminaPermanent(actor, amount);
-				});
-			});
+			auto ptr = h.get();
+			return ptr ? ptr.get() : nullptr;
 		}
 
 		// ================= VISUAL =================
@@ -145,202 +89,46 @@ namespace SF::Combat
 			a->NotifyAnimationGraph("bashStop");
 		}
 
-		static void ProcessPendingParryVisual()
-		{
-			if (!g_pendingParryVisual.load(std::memory_order_acquire)) {
-				return;
-			}
-
-			auto* pl = Player();
-			if (!pl) {
-				g_pendingParryVisual.store(false, std::memory_order_release);
-				return;
-			}
-
-			const auto now = GetTickCount64();
-			if (now < g_pendingParryVisualUntilMs) {
-				return;
-			}
-
-			g_pendingParryVisual.store(false, std::memory_order_release);
-			ExecuteParryVisual(pl);
-		}
-
-		// ================= CONFIG IO =================
-		static std::filesystem::path GetRuntimeDir()
-		{
-			wchar_t path[MAX_PATH]{};
-			const DWORD len = GetModuleFileNameW(nullptr, path, MAX_PATH);
-			if (!len) {
-				return std::filesystem::current_path();
-			}
-			return std::filesystem::path(path).parent_path();
-		}
-
-		static std::filesystem::path GetConfigPath()
-		{
-			return GetRuntimeDir() / kConfigRelPath;
-		}
-
-		static std::string ReadAllText(const std::filesystem::path& p)
+		// ================= SEQUENCE =================
+		// Runs on the main thread (Core/FrameScheduler.h); the actor is re-resolved after every wait.
+		static Core::Frame::Task ParrySequence(RE::ActorHandle h)
 		{
-			std::ifstream ifs(p, std::ios::binary);
-			if (!ifs.is_open()) {
-				return {};
-			}
-			std::string s;
-			ifs.seekg(0, std::ios::end);
-			s.resize(static_cast<size_t>(ifs.tellg()));
-			ifs.seekg(0, std::ios::beg);
-			ifs.read(s.data(), static_cast<std::streamsize>(s.size()));
-			return s;
-		}
-
-		static bool ExtractInt(const std::string& text, const char* key, int& out)
-		{
-			const std::string needle = std::string("\"") + key + "\"";
-			auto pos = text.find(needle);
-			if (pos == std::string::npos) {
-				return false;
-			}
-			pos = text.find(':', pos);
-			if (pos == std::string::npos) {
-				return false;
-			}
-			pos++;
-			while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) {
-				pos++;
-			}
-
-			bool neg = false;
-			if (pos < text.size() && text[pos] == '-') {
-				neg = true;
-				pos++;
-			}
-
-			long long val = 0;
-			bool any = false;
-			while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') {
-				any = true;
-				val = (val * 10) + (text[pos] - '0');
-				pos++;
-			}
-
-			if (!any) {
-				return false;
-			}
-
-			out = static_cast<int>(neg ? -val : val);
-			return true;
-		}
-
-		static void LoadConfig(bool logAlways)
-		{
-			const auto p = GetConfigPath();
-			const auto text = ReadAllText(p);
-
-			if (text.empty()) {
-				if (logAlways) {
-					SKSE::log::info("DualWielding: config not found ({}), using defaults BlockKey={}, ParryKey={}",
-						p.string(), g_keyBlock.load(), g_keyParry.load());
-				}
-				g_configLoaded.store(true, std::memory_order_release);
-				return;
-			}
-
-			bool changed = false;
-			int v = 0;
-
-			if (ExtractInt(text, "BlockKey", v)) {
-				if (g_keyBlock.load() != v) {
-					g_keyBlock.store(v, std::memory_order_release);
-					changed = true;
-				}
-			}
-			if (ExtractInt(text, "BashKey", v)) {
-				if (g_keyParry.load() != v) {
-					g_keyParry.store(v, std::memory_order_release);
-					changed = true;
-				}
-			}
-
-			if (logAlways || changed) {
-				SKSE::log::info("DualWielding: loaded config {} -> BlockKey={}, ParryKey={}",
-					p.string(), g_keyBlock.load(), g_keyParry.load());
-			}
+			using namespace std::chrono_literals;
 
-			g_configLoaded.store(true, std::memory_order_release);
-		}
+			InterruptAttackSoft(Resolve(h));
 
-		static void MaybeReloadConfig()
-		{
-			const std::uint64_t now = GetTickCount64();
-			if (now - g_lastCheckTickMs < 1000) {
-				return;
-			}
-			g_lastCheckTickMs = now;
-
-			const auto p = GetConfigPath();
-
-			std::error_code ec;
-			const auto wt = std::filesystem::last_write_time(p, ec);
-			if (ec) {
-				if (!g_configLoaded.load(std::memory_order_acquire)) {
-					LoadConfig(true);
-				}
-				return;
-			}
-
-			if (!g_hasLastWriteTime) {
-				g_lastWriteTime = wt;
-				g_hasLastWriteTime = true;
-				if (!g_configLoaded.load(std::memory_order_acquire)) {
-					LoadConfig(true);
-				}
-				return;
+			// списываем гарантированно (через 2 тика) и “жёстко”
+			co_await Core::Frame::Frames(2);
+			auto* actor = Resolve(h);
+			if (!actor) {
+				co_return;
 			}
+			Engine::SkyrimActor a{ actor };
+			Parry::Drain(a);
 
-			if (wt != g_lastWriteTime) {
-				g_lastWriteTime = wt;
-				LoadConfig(true);
+			co_await Core::Frame::Delay(40ms);
+			while (IsInMenuMode()) {
+				co_await Core::Frame::NextFrame();
 			}
+			ExecuteParryVisual(Resolve(h));
 		}
 
 		// ================= INPUT =================
+		// Dispatched from InputSink, which already skipped the batch in menu mode.
 		static void OnParryPressed()
 		{
 			auto* pl = Player();
-			if (!pl || IsInMenuMode()) {
-				return;
-			}
-
-			const auto now = GetTickCount64();
-			const auto last = g_lastParryPressMs.load(std::memory_order_relaxed);
-			if (now - last < 120) {
+			if (!pl) {
 				return;
 			}
-			g_lastParryPressMs.store(now, std::memory_order_relaxed);
 
-			if (!CanAfford(pl, kParryStaminaCost)) {
+			Engine::SkyrimActor a{ pl };
+			if (Parry::OnPress(a) != Parry::Result::kParry) {
 				return;
 			}
 
-			(void)IsPowerAttacking(pl);
-
-			InterruptAttackSoft(pl);
-
-			// списываем гарантированно (через 2 тика) и “жёстко”
-			ScheduleDrainInTwoTicks(pl->GetHandle(), kParryStaminaCost);
-
-			g_pendingParryVisual.store(true, std::memory_order_release);
-			g_pendingParryVisualUntilMs = now + 40;
-		}
-
-		static void OnKeyDown(int key)
-		{
-			if (key == g_keyParry.load(std::memory_order_acquire)) {
-				OnParryPressed();
-			}
+			// Input sinks run on the main thread: the interrupt happens now, the rest on later frames.
+			Core::Frame::Scheduler::GetSingleton().Start(ParrySequence(pl->GetHandle()));
 		}
 
 		class InputSink final : public RE::BSTEventSink<RE::InputEvent*>
@@ -353,31 +141,22 @@ namespace SF::Combat
 				if (!a_events) {
 					return RE::BSEventNotifyControl::kContinue;
 				}
-
-				MaybeReloadConfig();
-
-				if (!IsInMenuMode()) {
-					ProcessPendingParryVisual();
-				}
+				SF_LATENCY_SCOPE(kDualWieldingInput);
 
 				if (IsInMenuMode()) {
+					g_bindings.ReleaseAll();
 					return RE::BSEventNotifyControl::kContinue;
 				}
 
-				for (auto e = *a_events; e; e = e->next) {
-					if (e->eventType != RE::INPUT_EVENT_TYPE::kButton) {
-						continue;
-					}
-
-					auto* b = e->AsButtonEvent();
-					if (!b) {
-						continue;
-					}
+				if (const auto& cfg = Core::Config::Get(); cfg.version != g_boundVersion) {
+					Rebind(cfg);
+				}
 
-					if (b->IsDown()) {
-						OnKeyDown(static_cast<int>(b->GetIDCode()));
+				g_bindings.Dispatch(*a_events, Core::Clock::FrameMs(), [](std::uint8_t a_action) {
+					if (a_action == kActionParry) {
+						OnParryPressed();
 					}
-				}
+				});
 
 				return RE::BSEventNotifyControl::kContinue;
 			}
@@ -392,14 +171,16 @@ namespace SF::Combat
 				return;
 			}
 
-			LoadConfig(true);
+			const auto& cfg = Core::Config::Get().dualWielding;
+			SF_LOG_INFO(kDualWielding, "DualWielding: BlockKey={}, ParryKey={} (modifier={}, holdMs={}, debounceMs={})",
+				cfg.blockKey, cfg.parryKey, cfg.parryModifierKey, cfg.parryHoldMs, cfg.parryDebounceMs);
 
 			auto* mgr = RE::BSInputDeviceManager::GetSingleton();
 			if (mgr) {
 				mgr->AddEventSink(&g_sink);
-				SKSE::log::info("DualWielding: input sink installed (parry drains stamina via kPermanent, 2 ticks delayed)");
+				SF_LOG_INFO(kDualWielding, "DualWielding: input sink installed (parry drains stamina via kPermanent 2 frames later, bash 40 ms after that)");
 			} else {
-				SKSE::log::error("DualWielding: BSInputDeviceManager not available");
+				SF_LOG_ERROR(kDualWielding, "DualWielding: BSInputDeviceManager not available");
 			}
 		}
 	}
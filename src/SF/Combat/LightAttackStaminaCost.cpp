@@ -1,520 +1,86 @@
 #include "SF/Combat/LightAttackStaminaCost.h"
 
+#include "SF/Core/AnimTag.h"
+#include "SF/Core/AvReadCache.h"
+#include "SF/Core/Clock.h"
+#include "SF/Core/FrameScheduler.h"
+#include "SF/Core/Latency.h"
+#include "SF/Core/Log.h"
+#include "SF/Engine/SkyrimActor.h"
+#include "SF/Events/AnimEventBus.h"
+#include "SF/Logic/CostMultCache.h"
+#include "SF/Logic/LightAttackTracker.h"
+
 #include <RE/Skyrim.h>
 #include <SKSE/SKSE.h>
 
-#include <algorithm>
-#include <array>
-#include <chrono>
-#include <cmath>
 #include <mutex>
+#include <optional>
 #include <string_view>
-#include <unordered_map>
 
 namespace SF::Combat
 {
 	namespace
 	{
-		// ---------------------------
-		// Tweakables (hardcoded for now)
-		// ---------------------------
-		constexpr float kBaseUnarmed = 6.0f;      // Base cost for unarmed attacks
-		constexpr float kBaseWeapon = 6.0f;       // Base cost for weapon attacks
-		constexpr float kWeaponWeightMult = 1.0f; // Additional cost per weapon weight unit
-
-		// Power attack multiplier
-		constexpr float kPowerAttackMult = 2.0f;
-
-		// How long the "damage scaled" window lasts after a low-stamina start.
-		constexpr std::uint32_t kDamagePenaltyWindowMs = 200;
-
-		// Pairing window: SoundPlay.WPNSwingUnarmed -> weaponSwing
-		constexpr std::uint32_t kUnarmedPairWindowMs = 80;
-
-		// How long we consider a "recent explicit hand tag" valid for resolving weaponSwing
-		constexpr std::uint32_t kExplicitHandWindowMs = 250;
+		namespace LA = Logic::LightAttack;
 
-		// Session timeout (failsafe if graph never produces a spend tag)
-		constexpr std::uint32_t kHandSessionTimeoutMs = 800;
+		// Cost/session tweakables live in SF/Logic/LightAttackSession.h.
 
 		// How many ticks we re-assert stamina = 0 when engine overwrites it around attack start.
 		constexpr int kForceZeroTicks = 0;
 
-		// Debug (player-only)
-		constexpr bool kDebugPlayerStart = true;
-		constexpr bool kDebugPlayerSpend = true;
-		constexpr bool kDebugPlayerSkips = true;
-
-		// Log ALL player anim tags
-		constexpr bool kDebugLogAllPlayerAnimTags = true;
+		// Player tag dump (log category "AnimTag") spam guard
 		constexpr std::uint32_t kAllTagsDebounceMs = 5;
 
-		inline std::uint32_t NowMs()
-		{
-			using namespace std::chrono;
-			return static_cast<std::uint32_t>(
-				duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
-		}
-
-		inline bool IsMeleeWeapon(const RE::TESObjectWEAP* weap)
-		{
-			if (!weap) {
-				return false;
-			}
-			const auto type = weap->GetWeaponType();
-			switch (type) {
-			case RE::WEAPON_TYPE::kHandToHandMelee:
-			case RE::WEAPON_TYPE::kOneHandSword:
-			case RE::WEAPON_TYPE::kOneHandDagger:
-			case RE::WEAPON_TYPE::kOneHandAxe:
-			case RE::WEAPON_TYPE::kOneHandMace:
-			case RE::WEAPON_TYPE::kTwoHandSword:
-			case RE::WEAPON_TYPE::kTwoHandAxe:
-				return true;
-			default:
-				return false;
-			}
-		}
-
-		inline bool IsTwoHanded(const RE::TESObjectWEAP* weap)
-		{
-			if (!weap) {
-				return false;
-			}
-			const auto type = weap->GetWeaponType();
-			return type == RE::WEAPON_TYPE::kTwoHandSword || type == RE::WEAPON_TYPE::kTwoHandAxe;
-		}
-
-		inline bool IsUnarmed(const RE::TESObjectWEAP* weap)
-		{
-			return (!weap) || (weap->GetWeaponType() == RE::WEAPON_TYPE::kHandToHandMelee);
-		}
-
-		inline float GetWeaponWeight(const RE::TESObjectWEAP* weap)
-		{
-			return weap ? std::max(0.0f, weap->GetWeight()) : 0.0f;
-		}
-
-		inline RE::TESObjectWEAP* GetUnarmedWeapForm()
-		{
-			// Skyrim.esm "Unarmed" weapon
-			return RE::TESForm::LookupByID<RE::TESObjectWEAP>(0x000001F4);
-		}
-
-		// Convert "Mod Power Attack Stamina" entry point into a multiplier.
-		// IMPORTANT for this mod:
-		// - We use it as a *global stamina cost multiplier* (applies to both light & power)
-		// - Must NEVER zero-out cost (probe<=0 -> treat as 1.0)
-		inline float GetStaminaCostMult(RE::Actor* actor, const RE::TESObjectWEAP* weapOrNull)
-		{
-			if (!actor) {
-				return 1.0f;
-			}
-
-			// IMPORTANT: for unarmed we pass actual "Unarmed" WEAP form
-			RE::TESObjectWEAP* weap = const_cast<RE::TESObjectWEAP*>(weapOrNull);
-			if (!weap) {
-				weap = GetUnarmedWeapForm();
-			}
-
-			float probe = 100.0f;
-			RE::BGSEntryPoint::HandleEntryPoint(
-				RE::BGSEntryPoint::ENTRY_POINT::kModPowerAttackStamina,
-				actor,
-				weap,
-				&probe);
-
-			if (probe <= 0.0f) {
-				return 1.0f;
-			}
-
-			const float mult = probe / 100.0f;
-			return std::clamp(mult, 0.05f, 10.0f);
-		}
-
-		// True power-attack detection (NPC-safe)
-		inline bool IsPowerAttacking(RE::Actor* a_actor)
+		// Per-swing diagnostics are player-only and logged at debug level in category "LightAttack".
+		// The category check comes first, so NPC events pay one relaxed load when it's off.
+		inline bool PlayerDebugLog(RE::Actor* actor)
 		{
-			if (!a_actor) {
-				return false;
-			}
-
-			auto currentProcess = a_actor->GetActorRuntimeData().currentProcess;
-			if (!currentProcess) {
-				return false;
-			}
-			auto highProcess = currentProcess->high;
-			if (!highProcess) {
-				return false;
-			}
-			auto attackData = highProcess->attackData;
-			if (!attackData) {
-				return false;
-			}
-
-			auto flags = attackData->data.flags;
-			return flags.any(RE::AttackData::AttackFlag::kPowerAttack) &&
-			       !flags.any(RE::AttackData::AttackFlag::kBashAttack);
-		}
-
-		inline float GetStamina(RE::Actor* actor)
-		{
-			auto* avo = actor ? actor->As<RE::ActorValueOwner>() : nullptr;
-			if (!avo) {
-				return 0.0f;
-			}
-			return std::max(0.0f, avo->GetActorValue(RE::ActorValue::kStamina));
-		}
-
-		// Adjust CURRENT stamina via DAMAGE layer only (does NOT touch base/max).
-		// NOTE: For kDamage:
-		//   negative -> decreases current stamina
-		//   positive -> increases current stamina (undoes damage)
-		inline void AdjustStaminaDamageLayer(RE::Actor* actor, float delta)
-		{
-			if (!actor || std::abs(delta) <= 1e-6f) {
-				return;
-			}
-			auto* avo = actor->As<RE::ActorValueOwner>();
-			if (!avo) {
-				return;
-			}
-			avo->RestoreActorValue(RE::ACTOR_VALUE_MODIFIER::kDamage, RE::ActorValue::kStamina, delta);
-		}
-
-		inline void DrainStaminaDamageLayer(RE::Actor* actor, float amount)
-		{
-			if (!actor || amount <= 0.0f) {
-				return;
-			}
-			AdjustStaminaDamageLayer(actor, -amount);
+			return SF_LOG_ENABLED(kLightAttack, spdlog::level::debug) && actor && actor->IsPlayerRef();
 		}
 
 		inline void DrainToZeroNow(RE::Actor* actor)
 		{
-			if (!actor) {
-				return;
-			}
-			const float cur = GetStamina(actor);
+			Engine::SkyrimActor a{ actor };
+			const float cur = a.Stamina();
 			if (cur <= 0.0f) {
 				return;
 			}
 			// drain a bit more to hard-clamp
-			DrainStaminaDamageLayer(actor, cur + 1.0f);
+			a.ModStaminaDamage(-(cur + 1.0f));
 		}
 
-		inline void ForceZeroTicks(RE::ActorHandle h, int ticksLeft)
+		// Posted from an animation thread; runs on the main thread, one drain per frame.
+		Core::Frame::Task ForceZeroTicks(RE::ActorHandle h, int ticks)
 		{
-			if (ticksLeft <= 0) {
-				return;
-			}
-
-			auto* task = SKSE::GetTaskInterface();
-			if (!task) {
-				return;
-			}
+			for (int i = 0; i < ticks; ++i) {
+				if (i > 0) {
+					co_await Core::Frame::NextFrame();
+				}
 
-			task->AddTask([h, ticksLeft]() {
 				auto ptr = h.get();
 				auto* actor = ptr ? ptr.get() : nullptr;
 				if (!actor) {
-					return;
+					co_return;
 				}
 
-				if (GetStamina(actor) > 0.0f) {
-					DrainToZeroNow(actor);
-				}
-
-				ForceZeroTicks(h, ticksLeft - 1);
-			});
-		}
-
-		// --------- TAGS ---------
-		inline bool IsWeaponHandSwingTag(std::string_view t)
-		{
-			return (t == "weaponLeftSwing") || (t == "weaponRightSwing") ||
-			       (t == "WeaponLeftSwing") || (t == "WeaponRightSwing");
-		}
-
-		inline bool IsWeaponSwingAmbiguous(std::string_view t)
-		{
-			return (t == "weaponSwing") || (t == "WeaponSwing");
-		}
-
-		inline bool IsUnarmedSwingSoundTag(std::string_view t)
-		{
-			return (t == "SoundPlay.WPNSwingUnarmed");
-		}
-
-		inline bool IsAttackStartTag(std::string_view t)
-		{
-			return (t == "attackStart") || (t == "attackStartLeft") || (t == "attackStartRight") ||
-			       (t == "AttackStart") || (t == "AttackStartLeft") || (t == "AttackStartRight");
-		}
-
-		// Spend only on REAL swing tags to avoid x2/x3.
-		inline bool IsSpendTag(std::string_view t)
-		{
-			return IsWeaponHandSwingTag(t) || IsWeaponSwingAmbiguous(t);
-		}
-
-		inline bool TagHasLeft(const std::string_view tagView)
-		{
-			return (tagView.find("Left") != std::string_view::npos) || (tagView.find("left") != std::string_view::npos);
-		}
-
-		inline bool TagHasRight(const std::string_view tagView)
-		{
-			return (tagView.find("Right") != std::string_view::npos) || (tagView.find("right") != std::string_view::npos);
-		}
-
-		// We implement scaling by temporarily adjusting AttackDamageMult.
-		struct ActorState
-		{
-			// 0 = left, 1 = right
-			std::array<std::uint32_t, 2> lastExplicitHandMs{ 0u, 0u };
-
-			struct HandSession
-			{
-				bool active{ false };
-				bool spent{ false };
-				std::uint32_t startMs{ 0 };
-
-				// IMPORTANT: snapshot stamina at attack start.
-				// We'll enforce final stamina at spend time to cancel any vanilla drain (esp. power attacks).
-				float startStamina{ 0.0f };
-
-				// For debugging: what weapon we thought it was at start (optional)
-				std::uint32_t startWeapFormID{ 0u };
-				bool startWasTwoHanded{ false };
-			};
-
-			// sessions are indexed by "logical hand": for 2H we map both hands to the same index at runtime.
-			std::array<HandSession, 2> session{};
-
-			bool dmgScaleApplied{ false };
-			std::uint32_t dmgScaleUntilMs{ 0 };
-			float dmgScaleDelta{ 0.0f };
-
-			// all-tags spam guard (player only)
-			std::uint32_t lastAllTagLogMs{ 0 };
-			RE::BSFixedString lastAllTag{};
-
-			// weaponSwing decoding: remember recent unarmed swing sound
-			std::uint32_t lastUnarmedSoundMs{ 0 };
-			bool lastUnarmedHandIsLeft{ false };
-			bool lastUnarmedHandValid{ false };
-		};
-
-		inline void ClearDamageScale(RE::Actor* a, ActorState& st)
-		{
-			if (!st.dmgScaleApplied) {
-				return;
-			}
-
-			auto* avo = a ? a->As<RE::ActorValueOwner>() : nullptr;
-			if (avo && std::abs(st.dmgScaleDelta) > 1e-6f) {
-				avo->RestoreActorValue(RE::ACTOR_VALUE_MODIFIER::kTemporary,
-					RE::ActorValue::kAttackDamageMult,
-					-st.dmgScaleDelta);
+				DrainToZeroNow(actor);
 			}
-
-			st.dmgScaleApplied = false;
-			st.dmgScaleUntilMs = 0;
-			st.dmgScaleDelta = 0.0f;
 		}
 
-		inline void ClearDamageScaleIfExpired(RE::Actor* a, ActorState& st, std::uint32_t nowMs)
+		// All-tags dump is player-only, so its spam guard is a single slot rather than per-actor state.
+		class PlayerTagDump
 		{
-			if (st.dmgScaleApplied && nowMs > st.dmgScaleUntilMs) {
-				ClearDamageScale(a, st);
-			}
-		}
-
-		inline void ApplyDamageScale(RE::Actor* a, ActorState& st, float scale01, std::uint32_t untilMs)
-		{
-			if (!a) {
-				return;
-			}
-
-			auto* avo = a->As<RE::ActorValueOwner>();
-			if (!avo) {
-				return;
-			}
-
-			scale01 = std::clamp(scale01, 0.0f, 1.0f);
-
-			if (st.dmgScaleApplied) {
-				ClearDamageScale(a, st);
-			}
-
-			const float cur = avo->GetActorValue(RE::ActorValue::kAttackDamageMult);
-			const float target = cur * scale01;
-			const float delta = target - cur;
-
-			if (std::abs(delta) > 1e-6f) {
-				avo->RestoreActorValue(RE::ACTOR_VALUE_MODIFIER::kTemporary,
-					RE::ActorValue::kAttackDamageMult,
-					delta);
-				st.dmgScaleApplied = true;
-				st.dmgScaleUntilMs = untilMs;
-				st.dmgScaleDelta = delta;
-			}
-		}
-
-		inline void LogAllPlayerTagsIfEnabled(RE::Actor* actor, const std::string_view tagView, ActorState& st, std::uint32_t nowMs)
-		{
-			if (!kDebugLogAllPlayerAnimTags) {
-				return;
-			}
-			if (!actor || !actor->IsPlayerRef()) {
-				return;
-			}
-
-			if (st.lastAllTag == RE::BSFixedString(tagView.data()) && (nowMs - st.lastAllTagLogMs) <= kAllTagsDebounceMs) {
-				return;
-			}
-
-			auto* objL = actor->GetEquippedObject(true);
-			auto* objR = actor->GetEquippedObject(false);
-
-			auto* weapL = objL ? objL->As<RE::TESObjectWEAP>() : nullptr;
-			auto* weapR = objR ? objR->As<RE::TESObjectWEAP>() : nullptr;
-
-			const auto idL = weapL ? weapL->GetFormID() : 0u;
-			const auto idR = weapR ? weapR->GetFormID() : 0u;
-
-			const char* nameL = weapL ? weapL->GetName() : "Unarmed/None";
-			const char* nameR = weapR ? weapR->GetName() : "Unarmed/None";
-
-			SKSE::log::info(
-				"[AnimTag][Player] tag='{}'  L={:08X} '{}'  R={:08X} '{}'",
-				tagView,
-				idL,
-				nameL ? nameL : "(null)",
-				idR,
-				nameR ? nameR : "(null)");
-
-			st.lastAllTagLogMs = nowMs;
-			st.lastAllTag = RE::BSFixedString(tagView.data());
-		}
-
-		inline void NoteExplicitHandIfAny(std::string_view tagView, ActorState& st, std::uint32_t nowMs)
-		{
-			if (TagHasLeft(tagView) || tagView == "weaponLeftSwing" || tagView == "WeaponLeftSwing") {
-				st.lastExplicitHandMs[0] = nowMs;
-			} else if (TagHasRight(tagView) || tagView == "weaponRightSwing" || tagView == "WeaponRightSwing") {
-				st.lastExplicitHandMs[1] = nowMs;
-			}
-		}
-
-		// For 2H weapons, both hands must share the same session index to prevent double spend.
-		inline std::size_t MapHandToSessionIndex(const RE::TESObjectWEAP* weap, std::size_t resolvedHandIdx)
-		{
-			if (weap && IsTwoHanded(weap)) {
-				return 1u;  // stable single slot for 2H
-			}
-			return resolvedHandIdx;
-		}
-
-		inline void BeginOrRefreshSession(ActorState& st, std::size_t sessionIdx, std::uint32_t nowMs, float startStamina, const RE::TESObjectWEAP* startWeap)
-		{
-			auto& s = st.session[sessionIdx];
-
-			// If an active unspent session is still fresh, keep it (don't overwrite the snapshot).
-			if (s.active && !s.spent && (nowMs - s.startMs) <= kHandSessionTimeoutMs) {
-				return;
-			}
-
-			s.active = true;
-			s.spent = false;
-			s.startMs = nowMs;
-			s.startStamina = std::max(0.0f, startStamina);
-			s.startWeapFormID = startWeap ? startWeap->GetFormID() : 0u;
-			s.startWasTwoHanded = startWeap ? IsTwoHanded(startWeap) : false;
-		}
-
-		inline bool CanSpendInSession(ActorState& st, std::size_t sessionIdx, std::uint32_t nowMs, float curStamina, const RE::TESObjectWEAP* curWeap)
-		{
-			auto& s = st.session[sessionIdx];
-
-			if (!s.active) {
-				// Some graphs may not emit attackStart; allow implicit session.
-				s.active = true;
-				s.spent = false;
-				s.startMs = nowMs;
-				s.startStamina = std::max(0.0f, curStamina);
-				s.startWeapFormID = curWeap ? curWeap->GetFormID() : 0u;
-				s.startWasTwoHanded = curWeap ? IsTwoHanded(curWeap) : false;
-				return true;
-			}
-
-			if (nowMs - s.startMs > kHandSessionTimeoutMs) {
-				// stale session -> restart snapshot
-				s.active = true;
-				s.spent = false;
-				s.startMs = nowMs;
-				s.startStamina = std::max(0.0f, curStamina);
-				s.startWeapFormID = curWeap ? curWeap->GetFormID() : 0u;
-				s.startWasTwoHanded = curWeap ? IsTwoHanded(curWeap) : false;
-				return true;
-			}
-
-			return !s.spent;
-		}
-
-		inline void MarkSessionSpent(ActorState& st, std::size_t sessionIdx)
-		{
-			auto& s = st.session[sessionIdx];
-			s.spent = true;
-			s.active = false;
-		}
-
-		inline float GetSessionStartStamina(const ActorState& st, std::size_t sessionIdx)
-		{
-			return std::max(0.0f, st.session[sessionIdx].startStamina);
-		}
-
-		// Resolve hand & unarmed hint for this event.
-		// Priority:
-		// 1) explicit Left/Right in tag
-		// 2) weaponLeftSwing/weaponRightSwing
-		// 3) SoundPlay.WPNSwingUnarmed sets pairing state + guesses unarmed hand
-		// 4) weaponSwing:
-		//    4a) if paired with unarmed sound => unarmed with stored hand
-		//    4b) else choose most recent explicit hand within window
-		//    4c) else stable default RIGHT (prevents "left weapon makes right punch expensive")
-		inline bool ResolveHandForTag(RE::Actor* actor, std::string_view tagView, ActorState& st, std::uint32_t nowMs, bool& outAmbiguous, bool& outTreatAsUnarmed)
-		{
-			outAmbiguous = false;
-			outTreatAsUnarmed = false;
-
-			// 1) explicit substrings
-			if (TagHasLeft(tagView)) {
-				return true;
-			}
-			if (TagHasRight(tagView)) {
-				return false;
-			}
-
-			// 2) explicit swing tags
-			if (tagView == "weaponLeftSwing" || tagView == "WeaponLeftSwing") {
-				return true;
-			}
-			if (tagView == "weaponRightSwing" || tagView == "WeaponRightSwing") {
-				return false;
-			}
-
-			// 3) unarmed sound tag sets pairing info
-			if (IsUnarmedSwingSoundTag(tagView)) {
-				outAmbiguous = true;
-				outTreatAsUnarmed = true;
-
-				st.lastUnarmedSoundMs = nowMs;
-
-				if (!actor) {
-					st.lastUnarmedHandValid = false;
-					return false;
+		public:
+			void Log(RE::Actor* actor, const std::string_view tagView, Core::Clock::Ms nowMs)
+			{
+				{
+					std::scoped_lock _{ _lock };
+					if (_lastTag == RE::BSFixedString(tagView.data()) && (nowMs - _lastLogMs) <= kAllTagsDebounceMs) {
+						return;
+					}
+					_lastLogMs = nowMs;
+					_lastTag = RE::BSFixedString(tagView.data());
 				}
 
 				auto* objL = actor->GetEquippedObject(true);
@@ -523,372 +89,199 @@ namespace SF::Combat
 				auto* weapL = objL ? objL->As<RE::TESObjectWEAP>() : nullptr;
 				auto* weapR = objR ? objR->As<RE::TESObjectWEAP>() : nullptr;
 
-				const bool leftHasWeapon = weapL && IsMeleeWeapon(weapL) && !IsUnarmed(weapL);
-				const bool rightHasWeapon = weapR && IsMeleeWeapon(weapR) && !IsUnarmed(weapR);
+				const auto idL = weapL ? weapL->GetFormID() : 0u;
+				const auto idR = weapR ? weapR->GetFormID() : 0u;
 
-				// If one side has weapon and other doesn't -> unarmed is empty side
-				if (leftHasWeapon && !rightHasWeapon) {
-					st.lastUnarmedHandIsLeft = false;  // right is unarmed
-					st.lastUnarmedHandValid = true;
-					return false;
-				}
-				if (rightHasWeapon && !leftHasWeapon) {
-					st.lastUnarmedHandIsLeft = true;   // left is unarmed
-					st.lastUnarmedHandValid = true;
-					return true;
-				}
+				const char* nameL = weapL ? weapL->GetName() : "Unarmed/None";
+				const char* nameR = weapR ? weapR->GetName() : "Unarmed/None";
 
-				// fallback: use last explicit hand
-				const auto dtL = nowMs - st.lastExplicitHandMs[0];
-				const auto dtR = nowMs - st.lastExplicitHandMs[1];
-				if (dtL <= kExplicitHandWindowMs || dtR <= kExplicitHandWindowMs) {
-					const bool useLeft = (dtL <= dtR);
-					st.lastUnarmedHandIsLeft = useLeft;
-					st.lastUnarmedHandValid = true;
-					return useLeft;
-				}
-
-				st.lastUnarmedHandIsLeft = false;  // default right
-				st.lastUnarmedHandValid = true;
-				return false;
+				SF_LOG_INFO(kAnimTag,
+					"[AnimTag][Player] tag='{}'  L={:08X} '{}'  R={:08X} '{}'",
+					tagView,
+					idL,
+					nameL ? nameL : "(null)",
+					idR,
+					nameR ? nameR : "(null)");
 			}
 
-			// 4) weaponSwing ambiguous
-			if (IsWeaponSwingAmbiguous(tagView)) {
-				outAmbiguous = true;
+		private:
+			std::mutex _lock;
+			Core::Clock::Ms _lastLogMs{ 0 };
+			RE::BSFixedString _lastTag{};
+		};
 
-				// 4a) paired unarmed
-				if (st.lastUnarmedHandValid && (nowMs - st.lastUnarmedSoundMs) <= kUnarmedPairWindowMs) {
-					outTreatAsUnarmed = true;
-					return st.lastUnarmedHandIsLeft;
-				}
+		inline std::string_view SkipReasonText(LA::SkipReason a_reason)
+		{
+			switch (a_reason) {
+			case LA::SkipReason::kDuplicate:
+				return "duplicate spend in session";
+			case LA::SkipReason::kNotMelee:
+				return "Not melee weapon.";
+			case LA::SkipReason::kZeroBaseCost:
+				return "baseCost<=0";
+			case LA::SkipReason::kZeroFinalCost:
+				return "finalCost<=0";
+			default:
+				return "?";
+			}
+		}
 
-				// 4b) most recent explicit hand
-				const auto dtL = nowMs - st.lastExplicitHandMs[0];
-				const auto dtR = nowMs - st.lastExplicitHandMs[1];
-				if (dtL <= kExplicitHandWindowMs || dtR <= kExplicitHandWindowMs) {
-					return (dtL <= dtR);
+		inline void LogOutcome(Engine::SkyrimActor& actor, const std::string_view tagView, const LA::Outcome& out)
+		{
+			const char* hand = out.left ? "L" : "R";
+			const char* session = out.session == 0 ? "L" : "R";
+
+			switch (out.action) {
+			case LA::Action::kPairingHint:
+				SF_LOG_DEBUG(kLightAttack, "[LightAttackStaminaCost][UnarmedSound] tag={} hand={} (pairing only)", tagView, hand);
+				break;
+			case LA::Action::kStart:
+				SF_LOG_DEBUG(kLightAttack, "[LightAttackStaminaCost][Start] tag={} hand={} session={} twoH={} ambiguous={} unarmedHint={} snapStam={}",
+					tagView, hand, session, out.twoHanded, out.ambiguous, out.treatAsUnarmed, out.staminaBefore);
+				break;
+			case LA::Action::kSkip:
+				SF_LOG_DEBUG(kLightAttack, "[LightAttackStaminaCost][Skip] {} tag={} hand={} session={} baseCost={} entryMult={} power={}",
+					SkipReasonText(out.reason), tagView, hand, session, out.baseCost, out.entryMult, out.power);
+				break;
+			case LA::Action::kSpend:
+				{
+					auto* weap = out.treatAsUnarmed ? nullptr : actor.Form(out.left);
+					const auto* name = weap ? weap->GetName() : "Unarmed";
+
+					SF_LOG_DEBUG(kLightAttack,
+						"[LightAttackStaminaCost][Spend] tag={} power={} hand={} session={} twoH={} ambiguous={} treatAsUnarmed={} weap='{}' baseCost={} entryMult={} finalCost={} startStam={} curStamBefore={} desired={} paid={} ratio={} insuff={} stamAfter={}",
+						tagView,
+						out.power,
+						hand,
+						session,
+						out.twoHanded,
+						out.ambiguous,
+						out.treatAsUnarmed,
+						name ? name : "(null)",
+						out.baseCost,
+						out.entryMult,
+						out.finalCost,
+						out.startStamina,
+						out.staminaBefore,
+						out.staminaAfter,
+						out.paid,
+						out.ratio,
+						out.insufficient,
+						actor.Stamina());
 				}
-
-				// 4c) stable default RIGHT
-				return false;
+				break;
+			default:
+				break;
 			}
-
-			// stable default RIGHT
-			outAmbiguous = true;
-			return false;
 		}
 
-		class AnimEventSink final : public RE::BSTEventSink<RE::BSAnimationGraphEvent>
+		// Fed by Events::AnimEventBus: stamina tags of the player and of actors in combat (every tag
+		// while a damage penalty may be waiting to expire), plus every player tag while the AnimTag
+		// dump is on.
+		class AnimEventHandler
 		{
 		public:
-			static AnimEventSink* GetSingleton()
+			static AnimEventHandler* GetSingleton()
 			{
-				static AnimEventSink instance;
+				static AnimEventHandler instance;
 				return std::addressof(instance);
 			}
 
-			RE::BSEventNotifyControl ProcessEvent(
-				const RE::BSAnimationGraphEvent* a_event,
-				RE::BSTEventSource<RE::BSAnimationGraphEvent>*) override
-			{
-				if (!a_event || a_event->tag.empty()) {
-					return RE::BSEventNotifyControl::kContinue;
-				}
-
-				const auto& tag = a_event->tag;
-				const std::string_view tagView{ tag.c_str() ? tag.c_str() : "" };
-
-				auto* holder = a_event->holder;
-				auto* actor = holder ? const_cast<RE::Actor*>(holder->As<RE::Actor>()) : nullptr;
-				if (!actor) {
-					return RE::BSEventNotifyControl::kContinue;
-				}
-
-				const auto nowMs = NowMs();
-				const auto id = actor->GetFormID();
-
-				{
-					std::scoped_lock _{ _lock };
-					auto& st = _state[id];
-					LogAllPlayerTagsIfEnabled(actor, tagView, st, nowMs);
-					NoteExplicitHandIfAny(tagView, st, nowMs);
-					ClearDamageScaleIfExpired(actor, st, nowMs);
-				}
-
-				// Pairing tag only
-				if (IsUnarmedSwingSoundTag(tagView)) {
-					std::scoped_lock _{ _lock };
-					auto& st = _state[id];
-					bool amb = false;
-					bool un = false;
-					(void)ResolveHandForTag(actor, tagView, st, nowMs, amb, un);
-					if constexpr (kDebugPlayerStart) {
-						if (actor->IsPlayerRef()) {
-							SKSE::log::info("[LightAttackStaminaCost][UnarmedSound] tag={} hand={} (pairing only)",
-								tagView, st.lastUnarmedHandValid ? (st.lastUnarmedHandIsLeft ? "L" : "R") : "?");
-						}
-					}
-					return RE::BSEventNotifyControl::kContinue;
-				}
-
-				const bool isStart = IsAttackStartTag(tagView);
-				const bool isSpend = IsSpendTag(tagView);
-
-				if (!isStart && !isSpend) {
-					return RE::BSEventNotifyControl::kContinue;
-				}
-
-				bool ambiguous = false;
-				bool treatAsUnarmed = false;
-				bool leftHand = false;
-				std::size_t resolvedHandIdx = 1;
-
-				// We'll also decide current weapon for session mapping.
-				RE::TESObjectWEAP* curWeapForSession = nullptr;
-
-				{
-					std::scoped_lock _{ _lock };
-					auto& st = _state[id];
-
-					leftHand = ResolveHandForTag(actor, tagView, st, nowMs, ambiguous, treatAsUnarmed);
-					resolvedHandIdx = leftHand ? 0u : 1u;
-				}
-
-				// Determine weapon for this hand (needed for 2H session mapping and snapshot).
-				{
-					auto* obj = actor->GetEquippedObject(leftHand);
-					auto* weap = obj ? obj->As<RE::TESObjectWEAP>() : nullptr;
-
-					// If decoded as unarmed -> force nullptr
-					if (treatAsUnarmed) {
-						weap = nullptr;
-					}
-
-					// If not melee, we keep nullptr for session mapping too (but we'll skip spend later).
-					if (weap && !IsMeleeWeapon(weap)) {
-						weap = nullptr;
-					}
+			[[nodiscard]] bool PenaltyPending() const noexcept { return _tracker.ActiveDamageScales() != 0; }
 
-					curWeapForSession = weap;
-				}
-
-				// Map to logical session index (2H => single slot)
-				const std::size_t sessionIdx = MapHandToSessionIndex(curWeapForSession, resolvedHandIdx);
-
-				if (isStart) {
-					const float snapStam = GetStamina(actor);
-
-					{
-						std::scoped_lock _{ _lock };
-						auto& st = _state[id];
-						BeginOrRefreshSession(st, sessionIdx, nowMs, snapStam, curWeapForSession);
-					}
+			[[nodiscard]] std::optional<LA::ActorState> Peek(RE::FormID a_id) { return _tracker.Peek(a_id); }
+			[[nodiscard]] LA::Tracker::Store::Stats Stats() { return _tracker.GetStats(); }
 
-					if constexpr (kDebugPlayerStart) {
-						if (actor->IsPlayerRef()) {
-							const bool twoH = curWeapForSession ? IsTwoHanded(curWeapForSession) : false;
-							SKSE::log::info("[LightAttackStaminaCost][Start] tag={} hand={} session={} twoH={} ambiguous={} unarmedHint={} snapStam={}",
-								tagView,
-								leftHand ? "L" : "R",
-								(sessionIdx == 0 ? "L" : "R"),
-								twoH,
-								ambiguous,
-								treatAsUnarmed,
-								snapStam);
-						}
-					}
-					return RE::BSEventNotifyControl::kContinue;
-				}
-
-				// Spend
-				{
-					std::scoped_lock _{ _lock };
-					auto& st = _state[id];
-
-					const float curStam = GetStamina(actor);
-					if (!CanSpendInSession(st, sessionIdx, nowMs, curStam, curWeapForSession)) {
-						if constexpr (kDebugPlayerSkips) {
-							if (actor->IsPlayerRef()) {
-								SKSE::log::info("[LightAttackStaminaCost][Skip] duplicate spend in session tag={} hand={} session={}",
-									tagView, leftHand ? "L" : "R", (sessionIdx == 0 ? "L" : "R"));
-							}
-						}
-						return RE::BSEventNotifyControl::kContinue;
-					}
+			void OnEvent(const Events::AnimEventBus::Event& a_event)
+			{
+				SF_LATENCY_SCOPE(kLightAttackAnim);
 
-					// Each new spend defines its own scaling; clear previous immediately.
-					ClearDamageScale(actor, st);
+				if (!_tracker.WantsEvent(a_event.info)) {
+					return;
 				}
 
-				// Determine hand/weapon for actual cost calc
-				auto* obj = actor->GetEquippedObject(leftHand);
-				auto* weap = obj ? obj->As<RE::TESObjectWEAP>() : nullptr;
+				// Hand/session/cost decision and its effects (SF/Logic/LightAttackTracker.h).
+				auto* actor = a_event.actor;
 
-				if (treatAsUnarmed) {
-					weap = nullptr;
+				// Session snapshot and spend delta need this frame's engine stamina, not the cached
+				// one (see Core::AvReadCache::NextFrame).
+				if (a_event.info.Any(Core::AnimTag::kFlagStart | Core::AnimTag::kFlagSpend)) {
+					Core::AvReadCache::GetSingleton().Invalidate(actor->GetFormID());
 				}
 
-				if (weap && !IsMeleeWeapon(weap)) {
-					if constexpr (kDebugPlayerSkips) {
-						if (actor->IsPlayerRef()) {
-							SKSE::log::info("[LightAttackStaminaCost][Skip] Not melee weapon. tag={} hand={}", tagView, leftHand ? "L" : "R");
-						}
-					}
-					{
-						std::scoped_lock _{ _lock };
-						auto& st = _state[id];
-						MarkSessionSpent(st, sessionIdx);
-					}
-					return RE::BSEventNotifyControl::kContinue;
+				Engine::SkyrimActor a{ actor };
+				const auto out = _tracker.OnEvent(a, a_event.info, Core::Clock::FrameMs());
+				if (out.action == LA::Action::kNone) {
+					return;
 				}
 
-				const bool unarmed = IsUnarmed(weap);
-
-				float baseCost = unarmed ? kBaseUnarmed : (kBaseWeapon + (GetWeaponWeight(weap) * kWeaponWeightMult));
-				baseCost = std::max(0.0f, baseCost);
-
-				if (baseCost <= 0.0f) {
-					if constexpr (kDebugPlayerSkips) {
-						if (actor->IsPlayerRef()) {
-							SKSE::log::info("[LightAttackStaminaCost][Skip] baseCost<=0 tag={} hand={}", tagView, leftHand ? "L" : "R");
-						}
-					}
-					{
-						std::scoped_lock _{ _lock };
-						auto& st = _state[id];
-						MarkSessionSpent(st, sessionIdx);
-					}
-					return RE::BSEventNotifyControl::kContinue;
+				if (kForceZeroTicks > 0 && out.insufficient) {
+					Core::Frame::Scheduler::GetSingleton().Post(ForceZeroTicks(actor->GetHandle(), kForceZeroTicks));
 				}
 
-				const bool isPower = IsPowerAttacking(actor);
-
-				// multiplier applies to BOTH light and power
-				const float entryMult = GetStaminaCostMult(actor, weap);
-
-				float finalCost = baseCost * entryMult;
-				if (isPower) {
-					finalCost *= kPowerAttackMult;
-				}
-				finalCost = std::max(0.0f, finalCost);
-
-				if (finalCost <= 0.0f) {
-					if constexpr (kDebugPlayerSkips) {
-						if (actor->IsPlayerRef()) {
-							SKSE::log::info("[LightAttackStaminaCost][Skip] finalCost<=0 tag={} hand={} baseCost={} entryMult={} power={}",
-								tagView, leftHand ? "L" : "R", baseCost, entryMult, isPower);
-						}
-					}
-					{
-						std::scoped_lock _{ _lock };
-						auto& st = _state[id];
-						MarkSessionSpent(st, sessionIdx);
-					}
-					return RE::BSEventNotifyControl::kContinue;
+				if (PlayerDebugLog(actor)) {
+					LogOutcome(a, a_event.tag, out);
 				}
+			}
 
-				// IMPORTANT FIX:
-				// We do NOT "drain additionally" from current stamina (which can include vanilla power-drain already).
-				// Instead we enforce the final stamina based on snapshot at attack start:
-				//   desired = startStamina - finalCost
-				// This cancels any extra vanilla drain and prevents >x2 for 2H power attacks.
-				const float staminaNow = GetStamina(actor);
-
-				float startStam = 0.0f;
-				{
-					std::scoped_lock _{ _lock };
-					startStam = GetSessionStartStamina(_state[id], sessionIdx);
-				}
-
-				const float paid = std::min(startStam, finalCost);
-				const float ratio = (finalCost > 1e-6f) ? std::clamp(paid / finalCost, 0.0f, 1.0f) : 0.0f;
-
-				const float desired = std::max(0.0f, startStam - finalCost);
-
-				// Adjust current stamina to desired (may restore if vanilla already drained).
-				AdjustStaminaDamageLayer(actor, desired - staminaNow);
-
-				const float staminaAfter = GetStamina(actor);
+			void OnPlayerTag(const Events::AnimEventBus::Event& a_event)
+			{
+				_tagDump.Log(a_event.actor, a_event.tag, Core::Clock::FrameMs());
+			}
 
-				{
-					std::scoped_lock _{ _lock };
-					auto& st = _state[id];
-					MarkSessionSpent(st, sessionIdx);
-				}
+			// Drop one actor's state (unload/death). Undoes a pending AttackDamageMult penalty.
+			void Evict(RE::FormID a_id, std::string_view a_reason)
+			{
+				Logic::CostMultCache::GetSingleton().Invalidate(a_id);
 
-				const bool insufficient = (startStam + 1e-4f < finalCost);
-				if (insufficient) {
-					ForceZeroTicks(actor->GetHandle(), kForceZeroTicks);
+				if (_tracker.Evict(a_id, LookupActor)) {
+					const auto stats = _tracker.GetStats();
+					SF_LOG_DEBUG(kLightAttack, "[LightAttackStaminaCost][State] evicted {:08X} ({}) live={} bytes={}",
+						a_id, a_reason, stats.entries, stats.bytes);
 				}
+			}
 
-				if constexpr (kDebugPlayerSpend) {
-					if (actor->IsPlayerRef()) {
-						const auto* name = weap ? weap->GetName() : "Unarmed";
-						const bool twoH = weap ? IsTwoHanded(weap) : false;
-
-						SKSE::log::info(
-							"[LightAttackStaminaCost][Spend] tag={} power={} hand={} session={} twoH={} ambiguous={} treatAsUnarmed={} weap='{}' baseCost={} entryMult={} finalCost={} startStam={} curStamBefore={} desired={} paid={} ratio={} insuff={} stamAfter={}",
-							tagView,
-							isPower,
-							leftHand ? "L" : "R",
-							(sessionIdx == 0 ? "L" : "R"),
-							twoH,
-							ambiguous,
-							treatAsUnarmed,
-							name ? name : "(null)",
-							baseCost,
-							entryMult,
-							finalCost,
-							startStam,
-							staminaNow,
-							desired,
-							paid,
-							ratio,
-							insufficient,
-							staminaAfter);
-					}
-				}
+			// Drop everything (new game / before a save is loaded).
+			void EvictAll(std::string_view a_reason)
+			{
+				const auto before = _tracker.GetStats();
+				const auto n = _tracker.Clear(LookupActor);
+				SF_LOG_INFO(kLightAttack, "[LightAttackStaminaCost][State] cleared {} entries ({}), was bytes={}",
+					n, a_reason, before.bytes);
+			}
 
-				// Apply damage scaling if partial pay
-				if (ratio + 1e-6f < 1.0f) {
-					std::scoped_lock _{ _lock };
-					auto& st = _state[id];
-					ApplyDamageScale(actor, st, ratio, nowMs + kDamagePenaltyWindowMs);
+		private:
+			static std::optional<Engine::SkyrimActor> LookupActor(RE::FormID a_id)
+			{
+				if (auto* actor = RE::TESForm::LookupByID<RE::Actor>(a_id)) {
+					return Engine::SkyrimActor{ actor };
 				}
-
-				return RE::BSEventNotifyControl::kContinue;
+				return std::nullopt;
 			}
 
-		private:
-			std::mutex _lock;
-			std::unordered_map<std::uint32_t, ActorState> _state;
+			LA::Tracker _tracker;
+			PlayerTagDump _tagDump;
 		};
 
-		class ActorLoadedSink final : public RE::BSTEventSink<RE::TESObjectLoadedEvent>
+		class ActorDeathSink final : public RE::BSTEventSink<RE::TESDeathEvent>
 		{
 		public:
-			static ActorLoadedSink* GetSingleton()
+			static ActorDeathSink* GetSingleton()
 			{
-				static ActorLoadedSink instance;
+				static ActorDeathSink instance;
 				return std::addressof(instance);
 			}
 
 			RE::BSEventNotifyControl ProcessEvent(
-				const RE::TESObjectLoadedEvent* a_event,
-				RE::BSTEventSource<RE::TESObjectLoadedEvent>*) override
+				const RE::TESDeathEvent* a_event,
+				RE::BSTEventSource<RE::TESDeathEvent>*) override
 			{
-				if (!a_event || !a_event->loaded) {
+				// Fires twice: dying (dead == false) and dead. Evict once the actor is really dead.
+				if (!a_event || !a_event->dead || !a_event->actorDying) {
 					return RE::BSEventNotifyControl::kContinue;
 				}
 
-				auto* refr = RE::TESForm::LookupByID<RE::TESObjectREFR>(a_event->formID);
-				auto* actor = refr ? refr->As<RE::Actor>() : nullptr;
-				if (!actor) {
-					return RE::BSEventNotifyControl::kContinue;
-				}
-
-				actor->AddAnimationGraphEventSink(AnimEventSink::GetSingleton());
+				AnimEventHandler::GetSingleton()->Evict(a_event->actorDying->GetFormID(), "died");
 				return RE::BSEventNotifyControl::kContinue;
 			}
 		};
@@ -900,16 +293,38 @@ namespace SF::Combat
 		std::call_once(once, []() {
 			auto* sourceHolder = RE::ScriptEventSourceHolder::GetSingleton();
 			if (!sourceHolder) {
-				SKSE::log::warn("[LightAttackStaminaCost] ScriptEventSourceHolder is null");
+				SF_LOG_WARN(kLightAttack, "[LightAttackStaminaCost] ScriptEventSourceHolder is null");
 				return;
 			}
-			sourceHolder->AddEventSink(ActorLoadedSink::GetSingleton());
+			sourceHolder->AddEventSink(ActorDeathSink::GetSingleton());
 
-			if (auto* pc = RE::PlayerCharacter::GetSingleton()) {
-				pc->AddAnimationGraphEventSink(AnimEventSink::GetSingleton());
-			}
+			// Graph (un)registration is the bus's; detach (combat over, unload) evicts.
+			Events::AnimEventBus::Subscribe({ .name = "LightAttack",
+				.tags = Core::AnimTag::kFlagStaminaMask,
+				.onEvent = [](const Events::AnimEventBus::Event& a_event) { AnimEventHandler::GetSingleton()->OnEvent(a_event); },
+				.wantsAll = [] { return AnimEventHandler::GetSingleton()->PenaltyPending(); },
+				.onDetach = [](std::uint32_t a_formID) { AnimEventHandler::GetSingleton()->Evict(a_formID, "detached"); } });
+			Events::AnimEventBus::Subscribe({ .name = "AnimTag dump",
+				.playerOnly = true,
+				.onEvent = [](const Events::AnimEventBus::Event& a_event) { AnimEventHandler::GetSingleton()->OnPlayerTag(a_event); },
+				.wantsAll = [] { return SF_LOG_ENABLED(kAnimTag, spdlog::level::info); } });
 
-			SKSE::log::info("[LightAttackStaminaCost] Installed (2H-safe sessions; power drain neutralized via startStamina snapshot)");
+			SF_LOG_INFO(kLightAttack, "[LightAttackStaminaCost] Installed (2H-safe sessions; power drain neutralized via startStamina snapshot)");
 		});
 	}
+
+	void LightAttackStaminaCost::ResetState(std::string_view a_reason)
+	{
+		AnimEventHandler::GetSingleton()->EvictAll(a_reason);
+	}
+
+	std::optional<Logic::LightAttack::ActorState> LightAttackStaminaCost::PeekState(std::uint32_t a_formID)
+	{
+		return AnimEventHandler::GetSingleton()->Peek(a_formID);
+	}
+
+	Logic::LightAttack::Tracker::Store::Stats LightAttackStaminaCost::StateStats()
+	{
+		return AnimEventHandler::GetSingleton()->Stats();
+	}
 }
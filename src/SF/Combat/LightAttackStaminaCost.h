@@ -1,5 +1,11 @@
 #pragma once
 
+#include "SF/Logic/LightAttackTracker.h"
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
 namespace SF::Combat
 {
 	// Adds stamina cost to *normal/light* attacks (vanilla light attacks cost 0 stamina).
@@ -16,5 +22,16 @@ namespace SF::Combat
 	{
 	public:
 		static void Install();
+
+		// Drops all per-actor state (and undoes pending damage penalties).
+		// Called on kNewGame / kPreLoadGame; per-actor eviction on unload/death is internal.
+		static void ResetState(std::string_view a_reason);
+
+		// One actor's attack sessions and pending damage penalty, copied out of the tracker.
+		// Empty if the actor has no state (not attacked since load/combat). Any thread.
+		[[nodiscard]] static std::optional<Logic::LightAttack::ActorState> PeekState(std::uint32_t a_formID);
+
+		// Size of the per-actor state map (telemetry).
+		[[nodiscard]] static Logic::LightAttack::Tracker::Store::Stats StateStats();
 	};
 }
@@ -1,29 +1,24 @@
 #include "SF/Combat/ShieldOfStaminaLite.h"
 
+#include "SF/Core/Config.h"
+#include "SF/Core/Latency.h"
+#include "SF/Core/Log.h"
+#include "SF/Engine/SkyrimActor.h"
+#include "SF/Logic/BlockedHit.h"
+
 #include <RE/Skyrim.h>
 #include <SKSE/SKSE.h>
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <mutex>
+#include <utility>
 
 namespace SF::Combat
 {
 	namespace
 	{
-		// Нанести "урон" текущему значению ActorValue (НЕ трогая базу/максимум)
-		// В CommonLib это делается через RestoreActorValue(kDamage, ..., -val).
-		inline void DamageAV(RE::Actor* a, RE::ActorValue av, float val)
-		{
-			if (!a || val <= 0.0f) {
-				return;
-			}
-
-			// ActorValueOwner интерфейс есть через As<>
-			if (auto* avo = a->As<RE::ActorValueOwner>()) {
-				avo->RestoreActorValue(RE::ACTOR_VALUE_MODIFIER::kDamage, av, -val);
-			}
-		}
-
 		inline bool IsBlockedHit(const RE::HitData& hitData)
 		{
 			// Надёжно для NG: через underlying()
@@ -38,6 +33,53 @@ namespace SF::Combat
 			const auto flags = static_cast<std::uint32_t>(hitData.flags.underlying());
 			return (flags & static_cast<std::uint32_t>(HITFLAG::kBlockWithWeapon)) != 0;
 		}
+
+		namespace BH = Logic::BlockedHit;
+
+		// Returns the damage left for health (HitData::totalDamage).
+		using PolicyFn = float (*)(RE::Actor* a_target, const RE::HitData& a_hit);
+
+		// One instantiation per feature set: only the configured factor groups are evaluated,
+		// and only the hit fields they need are read.
+		template <std::uint8_t F>
+		float Policy(RE::Actor* target, const RE::HitData& hitData)
+		{
+			const auto& cfg = Core::Config::Get().shield;
+
+			BH::Hit hit{ .incoming = hitData.totalDamage };
+			if constexpr ((F & BH::kSides) != 0) {
+				hit.defenderIsPlayer = target->IsPlayerRef();
+			}
+			if constexpr ((F & BH::kBlockType) != 0) {
+				hit.weaponBlock = IsWeaponBlock(hitData);
+			}
+			if constexpr ((F & BH::kWeaponClass) != 0) {
+				hit.attackerWeapon = Engine::SkyrimActor::Describe(hitData.weapon).kind;
+			}
+
+			// Стамина платит первой, остаток — в здоровье (SF/Logic/BlockedHit.h)
+			Engine::SkyrimActor a{ target };
+			const auto out = BH::ApplyPolicy<F>(a, hit, cfg);
+
+			if constexpr ((F & BH::kGuardBreak) != 0) {
+				if (out.guardBreak) {
+					target->SetGraphVariableFloat("StaggerMagnitude", cfg.guardBreakStagger);
+					target->NotifyAnimationGraph("staggerStart");
+					SF_LOG_DEBUG(kShield, "[ShieldOfStaminaLite] guard break {:08X} (hit {})", target->GetFormID(), hit.incoming);
+				}
+			}
+			return out.healthDamage;
+		}
+
+		template <std::size_t... I>
+		constexpr std::array<PolicyFn, sizeof...(I)> MakePolicies(std::index_sequence<I...>)
+		{
+			return { &Policy<static_cast<std::uint8_t>(I)>... };
+		}
+
+		constexpr auto kPolicies = MakePolicies(std::make_index_sequence<BH::kFeatureCount>{});
+
+		std::atomic<PolicyFn> g_policy{ kPolicies[0] };
 	}
 
 	class HitEventHook
@@ -50,11 +92,8 @@ namespace SF::Combat
 				// Skyrim SE 1.5.97 (ShieldOfStamina базируется на этом ID)
 				REL::Relocation<std::uintptr_t> hook{ REL::ID(37673) };
 
-				// Чуть больше, чтобы хватило на будущие хуки
-				SKSE::AllocTrampoline(1 << 8);
-				auto& trampoline = SKSE::GetTrampoline();
-
-				_ProcessHit = trampoline.write_call<5>(hook.address() + 0x3C0, ProcessHit);
+				// The trampoline is allocated once for every hook (Plugin::Init).
+				_ProcessHit = SKSE::GetTrampoline().write_call<5>(hook.address() + 0x3C0, ProcessHit);
 			});
 		}
 
@@ -62,58 +101,16 @@ namespace SF::Combat
 		static void ProcessHit(RE::Actor* target, RE::HitData& hitData)
 		{
 			// Если не блок — вообще не вмешиваемся
-			if (!IsBlockedHit(hitData) || !target) {
-				_ProcessHit(target, hitData);
-				return;
-			}
-
-			// Агрессор иногда может быть null (в оригинале тоже проверяют)
-			auto aggressor = hitData.aggressor.get();
-			if (!aggressor) {
-				_ProcessHit(target, hitData);
-				return;
-			}
-
-			// Базовый урон, который игра собирается нанести
-			const float staminaDamageBase = hitData.totalDamage;
-			if (staminaDamageBase <= 0.0f) {
-				_ProcessHit(target, hitData);
-				return;
-			}
-
-			// Мультипликаторы — пока “lite”: 1.0 (можно будет вынести в ini)
-			// Если хочешь как в оригинале (PC/NPC + shield/weapon + guardBreak) — добавим.
-			float staminaDamageMult = 1.0f;
-
-			// Если хочешь разные мульты под щит/оружие — вот точка:
-			// const bool weaponBlock = IsWeaponBlock(hitData);
-			// staminaDamageMult = weaponBlock ? X : Y;
-
-			const float staminaDamage = staminaDamageBase * staminaDamageMult;
-			const float targetStamina = target->GetActorValue(RE::ActorValue::kStamina);
-
-			if (targetStamina <= 0.0f) {
-				// Стамины нет — пускай урон идёт в здоровье как обычно
+			if (!IsBlockedHit(hitData)) {
 				_ProcessHit(target, hitData);
 				return;
 			}
 
-			if (targetStamina < staminaDamage) {
-				// Стамины не хватает: часть урона поглощается стаминой, остаток — в здоровье.
-				// Сколько "базового" урона можно оплатить текущей стаминой:
-				const float blockedBaseDamage = targetStamina / staminaDamageMult;
-
-				// Оставляем остаток урона в здоровье:
-				hitData.totalDamage = staminaDamageBase - blockedBaseDamage;
-
-				// И списываем всю стамину в ноль:
-				DamageAV(target, RE::ActorValue::kStamina, targetStamina);
-			} else {
-				// Стамины хватает: здоровье НЕ трогаем вообще
-				hitData.totalDamage = 0.0f;
-
-				// Списываем нужную стамину
-				DamageAV(target, RE::ActorValue::kStamina, staminaDamage);
+			// Агрессор иногда может быть null (в оригинале тоже проверяют);
+			// нулевой урон платить нечем.
+			if (target && hitData.aggressor.get() && hitData.totalDamage > 0.0f) {
+				SF_LATENCY_SCOPE(kProcessHit);
+				hitData.totalDamage = g_policy.load(std::memory_order_relaxed)(target, hitData);
 			}
 
 			_ProcessHit(target, hitData);
@@ -124,6 +121,18 @@ namespace SF::Combat
 
 	void ShieldOfStaminaLite::Install()
 	{
+		Configure();
 		HitEventHook::InstallHook();
 	}
+
+	void ShieldOfStaminaLite::Configure()
+	{
+		const auto features = BH::Features(Core::Config::Get().shield);
+		const auto previous = g_policy.exchange(kPolicies[features], std::memory_order_relaxed);
+		if (previous != kPolicies[features]) {
+			SF_LOG_INFO(kShield, "[ShieldOfStaminaLite] policy: sides={} blockType={} weaponClass={} guardBreak={}",
+				(features & BH::kSides) != 0, (features & BH::kBlockType) != 0,
+				(features & BH::kWeaponClass) != 0, (features & BH::kGuardBreak) != 0);
+		}
+	}
 }
@@ -5,9 +5,14 @@ namespace SF::Combat
 	// Simplified "Shield of Stamina" behavior:
 	// - On a blocked hit, health damage is paid from stamina first.
 	// - If stamina is insufficient, the remaining damage stays on health.
+	// - "Shield.*" factors scale the stamina cost by defender side, block type and the attacker's
+	//   weapon class; a heavy hit on an emptied guard staggers (Logic/BlockedHit.h).
 	class ShieldOfStaminaLite
 	{
 	public:
 		static void Install();
+
+		// Picks the blocked-hit policy for the published config. Call after every Config::Publish.
+		static void Configure();
 	};
 }
@@ -0,0 +1,351 @@
+#pragma once
+
+#include "SF/Core/SlotArena.h"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace SF::Core
+{
+	namespace detail
+	{
+		// FormID -> arena slot, open addressing with linear probing in one flat array (no nodes,
+		// no per-entry allocation). Deletion shifts the following entries back instead of leaving
+		// tombstones, so lookups never degrade after churn. Entries carry the slot's hot address
+		// too, so a lookup goes from the index straight to the state.
+		template <class T>
+		class SlotIndex
+		{
+			static constexpr std::uint32_t kEmpty = ~0u;
+
+		public:
+			struct Entry
+			{
+				std::uint32_t key{ 0 };
+				std::uint32_t slot{ kEmpty };
+				T* hot{ nullptr };
+			};
+
+			[[nodiscard]] const Entry* Find(std::uint32_t a_key) const noexcept
+			{
+				if (_entries.empty()) {
+					return nullptr;
+				}
+				for (auto i = Home(a_key);; i = (i + 1) & _mask) {
+					const auto& e = _entries[i];
+					if (e.slot == kEmpty) {
+						return nullptr;
+					}
+					if (e.key == a_key) {
+						return &e;
+					}
+				}
+			}
+
+			// a_key must not be present.
+			const Entry& Insert(std::uint32_t a_key, std::uint32_t a_slot, T* a_hot)
+			{
+				if ((_size + 1) * 2 > _entries.size()) {
+					Rehash(_entries.empty() ? 8 : _entries.size() * 2);
+				}
+				auto i = Home(a_key);
+				while (_entries[i].slot != kEmpty) {
+					i = (i + 1) & _mask;
+				}
+				_entries[i] = { a_key, a_slot, a_hot };
+				++_size;
+				return _entries[i];
+			}
+
+			bool Erase(std::uint32_t a_key) noexcept
+			{
+				if (_entries.empty()) {
+					return false;
+				}
+				auto i = Home(a_key);
+				for (;; i = (i + 1) & _mask) {
+					if (_entries[i].slot == kEmpty) {
+						return false;
+					}
+					if (_entries[i].key == a_key) {
+						break;
+					}
+				}
+
+				// Backward shift: pull later entries of the probe run into the hole when their home
+				// is not between the hole and where they sit.
+				for (auto j = (i + 1) & _mask; _entries[j].slot != kEmpty; j = (j + 1) & _mask) {
+					const auto home = Home(_entries[j].key);
+					if (((j - home) & _mask) >= ((j - i) & _mask)) {
+						_entries[i] = _entries[j];
+						i = j;
+					}
+				}
+				_entries[i] = {};
+				--_size;
+				return true;
+			}
+
+			// Keeps the table: the next fill does not allocate.
+			void Clear() noexcept
+			{
+				for (auto& e : _entries) {
+					e = {};
+				}
+				_size = 0;
+			}
+
+			[[nodiscard]] std::size_t Bytes() const noexcept { return _entries.capacity() * sizeof(Entry); }
+
+		private:
+			[[nodiscard]] std::size_t Home(std::uint32_t a_key) const noexcept
+			{
+				// The shard was picked from the high bits of a Fibonacci hash; use another mix here.
+				auto h = a_key * 0x85EBCA6Bu;
+				h ^= h >> 16;
+				return h & _mask;
+			}
+
+			void Rehash(std::size_t a_capacity)
+			{
+				std::vector<Entry> old(a_capacity);
+				old.swap(_entries);
+				_mask = a_capacity - 1;
+				_size = 0;
+				for (const auto& e : old) {
+					if (e.slot != kEmpty) {
+						Insert(e.key, e.slot, e.hot);
+					}
+				}
+			}
+
+			std::vector<Entry> _entries;
+			std::size_t _mask{ 0 };
+			std::size_t _size{ 0 };
+		};
+	}
+
+	// Per-actor state keyed by FormID, split into independently locked shards.
+	//
+	// Animation events arrive on several animation job threads. With one global mutex every actor
+	// in the scene contends on it; here two actors only contend if they hash to the same shard.
+	//
+	// Access pattern: one Acquire() per event. The returned Accessor keeps the shard locked and
+	// holds a stable reference to the entry until it goes out of scope, so the event does a single
+	// lookup no matter how many fields it touches.
+	//
+	// Storage: each shard keeps its entries in a SlotArena (T in the hot column, optional `Cold`
+	// alongside in its own array) found through a flat FormID index. Erased slots are reused, so
+	// after the first fight nothing is allocated per actor. An Accessor's Handle() names the
+	// entry by slot and generation; Find(handle) reaches it again without hashing, and fails once
+	// the actor has been erased, even if the slot was handed to another actor since.
+	template <class T, class Cold = NoCold, std::size_t ShardCount = 64>
+	class ActorStateStore
+	{
+		static_assert(ShardCount >= 2 && (ShardCount & (ShardCount - 1)) == 0, "ShardCount must be a power of two >= 2");
+
+		static constexpr std::uint32_t kShardBits = static_cast<std::uint32_t>(std::bit_width(ShardCount - 1));
+
+		using Arena = SlotArena<T, Cold>;
+		using Index = detail::SlotIndex<T>;
+
+		// Index first: its table pointer shares the cache line with the lock word.
+		struct alignas(64) Shard
+		{
+			Index index;
+			std::mutex lock;
+			Arena arena;
+		};
+
+	public:
+		static constexpr bool kHasCold = Arena::kHasCold;
+
+		// Slot (shard in the low bits) + generation.
+		using Handle = typename Arena::Handle;
+
+		class Accessor
+		{
+		public:
+			Accessor() = default;
+			Accessor(std::unique_lock<std::mutex> a_lock, T* a_value, Arena& a_arena, std::uint32_t a_slot, std::uint32_t a_shard) :
+				_lock(std::move(a_lock)),
+				_value(a_value),
+				_arena(&a_arena),
+				_slot(a_slot),
+				_shard(a_shard)
+			{}
+
+			[[nodiscard]] explicit operator bool() const noexcept { return _value != nullptr; }
+
+			[[nodiscard]] T& operator*() const noexcept { return *_value; }
+			[[nodiscard]] T* operator->() const noexcept { return _value; }
+			[[nodiscard]] T* get() const noexcept { return _value; }
+
+			// The entry's cold column (stores with a Cold type only).
+			[[nodiscard]] Cold& cold() const noexcept
+				requires(kHasCold)
+			{
+				return _arena->ColdAt(_slot);
+			}
+
+			[[nodiscard]] Handle handle() const noexcept
+			{
+				auto h = _arena->HandleOf(_slot);
+				h.slot = (h.slot << kShardBits) | _shard;
+				return h;
+			}
+
+		private:
+			std::unique_lock<std::mutex> _lock;
+			T* _value{ nullptr };
+			Arena* _arena{ nullptr };
+			std::uint32_t _slot{ 0 };
+			std::uint32_t _shard{ 0 };
+		};
+
+		// Find-or-create.
+		[[nodiscard]] Accessor Acquire(std::uint32_t a_id)
+		{
+			const auto s = ShardIndex(a_id);
+			auto& shard = _shards[s];
+			std::unique_lock lock{ shard.lock };
+			auto* e = shard.index.Find(a_id);
+			if (!e) {
+				const auto slot = shard.arena.Allocate(a_id);
+				e = &shard.index.Insert(a_id, slot, &shard.arena.HotAt(slot));
+			}
+			return Accessor{ std::move(lock), e->hot, shard.arena, e->slot, static_cast<std::uint32_t>(s) };
+		}
+
+		// Lookup only; empty accessor (shard unlocked) if the actor has no state.
+		[[nodiscard]] Accessor Find(std::uint32_t a_id)
+		{
+			const auto s = ShardIndex(a_id);
+			auto& shard = _shards[s];
+			std::unique_lock lock{ shard.lock };
+			const auto* e = shard.index.Find(a_id);
+			if (!e) {
+				return {};
+			}
+			return Accessor{ std::move(lock), e->hot, shard.arena, e->slot, static_cast<std::uint32_t>(s) };
+		}
+
+		// Lookup by an earlier Accessor::handle(); empty if that entry has been erased since.
+		[[nodiscard]] Accessor Find(Handle a_handle)
+		{
+			const auto s = a_handle.slot & (ShardCount - 1);
+			auto& shard = _shards[s];
+			std::unique_lock lock{ shard.lock };
+			const Handle local{ a_handle.slot >> kShardBits, a_handle.generation };
+			if (!shard.arena.Valid(local)) {
+				return {};
+			}
+			return Accessor{ std::move(lock), &shard.arena.HotAt(local.slot), shard.arena, local.slot, static_cast<std::uint32_t>(s) };
+		}
+
+		// Removes one actor's state. a_onEvict(id, T&) (or (id, T&, Cold&)) runs under the shard
+		// lock right before the erase, so callers can undo side effects (e.g. pending AV
+		// modifiers). Returns false if absent.
+		template <class Fn>
+		bool Erase(std::uint32_t a_id, Fn&& a_onEvict)
+		{
+			auto& shard = _shards[ShardIndex(a_id)];
+			std::scoped_lock _{ shard.lock };
+			const auto* e = shard.index.Find(a_id);
+			if (!e) {
+				return false;
+			}
+			const auto slot = e->slot;
+			Visit(shard.arena, slot, a_onEvict);
+			shard.index.Erase(a_id);
+			shard.arena.Free(slot);
+			return true;
+		}
+
+		// Drops every entry (new game / load game). a_onEvict(id, T&) runs for each one.
+		// Returns the number of evicted entries. The slots stay allocated for reuse.
+		template <class Fn>
+		std::size_t Clear(Fn&& a_onEvict)
+		{
+			std::size_t n = 0;
+			for (auto& shard : _shards) {
+				std::scoped_lock _{ shard.lock };
+				shard.arena.ForEachLive([&](std::uint32_t a_slot) {
+					Visit(shard.arena, a_slot, a_onEvict);
+					shard.arena.Free(a_slot);
+					++n;
+				});
+				shard.index.Clear();
+			}
+			return n;
+		}
+
+		// Visits every entry under its shard lock; entries for which a_fn(id, T&) returns true are
+		// erased. Returns the number of erased entries.
+		template <class Fn>
+		std::size_t EraseIf(Fn&& a_fn)
+		{
+			std::size_t n = 0;
+			for (auto& shard : _shards) {
+				std::scoped_lock _{ shard.lock };
+				shard.arena.ForEachLive([&](std::uint32_t a_slot) {
+					if (Visit(shard.arena, a_slot, a_fn)) {
+						shard.index.Erase(shard.arena.KeyAt(a_slot));
+						shard.arena.Free(a_slot);
+						++n;
+					}
+				});
+			}
+			return n;
+		}
+
+		struct Stats
+		{
+			std::size_t entries{ 0 };
+			std::size_t bytes{ 0 };  // heap footprint: arena chunks (in use or free) + indexes
+		};
+
+		[[nodiscard]] Stats GetStats()
+		{
+			Stats stats;
+			for (auto& shard : _shards) {
+				std::scoped_lock _{ shard.lock };
+				stats.entries += shard.arena.Live();
+				stats.bytes += shard.arena.Bytes() + shard.index.Bytes();
+			}
+			return stats;
+		}
+
+		[[nodiscard]] std::size_t Size()
+		{
+			return GetStats().entries;
+		}
+
+		[[nodiscard]] static constexpr std::size_t ShardIndex(std::uint32_t a_id) noexcept
+		{
+			// FormIDs share their high (plugin index) byte; Fibonacci hashing spreads the low bits.
+			constexpr auto kShift = 32 - kShardBits;
+			return static_cast<std::size_t>((a_id * 0x9E3779B1u) >> kShift) & (ShardCount - 1);
+		}
+
+	private:
+		// a_fn(id, T&, Cold&) if it takes the cold column, else a_fn(id, T&).
+		template <class Fn>
+		static decltype(auto) Visit(Arena& a_arena, std::uint32_t a_slot, Fn& a_fn)
+		{
+			if constexpr (kHasCold && std::is_invocable_v<Fn&, std::uint32_t, T&, Cold&>) {
+				return a_fn(a_arena.KeyAt(a_slot), a_arena.HotAt(a_slot), a_arena.ColdAt(a_slot));
+			} else {
+				return a_fn(a_arena.KeyAt(a_slot), a_arena.HotAt(a_slot));
+			}
+		}
+
+		std::array<Shard, ShardCount> _shards{};
+	};
+}
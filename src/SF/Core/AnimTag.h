@@ -0,0 +1,262 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace SF::Core::AnimTag
+{
+	// Compile-time perfect-hash classifier for the animation tags the plugin reacts to.
+	//
+	// Every BSAnimationGraphEvent of every loaded actor goes through Classify(), so it must be cheap:
+	//  - length pre-filter: a 64-bit mask of the lengths we know (rejects most engine tags)
+	//  - one hash over the length and four case-folded sample bytes (no full pass over the string)
+	//  - one slot load + one case-insensitive compare
+	// Unknown tags come back as Id::kNone with no flags.
+	//
+	// BSFixedString is case-insensitive and the string pool keeps the casing it saw first,
+	// so "weaponSwing" may arrive as "WeaponSwing". We fold ASCII case instead of listing variants.
+	//
+	// This table is the built-in vocabulary. At runtime the sinks classify through
+	// Core::AnimTagDict, which starts from these entries and adds the tags of animation packs.
+
+	enum class Id : std::uint8_t
+	{
+		kNone = 0,
+
+		kAttackStart,
+		kAttackStartLeft,
+		kAttackStartRight,
+
+		kWeaponSwing,
+		kWeaponLeftSwing,
+		kWeaponRightSwing,
+
+		kUnarmedSwingSound,  // SoundPlay.WPNSwingUnarmed (pairs with the following weaponSwing)
+
+		kJumpUp,
+
+		kCustom,  // from an AnimTagDict file (the role is in the flags)
+
+		kTotal
+	};
+
+	// Category and hand bits.
+	enum Flag : std::uint8_t
+	{
+		kFlagStart = 1 << 0,         // opens a hand session (attackStart*)
+		kFlagSpend = 1 << 1,         // real swing -> spend (weapon*Swing)
+		kFlagUnarmedSound = 1 << 2,  // unarmed swing sound (pairing only)
+		kFlagJump = 1 << 3,          // JumpUp
+		kFlagLeft = 1 << 4,          // tag names the left hand explicitly
+		kFlagRight = 1 << 5,         // tag names the right hand explicitly
+		kFlagScoped = 1 << 6,        // AnimTagDict: meaning depends on the behavior project (ForProject)
+
+		kFlagStaminaMask = kFlagStart | kFlagSpend | kFlagUnarmedSound
+	};
+
+	// How the light-attack logic finds the hand of a tag (the program it runs, see
+	// Logic::LightAttack::kHandPrograms). Derived from the flags when a table is built.
+	enum class HandRule : std::uint8_t
+	{
+		kDefaultRight,  // no hand information: stable default
+		kLeft,
+		kRight,
+		kSwing,         // ambiguous spend: paired unarmed sound, then recent explicit hand
+		kUnarmedSound,  // pairing tag: the empty hand, then recent explicit hand
+
+		kTotal
+	};
+
+	[[nodiscard]] constexpr HandRule HandRuleFor(std::uint8_t a_flags) noexcept
+	{
+		if (a_flags & kFlagLeft) {
+			return HandRule::kLeft;
+		}
+		if (a_flags & kFlagRight) {
+			return HandRule::kRight;
+		}
+		if (a_flags & kFlagUnarmedSound) {
+			return HandRule::kUnarmedSound;
+		}
+		if (a_flags & kFlagSpend) {
+			return HandRule::kSwing;
+		}
+		return HandRule::kDefaultRight;
+	}
+
+	struct Info
+	{
+		Id id{ Id::kNone };
+		std::uint8_t flags{ 0 };
+		HandRule hand{ HandRule::kDefaultRight };
+
+		[[nodiscard]] constexpr bool Known() const noexcept { return id != Id::kNone; }
+		[[nodiscard]] constexpr bool Any(std::uint8_t a_mask) const noexcept { return (flags & a_mask) != 0; }
+
+		[[nodiscard]] constexpr bool IsStart() const noexcept { return Any(kFlagStart); }
+		[[nodiscard]] constexpr bool IsSpend() const noexcept { return Any(kFlagSpend); }
+		[[nodiscard]] constexpr bool IsUnarmedSound() const noexcept { return Any(kFlagUnarmedSound); }
+		[[nodiscard]] constexpr bool IsJump() const noexcept { return Any(kFlagJump); }
+		[[nodiscard]] constexpr bool HasLeft() const noexcept { return Any(kFlagLeft); }
+		[[nodiscard]] constexpr bool HasRight() const noexcept { return Any(kFlagRight); }
+
+		// weaponSwing / unarmed sound: hand must be decoded from context.
+		[[nodiscard]] constexpr bool HandAmbiguous() const noexcept { return !Any(kFlagLeft | kFlagRight); }
+	};
+
+	namespace detail
+	{
+		struct Entry
+		{
+			std::string_view name;
+			Id id;
+			std::uint8_t flags;
+		};
+
+		inline constexpr std::array kEntries{
+			Entry{ "attackStart", Id::kAttackStart, kFlagStart },
+			Entry{ "attackStartLeft", Id::kAttackStartLeft, kFlagStart | kFlagLeft },
+			Entry{ "attackStartRight", Id::kAttackStartRight, kFlagStart | kFlagRight },
+			Entry{ "weaponSwing", Id::kWeaponSwing, kFlagSpend },
+			Entry{ "weaponLeftSwing", Id::kWeaponLeftSwing, kFlagSpend | kFlagLeft },
+			Entry{ "weaponRightSwing", Id::kWeaponRightSwing, kFlagSpend | kFlagRight },
+			Entry{ "SoundPlay.WPNSwingUnarmed", Id::kUnarmedSwingSound, kFlagUnarmedSound },
+			Entry{ "JumpUp", Id::kJumpUp, kFlagJump },
+		};
+
+		inline constexpr std::size_t kTableSize = 32;  // power of two, >= 4x entries
+		static_assert((kTableSize & (kTableSize - 1)) == 0);
+
+		// Branch-free ASCII tolower.
+		[[nodiscard]] constexpr std::uint8_t Fold(char c) noexcept
+		{
+			const auto u = static_cast<std::uint8_t>(c);
+			return static_cast<std::uint8_t>(u + (static_cast<std::uint8_t>(u - 'A') < 26u ? 32u : 0u));
+		}
+
+		// Samples first/quarter/middle/last bytes. `| 0x20` folds ASCII letters to lower case;
+		// it also maps a few punctuation bytes onto each other, which only costs a compare miss.
+		// If two table entries ever sample identically, FindSeed() fails and the static_assert fires.
+		[[nodiscard]] constexpr std::uint32_t Hash(std::string_view s, std::uint32_t seed) noexcept
+		{
+			const auto n = s.size();
+			const auto at = [&](std::size_t i) { return static_cast<std::uint32_t>(static_cast<std::uint8_t>(s[i]) | 0x20u); };
+
+			std::uint32_t h = static_cast<std::uint32_t>(n) * 0x9E3779B1u ^ seed;
+			h ^= at(0) | (at(n / 4) << 8) | (at(n / 2) << 16) | (at(n - 1) << 24);
+			h *= 0x85EBCA6Bu;
+			h ^= h >> 13;
+			h *= 0xC2B2AE35u;
+			return h ^ (h >> 16);
+		}
+
+		[[nodiscard]] constexpr bool EqualsFolded(std::string_view a, std::string_view b) noexcept
+		{
+			if (a.size() != b.size()) {
+				return false;
+			}
+			if (a == b) {
+				return true;  // canonical casing: one memcmp
+			}
+			std::uint8_t diff = 0;
+			for (std::size_t i = 0; i < a.size(); ++i) {
+				diff |= static_cast<std::uint8_t>(Fold(a[i]) ^ Fold(b[i]));
+			}
+			return diff == 0;
+		}
+
+		[[nodiscard]] constexpr std::uint32_t FindSeed()
+		{
+			for (std::uint32_t seed = 1; seed < 100000; ++seed) {
+				std::array<bool, kTableSize> used{};
+				bool ok = true;
+				for (const auto& e : kEntries) {
+					const auto slot = Hash(e.name, seed) & (kTableSize - 1);
+					if (used[slot]) {
+						ok = false;
+						break;
+					}
+					used[slot] = true;
+				}
+				if (ok) {
+					return seed;
+				}
+			}
+			return 0;
+		}
+
+		inline constexpr std::uint32_t kSeed = FindSeed();
+		static_assert(kSeed != 0, "AnimTag: no collision-free seed for the tag table");
+
+		struct Slot
+		{
+			std::string_view name{};
+			Info info{};
+		};
+
+		[[nodiscard]] constexpr std::array<Slot, kTableSize> BuildTable()
+		{
+			std::array<Slot, kTableSize> table{};
+			table.fill(Slot{ std::string_view{ "" }, Info{} });  // explicit: GCC 12 rejects reading value-initialized views in constant expressions
+			for (const auto& e : kEntries) {
+				table[Hash(e.name, kSeed) & (kTableSize - 1)] = Slot{ e.name, Info{ e.id, e.flags, HandRuleFor(e.flags) } };
+			}
+			return table;
+		}
+
+		inline constexpr auto kTable = BuildTable();
+
+		[[nodiscard]] constexpr std::uint64_t BuildLengthMask()
+		{
+			std::uint64_t mask = 0;
+			for (const auto& e : kEntries) {
+				mask |= std::uint64_t{ 1 } << e.name.size();
+			}
+			return mask;
+		}
+
+		inline constexpr std::uint64_t kLengthMask = BuildLengthMask();
+		static_assert([] {
+			for (const auto& e : kEntries) {
+				if (e.name.size() >= 64) {
+					return false;
+				}
+			}
+			return true;
+		}(), "AnimTag: tag names must be shorter than 64 chars");
+	}
+
+	[[nodiscard]] constexpr Info Classify(std::string_view a_tag) noexcept
+	{
+		if (a_tag.empty() || a_tag.size() >= 64 || ((detail::kLengthMask >> a_tag.size()) & 1u) == 0) {
+			return Info{};
+		}
+
+		const auto slot = detail::Hash(a_tag, detail::kSeed) & (detail::kTableSize - 1);
+		if (!detail::EqualsFolded(detail::kTable[slot].name, a_tag)) {
+			return Info{};
+		}
+		return detail::kTable[slot].info;
+	}
+
+	[[nodiscard]] constexpr std::string_view Name(Id a_id) noexcept
+	{
+		for (const auto& e : detail::kEntries) {
+			if (e.id == a_id) {
+				return e.name;
+			}
+		}
+		return a_id == Id::kCustom ? "custom" : "None";
+	}
+
+	static_assert(Classify("weaponSwing").id == Id::kWeaponSwing);
+	static_assert(Classify("WeaponLeftSwing").id == Id::kWeaponLeftSwing);
+	static_assert(Classify("AttackStartRight").HasRight());
+	static_assert(Classify("jumpup").IsJump());
+	static_assert(Classify("weaponSwing").hand == HandRule::kSwing);
+	static_assert(Classify("SoundPlay.WPNSwingUnarmed").hand == HandRule::kUnarmedSound);
+	static_assert(!Classify("FootLeft").Known());
+	static_assert(!Classify("weaponSwing2").Known());
+}
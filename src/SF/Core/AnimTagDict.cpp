@@ -0,0 +1,458 @@
+#include "SF/Core/AnimTagDict.h"
+
+#include "SF/Core/ConfigText.h"
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cstdio>
+#include <iterator>
+#include <mutex>
+#include <system_error>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace SF::Core::AnimTagDict
+{
+	namespace detail
+	{
+		const Dictionary g_builtin{};
+	}
+
+	namespace
+	{
+		namespace Tag = AnimTag;
+
+		[[nodiscard]] std::string Folded(std::string_view a_text)
+		{
+			std::string out{ a_text };
+			for (auto& c : out) {
+				c = static_cast<char>(Tag::detail::Fold(c));
+			}
+			return out;
+		}
+
+		[[nodiscard]] Tag::Info MakeInfo(std::string_view a_tag, std::uint8_t a_flags)
+		{
+			if (a_flags == 0) {
+				return {};
+			}
+			// A built-in tag listed with its built-in role keeps its id (traces stay readable).
+			const auto builtin = Tag::Classify(a_tag);
+			const auto id = builtin.Known() && builtin.flags == a_flags ? builtin.id : Tag::Id::kCustom;
+			return { id, a_flags, Tag::HandRuleFor(a_flags) };
+		}
+
+		// Flat JSON object of strings: {"tag": "role", ...}
+		class Parser
+		{
+		public:
+			Parser(std::string_view a_text, ParseResult& a_out) :
+				_text(a_text),
+				_out(a_out)
+			{}
+
+			void Run()
+			{
+				std::vector<std::pair<std::string, std::string>> entries;
+				if (!Object(entries)) {
+					return;
+				}
+
+				// "Project" scopes the whole file, wherever it appears.
+				std::string project;
+				for (const auto& [key, value] : entries) {
+					if (key == "Project") {
+						project = value;
+					}
+				}
+
+				std::unordered_set<std::string> seen;
+				for (auto& [key, value] : entries) {
+					if (key == "Project") {
+						continue;
+					}
+					if (!seen.insert(Folded(key)).second) {
+						_out.warnings.push_back("tag \"" + key + "\" is listed twice, the later role wins");
+					}
+					if (key.empty() || key.size() >= 64) {
+						_out.errors.push_back("tag \"" + key + "\" must be 1-63 characters, skipped");
+						continue;
+					}
+					std::uint8_t flags = 0;
+					if (!ParseRole(value, flags)) {
+						_out.errors.push_back("\"" + key + "\": unknown role \"" + value + "\" (start | spend | pairing | jump | ignore [left | right]), skipped");
+						continue;
+					}
+					_out.rules.push_back({ std::move(key), project, flags });
+				}
+			}
+
+		private:
+			bool Object(std::vector<std::pair<std::string, std::string>>& a_entries)
+			{
+				SkipSpace();
+				if (Done()) {
+					return true;  // empty file: no rules
+				}
+				if (!Consume('{')) {
+					return Error("expected '{' at offset %zu");
+				}
+				SkipSpace();
+				if (Consume('}')) {
+					return true;
+				}
+				while (true) {
+					std::string key;
+					std::string value;
+					SkipSpace();
+					if (!String(key)) {
+						return Error("expected a tag at offset %zu");
+					}
+					SkipSpace();
+					if (!Consume(':')) {
+						return Error("expected ':' at offset %zu");
+					}
+					SkipSpace();
+					if (!String(value)) {
+						return Error("expected a role string at offset %zu");
+					}
+					a_entries.emplace_back(std::move(key), std::move(value));
+					SkipSpace();
+					if (Consume(',')) {
+						continue;
+					}
+					if (Consume('}')) {
+						return true;
+					}
+					return Error("expected ',' or '}' at offset %zu");
+				}
+			}
+
+			bool Done() const { return _pos >= _text.size(); }
+
+			bool Consume(char a_c)
+			{
+				if (!Done() && _text[_pos] == a_c) {
+					++_pos;
+					return true;
+				}
+				return false;
+			}
+
+			void SkipSpace()
+			{
+				while (!Done() && std::isspace(static_cast<unsigned char>(_text[_pos]))) {
+					++_pos;
+				}
+			}
+
+			// a_fmt takes the offset (%zu). Always false.
+			bool Error(const char* a_fmt)
+			{
+				char buf[128];
+				std::snprintf(buf, sizeof(buf), a_fmt, _pos);
+				_out.errors.emplace_back(buf);
+				_out.malformed = true;
+				return false;
+			}
+
+			bool String(std::string& a_out)
+			{
+				if (!Consume('"')) {
+					return false;
+				}
+				while (!Done()) {
+					const char c = _text[_pos++];
+					if (c == '"') {
+						return true;
+					}
+					if (c == '\\' && !Done()) {
+						a_out += _text[_pos++];
+						continue;
+					}
+					a_out += c;
+				}
+				return false;
+			}
+
+			std::string_view _text;
+			ParseResult& _out;
+			std::size_t _pos{ 0 };
+		};
+
+		std::mutex g_publishLock;
+		std::vector<std::unique_ptr<Dictionary>> g_published;  // see header: never freed while running
+	}
+
+	bool ParseRole(std::string_view a_role, std::uint8_t& a_outFlags)
+	{
+		std::uint8_t role = 0;
+		std::uint8_t hand = 0;
+		bool haveRole = false;
+
+		std::size_t pos = 0;
+		while (pos < a_role.size()) {
+			while (pos < a_role.size() && std::isspace(static_cast<unsigned char>(a_role[pos]))) {
+				++pos;
+			}
+			auto end = pos;
+			while (end < a_role.size() && !std::isspace(static_cast<unsigned char>(a_role[end]))) {
+				++end;
+			}
+			if (end == pos) {
+				break;
+			}
+			const auto word = Folded(a_role.substr(pos, end - pos));
+			pos = end;
+
+			if (word == "left" || word == "right") {
+				if (hand != 0) {
+					return false;
+				}
+				hand = word == "left" ? Tag::kFlagLeft : Tag::kFlagRight;
+				continue;
+			}
+			if (haveRole) {
+				return false;
+			}
+			haveRole = true;
+			if (word == "start") {
+				role = Tag::kFlagStart;
+			} else if (word == "spend") {
+				role = Tag::kFlagSpend;
+			} else if (word == "pairing") {
+				role = Tag::kFlagUnarmedSound;
+			} else if (word == "jump") {
+				role = Tag::kFlagJump;
+			} else if (word != "ignore") {
+				return false;
+			}
+		}
+
+		// A hand only means something to the light-attack roles.
+		if (!haveRole || (hand != 0 && (role & Tag::kFlagStaminaMask) == 0)) {
+			return false;
+		}
+		a_outFlags = static_cast<std::uint8_t>(role | hand);
+		return true;
+	}
+
+	ParseResult Parse(std::string_view a_text)
+	{
+		ParseResult out;
+		Parser{ a_text, out }.Run();
+		if (out.malformed) {
+			out.rules.clear();
+		}
+		return out;
+	}
+
+	Dictionary::Dictionary()
+	{
+		Build({});
+	}
+
+	Dictionary::Dictionary(const std::vector<Rule>& a_rules)
+	{
+		Build(a_rules);
+	}
+
+	std::uint16_t Dictionary::ProjectIndex(std::string_view a_project)
+	{
+		for (std::size_t i = 0; i < _projects.size(); ++i) {
+			if (Tag::detail::EqualsFolded(_projects[i], a_project)) {
+				return static_cast<std::uint16_t>(i);
+			}
+		}
+		_projects.emplace_back(a_project);
+		return static_cast<std::uint16_t>(_projects.size() - 1);
+	}
+
+	void Dictionary::Build(const std::vector<Rule>& a_rules)
+	{
+		struct Pending
+		{
+			std::string name;  // casing of the first definition
+			Tag::Info global;
+			std::vector<ScopedInfo> scoped;
+		};
+
+		std::vector<Pending> pending;
+		std::unordered_map<std::string, std::size_t> byName;  // folded name -> pending
+		const auto entry = [&](std::string_view a_name) -> Pending& {
+			const auto [it, inserted] = byName.try_emplace(Folded(a_name), pending.size());
+			if (inserted) {
+				pending.push_back({ std::string{ a_name }, {}, {} });
+			}
+			return pending[it->second];
+		};
+
+		for (const auto& e : Tag::detail::kEntries) {
+			entry(e.name).global = Tag::Info{ e.id, e.flags, Tag::HandRuleFor(e.flags) };
+		}
+
+		for (const auto& rule : a_rules) {
+			if (rule.tag.empty() || rule.tag.size() >= 64) {
+				continue;
+			}
+			auto& p = entry(rule.tag);
+			const auto info = MakeInfo(rule.tag, rule.flags);
+			if (rule.project.empty()) {
+				p.global = info;
+				continue;
+			}
+			const auto project = ProjectIndex(rule.project);
+			const auto it = std::find_if(p.scoped.begin(), p.scoped.end(), [&](const ScopedInfo& a_s) { return a_s.project == project; });
+			if (it != p.scoped.end()) {
+				it->info = info;
+			} else {
+				p.scoped.push_back({ project, info });
+			}
+		}
+
+		// Ignored everywhere: not in the table at all.
+		std::erase_if(pending, [](const Pending& a_p) {
+			return !a_p.global.Known() && std::none_of(a_p.scoped.begin(), a_p.scoped.end(), [](const ScopedInfo& a_s) { return a_s.info.Known(); });
+		});
+
+		std::size_t bytes = 0;
+		for (const auto& p : pending) {
+			bytes += p.name.size();
+		}
+		_names.reserve(bytes);  // the views below point into it: no reallocation after this
+
+		struct Built
+		{
+			std::string_view name;
+			Slot slot;
+		};
+		std::vector<Built> built;
+		built.reserve(pending.size());
+		for (const auto& p : pending) {
+			const auto offset = _names.size();
+			_names += p.name;
+			const std::string_view name{ _names.data() + offset, p.name.size() };
+
+			Slot slot{ name, p.global };
+			if (!p.scoped.empty()) {
+				// Classify() answers with every role the tag has anywhere; ForProject() picks one.
+				std::uint8_t flags = p.global.flags | Tag::kFlagScoped;
+				slot.scopedBegin = static_cast<std::uint16_t>(_scoped.size());
+				for (const auto& s : p.scoped) {
+					flags |= s.info.flags;
+					_scoped.push_back(s);
+				}
+				_scoped.push_back({ kAnyProject, p.global });
+				slot.scopedEnd = static_cast<std::uint16_t>(_scoped.size());
+				slot.info = Tag::Info{ Tag::Id::kCustom, flags, p.global.hand };
+				++_scopedTags;
+			}
+			_lengthMask |= std::uint64_t{ 1 } << name.size();
+			built.push_back({ name, slot });
+		}
+		_size = built.size();
+
+		// >= 4x the tags keeps probe runs short; pick the seed with the shortest worst probe.
+		const auto capacity = std::bit_ceil(std::max<std::size_t>(16, built.size() * 4));
+		_mask = capacity - 1;
+
+		const auto place = [&](std::uint32_t a_seed, std::vector<Slot>* a_table) {
+			std::vector<bool> used(capacity);
+			std::size_t worst = 0;
+			for (const auto& b : built) {
+				std::size_t probe = 0;
+				auto i = Hash(b.name, a_seed) & _mask;
+				while (used[i]) {
+					i = (i + 1) & _mask;
+					++probe;
+				}
+				used[i] = true;
+				if (a_table) {
+					(*a_table)[i] = b.slot;
+				}
+				worst = std::max(worst, probe);
+			}
+			return worst;
+		};
+
+		_seed = 1;
+		_maxProbe = place(_seed, nullptr);
+		for (std::uint32_t seed = 2; seed <= 256 && _maxProbe > 0; ++seed) {
+			const auto worst = place(seed, nullptr);
+			if (worst < _maxProbe) {
+				_seed = seed;
+				_maxProbe = worst;
+			}
+		}
+
+		_slots.assign(capacity, Slot{});
+		place(_seed, &_slots);
+	}
+
+	Tag::Info Dictionary::ForProject(std::string_view a_tag, std::string_view a_project) const noexcept
+	{
+		const auto* slot = Find(a_tag);
+		if (!slot) {
+			return {};
+		}
+		if (!slot->info.Any(Tag::kFlagScoped)) {
+			return slot->info;
+		}
+		for (auto i = slot->scopedBegin; i < slot->scopedEnd; ++i) {
+			const auto& s = _scoped[i];
+			if (s.project == kAnyProject || Tag::detail::EqualsFolded(_projects[s.project], a_project)) {
+				return s.info;
+			}
+		}
+		return {};
+	}
+
+	LoadResult Load(const std::filesystem::path& a_path)
+	{
+		LoadResult out;
+
+		std::vector<std::filesystem::path> files;
+		std::error_code ec;
+		if (std::filesystem::is_regular_file(a_path, ec)) {
+			files.push_back(a_path);
+		} else if (std::filesystem::is_directory(a_path, ec)) {
+			for (const auto& entry : std::filesystem::directory_iterator(a_path, ec)) {
+				if (entry.is_regular_file(ec) && Folded(entry.path().extension().string()) == ".json") {
+					files.push_back(entry.path());
+				}
+			}
+			std::sort(files.begin(), files.end());
+		}
+
+		std::vector<Rule> rules;
+		for (const auto& file : files) {
+			auto result = Parse(ConfigText::ReadAllText(file));
+			const auto name = file.filename().string();
+			for (const auto& e : result.errors) {
+				out.errors.push_back(name + ": " + e);
+			}
+			for (const auto& w : result.warnings) {
+				out.warnings.push_back(name + ": " + w);
+			}
+			if (result.malformed) {
+				out.errors.push_back(name + ": not valid JSON, file skipped");
+				continue;
+			}
+			++out.files;
+			std::move(result.rules.begin(), result.rules.end(), std::back_inserter(rules));
+		}
+
+		out.rules = rules.size();
+		out.dictionary = std::make_unique<Dictionary>(rules);
+		return out;
+	}
+
+	void Publish(std::unique_ptr<Dictionary> a_dictionary)
+	{
+		std::scoped_lock _{ g_publishLock };
+		const Dictionary* next = a_dictionary.get();
+		g_published.push_back(std::move(a_dictionary));
+		detail::g_current.store(next, std::memory_order_release);
+	}
+}
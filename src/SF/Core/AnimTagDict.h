@@ -0,0 +1,192 @@
+#pragma once
+
+#include "SF/Core/AnimTag.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace SF::Core::AnimTagDict
+{
+	// The tag vocabulary the sinks classify against: AnimTag's built-in table plus tag -> role
+	// rules from data files, so an animation pack that emits its own swing/start tags is
+	// supported by a file, not a build.
+	//
+	// Files: <game>/Data/SKSE/Plugins/SunderForge/AnimTags/*.json, read at startup in name order
+	// (a later file overrides an earlier one). One flat object per file:
+	//
+	//   {
+	//     "Project": "DefaultMale",         optional: the file only applies to graphs of this
+	//                                       behavior project (hkx project name)
+	//     "MCO_AttackStartL": "start left",
+	//     "MCO_WeaponSwing": "spend",
+	//     "weaponSwing": "ignore"
+	//   }
+	//
+	// Roles: start | spend | pairing | jump | ignore, optionally followed by left | right.
+	// "pairing" is what SoundPlay.WPNSwingUnarmed is (remembered for the next ambiguous spend);
+	// "ignore" takes a tag out, built-ins included. Names match case-insensitively.
+	// In a project's graphs its own rule for a tag beats the global one.
+	//
+	// The rules compile into an immutable Dictionary: one open-addressing table of (name, Info)
+	// behind the same length filter as AnimTag::Classify, with each tag's HandRule already
+	// resolved. Packs name their tags systematically (MCO_AttackStart10L, ...11L), which the
+	// built-in four-byte sample cannot tell apart, so the table hashes the whole tag 8 bytes at a
+	// time. A lookup is one acquire load plus the probe; no lock, no
+	// allocation. Tags a project file touches come back with kFlagScoped (and the union of their
+	// roles, so fast rejects stay correct); the sink then asks ForProject() with the actor's
+	// project - only those events pay for it.
+
+	struct Rule
+	{
+		std::string tag;
+		std::string project;      // empty: every project
+		std::uint8_t flags{ 0 };  // AnimTag::Flag role + hand bits; 0 = ignore
+	};
+
+	// "start left" -> flags. False if a_role is not one of the roles above.
+	[[nodiscard]] bool ParseRole(std::string_view a_role, std::uint8_t& a_outFlags);
+
+	struct ParseResult
+	{
+		std::vector<Rule> rules;
+		std::vector<std::string> errors;    // malformed JSON, unknown roles, bad tag names
+		std::vector<std::string> warnings;
+		bool malformed{ false };            // not valid JSON: the whole file is skipped
+	};
+
+	[[nodiscard]] ParseResult Parse(std::string_view a_text);
+
+	class Dictionary
+	{
+	public:
+		// Built-ins only.
+		Dictionary();
+
+		// Built-ins, then a_rules in order (a later rule for the same tag and project wins).
+		explicit Dictionary(const std::vector<Rule>& a_rules);
+
+		Dictionary(const Dictionary&) = delete;
+		Dictionary& operator=(const Dictionary&) = delete;
+
+		[[nodiscard]] AnimTag::Info Classify(std::string_view a_tag) const noexcept
+		{
+			const auto* slot = Find(a_tag);
+			return slot ? slot->info : AnimTag::Info{};
+		}
+
+		// What a tag Classify() marked kFlagScoped means in graphs of a_project.
+		[[nodiscard]] AnimTag::Info ForProject(std::string_view a_tag, std::string_view a_project) const noexcept;
+
+		[[nodiscard]] std::size_t Size() const noexcept { return _size; }
+		[[nodiscard]] std::size_t Scoped() const noexcept { return _scopedTags; }
+		[[nodiscard]] std::size_t MaxProbe() const noexcept { return _maxProbe; }  // longest hit probe, in slots
+		[[nodiscard]] const std::vector<std::string>& Projects() const noexcept { return _projects; }
+
+	private:
+		static constexpr std::uint16_t kAnyProject = 0xFFFF;
+
+		struct Slot
+		{
+			std::string_view name;
+			AnimTag::Info info;
+			std::uint16_t scopedBegin{ 0 };  // [begin, end) in _scoped, kFlagScoped tags only
+			std::uint16_t scopedEnd{ 0 };
+		};
+
+		struct ScopedInfo
+		{
+			std::uint16_t project{ kAnyProject };
+			AnimTag::Info info;
+		};
+
+		// Case-folded like AnimTag::detail::Hash (`| 0x20` per byte), over every byte.
+		[[nodiscard]] static std::size_t Hash(std::string_view a_tag, std::uint32_t a_seed) noexcept
+		{
+			constexpr std::uint64_t kFold = 0x2020202020202020ull;
+			const auto mix = [](std::uint64_t a_h, std::uint64_t a_word) {
+				a_h = (a_h ^ a_word) * 0xFF51AFD7ED558CCDull;
+				return a_h ^ (a_h >> 32);
+			};
+
+			const auto n = a_tag.size();
+			std::uint64_t h = (static_cast<std::uint64_t>(n) << 32 | a_seed) * 0x9E3779B97F4A7C15ull;
+			std::size_t i = 0;
+			for (; i + 8 <= n; i += 8) {
+				std::uint64_t word;
+				std::memcpy(&word, a_tag.data() + i, 8);
+				h = mix(h, word | kFold);
+			}
+			if (i < n) {
+				std::uint64_t word = 0;
+				std::memcpy(&word, a_tag.data() + i, n - i);
+				h = mix(h, word | kFold);
+			}
+			return static_cast<std::size_t>(h ^ (h >> 29));
+		}
+
+		[[nodiscard]] const Slot* Find(std::string_view a_tag) const noexcept
+		{
+			if (a_tag.empty() || a_tag.size() >= 64 || ((_lengthMask >> a_tag.size()) & 1u) == 0) {
+				return nullptr;
+			}
+			for (auto i = Hash(a_tag, _seed) & _mask;; i = (i + 1) & _mask) {
+				const auto& slot = _slots[i];
+				if (slot.name.empty()) {
+					return nullptr;
+				}
+				if (AnimTag::detail::EqualsFolded(slot.name, a_tag)) {
+					return &slot;
+				}
+			}
+		}
+
+		void Build(const std::vector<Rule>& a_rules);
+		[[nodiscard]] std::uint16_t ProjectIndex(std::string_view a_project);
+
+		std::string _names;  // every slot name, one buffer
+		std::vector<Slot> _slots;
+		std::vector<ScopedInfo> _scoped;
+		std::vector<std::string> _projects;
+		std::uint64_t _lengthMask{ 0 };
+		std::uint32_t _seed{ 0 };
+		std::size_t _mask{ 0 };
+		std::size_t _size{ 0 };
+		std::size_t _scopedTags{ 0 };
+		std::size_t _maxProbe{ 0 };
+	};
+
+	struct LoadResult
+	{
+		std::unique_ptr<Dictionary> dictionary;  // always set: built-ins plus whatever parsed
+		std::vector<std::string> errors;        // prefixed with the file name
+		std::vector<std::string> warnings;
+		std::size_t files{ 0 };
+		std::size_t rules{ 0 };
+	};
+
+	// a_path: one .json file, or a directory of them (name order). A missing path is not an
+	// error: the dictionary is then the built-ins.
+	[[nodiscard]] LoadResult Load(const std::filesystem::path& a_path);
+
+	namespace detail
+	{
+		extern const Dictionary g_builtin;
+		inline std::atomic<const Dictionary*> g_current{ &g_builtin };
+	}
+
+	[[nodiscard]] inline const Dictionary& Get() noexcept
+	{
+		return *detail::g_current.load(std::memory_order_acquire);
+	}
+
+	// Makes a_dictionary the current one. Replaced dictionaries are retired, not freed: an
+	// animation thread may still be probing one (the plugin publishes once, at start-up).
+	void Publish(std::unique_ptr<Dictionary> a_dictionary);
+}
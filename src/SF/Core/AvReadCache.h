@@ -0,0 +1,246 @@
+#pragma once
+
+#include "SF/Core/ActorStateStore.h"
+#include "SF/Core/AvWriteQueue.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+namespace SF::Core
+{
+	// Frame-scoped cache of the actor values the hot paths read.
+	//
+	// One light-attack spend reads stamina three or four times, a blocked hit and a parry once
+	// more each; every read is As<ActorValueOwner>() plus a virtual GetActorValue and a look at
+	// the write queue. Here the engine is asked once per actor and frame (on first access, under
+	// the actor's shard lock) and later reads that frame return the stored floats. Our own writes
+	// go through Write(), which queues them (AvWriteQueue) and adds them to the stored copy in the
+	// same critical section, so a read after a write sees it.
+	//
+	// The main thread ends the frame with NextFrame() after flushing the queue
+	// (Events/FrameHook.cpp). Engine-side changes within a frame (regen, hits from others) show up
+	// on the next one; SetVerify() cross-checks every hit against a fresh engine read.
+	enum class AvRead : std::uint8_t
+	{
+		kStamina,           // current, >= 0
+		kMaxStamina,        // base + permanent + temporary
+		kHealth,            // current
+		kAttackDamageMult,  // current
+		kTotal
+	};
+
+	class AvReadCache
+	{
+	public:
+		static constexpr std::size_t kReads = static_cast<std::size_t>(AvRead::kTotal);
+
+		// What the engine reports, filled by the caller (Engine::SkyrimActor).
+		struct EngineValues
+		{
+			std::array<float, kReads> value{};
+			float staminaDamage{ 0.0f };  // kDamage modifier of Stamina (<= 0): caps a restore
+		};
+
+		struct Counters
+		{
+			std::uint64_t hits{ 0 };
+			std::uint64_t fills{ 0 };       // engine reads (first access in a frame, or cache off)
+			std::uint64_t mismatches{ 0 };  // verify mode only
+		};
+
+		struct Mismatch
+		{
+			std::uint32_t actor{ 0 };
+			AvRead read{ AvRead::kStamina };
+			float cached{ 0.0f };
+			float live{ 0.0f };
+		};
+
+		using MismatchSink = void (*)(const Mismatch&);
+
+		// Differences below this are rounding, not staleness.
+		static constexpr float kVerifyTolerance = 0.01f;
+
+		// Entries not touched for this many frames are dropped by NextFrame().
+		static constexpr std::uint32_t kReapFrames = 256;
+
+		explicit AvReadCache(AvWriteQueue& a_queue = AvWriteQueue::GetSingleton()) noexcept :
+			_queue(a_queue)
+		{}
+
+		[[nodiscard]] static AvReadCache& GetSingleton()
+		{
+			static AvReadCache singleton;
+			return singleton;
+		}
+
+		// Disabled: every read goes to the engine.
+		void SetEnabled(bool a_enabled) noexcept { _enabled.store(a_enabled, std::memory_order_relaxed); }
+		[[nodiscard]] bool Enabled() const noexcept { return _enabled.load(std::memory_order_relaxed); }
+
+		// Debug: every hit also reads the engine and reports differences to a_sink (called under
+		// the actor's shard lock). nullptr turns it off.
+		void SetVerify(MismatchSink a_sink) noexcept { _verify.store(a_sink, std::memory_order_relaxed); }
+
+		// a_fill(EngineValues&) runs at most once per actor and frame, under the actor's shard lock.
+		template <class FillFn>
+		float Get(std::uint32_t a_actor, AvRead a_read, FillFn&& a_fill)
+		{
+			if (!Enabled()) {
+				_fills.fetch_add(1, std::memory_order_relaxed);
+				Entry live;
+				Fill(live, a_actor, a_fill);
+				return Value(live, a_read);
+			}
+
+			const std::uint32_t frame = _frame.load(std::memory_order_acquire);
+			auto st = _store.Acquire(a_actor);
+			if (st->frame != frame) {
+				_fills.fetch_add(1, std::memory_order_relaxed);
+				Fill(*st, a_actor, a_fill);
+				st->frame = frame;
+				return Value(*st, a_read);
+			}
+
+			_hits.fetch_add(1, std::memory_order_relaxed);
+			if (const auto sink = _verify.load(std::memory_order_relaxed)) {
+				Verify(a_actor, *st, a_fill, sink);
+			}
+			return Value(*st, a_read);
+		}
+
+		// A coalesced write: queued for the end-of-frame flush and visible to reads right away.
+		void Write(std::uint32_t a_actor, AvSlot a_slot, float a_delta)
+		{
+			if (a_delta == 0.0f) {
+				return;
+			}
+
+			// Both under the shard lock: a fill in between would count the delta twice or not at all.
+			// Done even while disabled, so entries are still right if the cache is turned back on.
+			const std::uint32_t frame = _frame.load(std::memory_order_acquire);
+			auto st = _store.Acquire(a_actor);
+			if (st->frame == frame) {
+				st->pending[static_cast<std::size_t>(a_slot)] += a_delta;
+			}
+			_queue.Add(a_actor, a_slot, a_delta);
+		}
+
+		// A write that bypassed the queue, or a read that must be current: the next read asks the
+		// engine again (and is cached from then on).
+		void Invalidate(std::uint32_t a_actor)
+		{
+			if (auto st = _store.Find(a_actor)) {
+				st->frame = 0;
+			}
+		}
+
+		// Main thread, after AvWriteQueue::Flush(): what was cached is now one frame old.
+		//
+		// Within a frame a cached value can miss engine-side changes (regen, vanilla power-attack
+		// drain, hits from others). Most readers can live with that. A light-attack start or spend
+		// cannot: its stamina is the session snapshot and the base of the write that enforces the
+		// cost. So LightAttackStaminaCost calls Invalidate() before those events, and that one read
+		// goes to the engine. Reads after it in the same frame (the spend's own checks, a blocked
+		// hit, a parry) are served from the refreshed entry, which includes our queued writes.
+		void NextFrame()
+		{
+			std::uint32_t frame = _frame.load(std::memory_order_relaxed) + 1;
+			if (frame == 0) {
+				frame = 1;  // 0 marks an empty entry
+			}
+			_frame.store(frame, std::memory_order_release);
+
+			if (frame % kReapFrames == 0) {
+				_store.EraseIf([frame](std::uint32_t, const Entry& a_entry) {
+					return frame - a_entry.frame > kReapFrames;
+				});
+			}
+		}
+
+		// New game / load: the cached actors may not exist any more.
+		void Clear() { _store.Clear([](std::uint32_t, Entry&) {}); }
+
+		[[nodiscard]] Counters GetCounters() const noexcept
+		{
+			return { _hits.load(std::memory_order_relaxed),
+				_fills.load(std::memory_order_relaxed),
+				_mismatches.load(std::memory_order_relaxed) };
+		}
+
+	private:
+		struct Entry
+		{
+			EngineValues engine;
+			AvWriteQueue::Pending pending{};  // our writes the engine has not applied yet
+			std::uint32_t frame{ 0 };
+		};
+
+		template <class FillFn>
+		void Fill(Entry& a_entry, std::uint32_t a_actor, FillFn& a_fill)
+		{
+			// Engine values and queued deltas from the same side of a flush.
+			_queue.ReadThrough(a_actor, [&](const AvWriteQueue::Pending& a_pending) {
+				a_fill(a_entry.engine);
+				a_entry.pending = a_pending;
+			});
+		}
+
+		template <class FillFn>
+		void Verify(std::uint32_t a_actor, const Entry& a_cached, FillFn& a_fill, MismatchSink a_sink)
+		{
+			Entry live;
+			Fill(live, a_actor, a_fill);
+			for (std::size_t i = 0; i < kReads; ++i) {
+				const auto read = static_cast<AvRead>(i);
+				const float cached = Value(a_cached, read);
+				const float now = Value(live, read);
+				if (std::fabs(cached - now) > kVerifyTolerance) {
+					_mismatches.fetch_add(1, std::memory_order_relaxed);
+					a_sink({ a_actor, read, cached, now });
+				}
+			}
+		}
+
+		// Engine value plus our pending writes, the way the engine will apply them.
+		[[nodiscard]] static float Value(const Entry& a_entry, AvRead a_read) noexcept
+		{
+			const auto engine = [&](AvRead a_av) { return a_entry.engine.value[static_cast<std::size_t>(a_av)]; };
+			const auto pending = [&](AvSlot a_slot) { return a_entry.pending[static_cast<std::size_t>(a_slot)]; };
+
+			switch (a_read) {
+			case AvRead::kStamina:
+				{
+					float damage = pending(AvSlot::kStaminaDamage);
+					if (damage > 0.0f) {
+						// Restoring never takes the damage layer above zero.
+						damage = std::min(damage, -a_entry.engine.staminaDamage);
+					}
+					return std::max(0.0f, engine(AvRead::kStamina) + damage + pending(AvSlot::kStaminaPermanent));
+				}
+			case AvRead::kMaxStamina:
+				return engine(AvRead::kMaxStamina) + pending(AvSlot::kStaminaPermanent);
+			case AvRead::kHealth:
+				return engine(AvRead::kHealth);
+			case AvRead::kAttackDamageMult:
+				return engine(AvRead::kAttackDamageMult) + pending(AvSlot::kAttackDamageMultTemporary);
+			default:
+				return 0.0f;
+			}
+		}
+
+		AvWriteQueue& _queue;
+		ActorStateStore<Entry> _store;
+
+		std::atomic<std::uint32_t> _frame{ 1 };
+		std::atomic<bool> _enabled{ true };
+		std::atomic<MismatchSink> _verify{ nullptr };
+
+		std::atomic<std::uint64_t> _hits{ 0 };
+		std::atomic<std::uint64_t> _fills{ 0 };
+		std::atomic<std::uint64_t> _mismatches{ 0 };
+	};
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "SF/Core/ActorStateStore.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace SF::Core
+{
+	// Per-frame accumulator for the actor-value writes the plugin makes.
+	//
+	// A swing, a parry drain, a jump and a blocked hit can all move an actor's stamina in the same
+	// frame, each through RestoreActorValue (engine-side recalculation + change notification every
+	// time). Instead they add a delta here, from any thread, and the main thread applies one net
+	// write per (actor, value, modifier layer) once per frame (Events/FrameHook.cpp). Writes that
+	// cancel out (a penalty applied and undone within the frame) never reach the engine.
+	//
+	// Readers that need "value after our writes" go through ReadThrough() (Core/AvReadCache.h
+	// does), so logic that reads, writes and reads again within a frame sees its own writes.
+	enum class AvSlot : std::uint8_t
+	{
+		kStaminaDamage,              // kDamage layer of Stamina
+		kStaminaPermanent,           // kPermanent layer of Stamina
+		kAttackDamageMultTemporary,  // kTemporary layer of AttackDamageMult
+		kTotal
+	};
+
+	class AvWriteQueue
+	{
+	public:
+		static constexpr std::size_t kSlots = static_cast<std::size_t>(AvSlot::kTotal);
+
+		struct Counters
+		{
+			std::uint64_t queued{ 0 };   // Add() calls
+			std::uint64_t applied{ 0 };  // net writes handed to the engine
+			std::uint64_t flushes{ 0 };
+		};
+
+		[[nodiscard]] static AvWriteQueue& GetSingleton()
+		{
+			static AvWriteQueue singleton;
+			return singleton;
+		}
+
+		void Add(std::uint32_t a_actor, AvSlot a_slot, float a_delta)
+		{
+			if (a_delta == 0.0f) {
+				return;
+			}
+			_queued.fetch_add(1, std::memory_order_relaxed);
+
+			auto st = _store.Acquire(a_actor);
+			st->delta[static_cast<std::size_t>(a_slot)] += a_delta;
+			st->touched = true;
+		}
+
+		using Pending = std::array<float, kSlots>;
+
+		// a_read(const Pending&) computes "engine value + our pending deltas". If the actor has
+		// pending writes it runs under their shard lock, so a concurrent Flush() can never be seen
+		// half-way (engine already updated, delta still counted, or the reverse).
+		template <class Read>
+		auto ReadThrough(std::uint32_t a_actor, Read&& a_read)
+		{
+			static constexpr Pending kNone{};
+			if (auto st = _store.Find(a_actor)) {
+				return a_read(static_cast<const Pending&>(st->delta));
+			}
+			return a_read(kNone);
+		}
+
+		// Main thread, once per frame. a_apply(actor, slot, netDelta) runs for every non-zero net
+		// delta under that actor's shard lock, so it must not call back into the queue. Entries of
+		// actors that wrote nothing since the previous flush are dropped. Returns the write count.
+		template <class Apply>
+		std::size_t Flush(Apply&& a_apply)
+		{
+			std::size_t writes = 0;
+			_store.EraseIf([&](std::uint32_t a_actor, Entry& a_entry) {
+				if (!a_entry.touched) {
+					return true;  // idle for a whole frame
+				}
+				for (std::size_t i = 0; i < kSlots; ++i) {
+					if (const float d = a_entry.delta[i]; d != 0.0f) {
+						a_apply(a_actor, static_cast<AvSlot>(i), d);
+						++writes;
+					}
+				}
+				a_entry = {};
+				return false;
+			});
+
+			_applied.fetch_add(writes, std::memory_order_relaxed);
+			_flushes.fetch_add(1, std::memory_order_relaxed);
+			return writes;
+		}
+
+		[[nodiscard]] Counters GetCounters() const noexcept
+		{
+			return { _queued.load(std::memory_order_relaxed),
+				_applied.load(std::memory_order_relaxed),
+				_flushes.load(std::memory_order_relaxed) };
+		}
+
+	private:
+		struct Entry
+		{
+			Pending delta{};
+			bool touched{ false };
+		};
+
+		ActorStateStore<Entry> _store;
+
+		std::atomic<std::uint64_t> _queued{ 0 };
+		std::atomic<std::uint64_t> _applied{ 0 };
+		std::atomic<std::uint64_t> _flushes{ 0 };
+	};
+}
@@ -0,0 +1,34 @@
+#include "SF/Core/Clock.h"
+
+#include <chrono>
+
+namespace SF::Core::Clock
+{
+	namespace detail
+	{
+		Ms SteadyMs() noexcept
+		{
+			using namespace std::chrono;
+			return static_cast<Ms>(duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+		}
+	}
+
+	void NextFrame() noexcept
+	{
+		detail::g_frameMs.store(PreciseMs(), std::memory_order_relaxed);
+		detail::g_frame.fetch_add(1, std::memory_order_release);
+	}
+
+	Fake::Fake(Ms a_startMs) noexcept
+	{
+		detail::g_fakeMs.store(a_startMs, std::memory_order_relaxed);
+		detail::g_frame.store(0, std::memory_order_relaxed);
+		detail::g_fake.store(true, std::memory_order_relaxed);
+	}
+
+	Fake::~Fake()
+	{
+		detail::g_fake.store(false, std::memory_order_relaxed);
+		detail::g_frame.store(0, std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace SF::Core::Clock
+{
+	// The plugin's one notion of "now".
+	//
+	// Every window the gameplay code compares (unarmed pairing, explicit hand, session timeout,
+	// damage penalty, key debounce, cache TTL) is a difference of two Ms values. Ms is 64-bit
+	// monotonic milliseconds, so `now - then` never wraps (a 32-bit count did after 49.7 days
+	// of uptime).
+	//
+	// FrameMs() is what the hot paths read: one relaxed load of the time the main thread took at
+	// the last NextFrame() (Events/FrameHook.cpp), the same value for every event of a frame.
+	// PreciseMs() asks the clock itself, for the few places that measure within a frame.
+	//
+	// The source is injectable: with a Fake installed, both read the fake time and nothing
+	// moves unless the test says so.
+
+	using Ms = std::uint64_t;
+
+	namespace detail
+	{
+		inline std::atomic<Ms> g_frameMs{ 0 };
+		inline std::atomic<std::uint64_t> g_frame{ 0 };
+		inline std::atomic<bool> g_fake{ false };
+		inline std::atomic<Ms> g_fakeMs{ 0 };
+
+		[[nodiscard]] Ms SteadyMs() noexcept;
+	}
+
+	[[nodiscard]] inline Ms PreciseMs() noexcept
+	{
+		if (detail::g_fake.load(std::memory_order_relaxed)) {
+			return detail::g_fakeMs.load(std::memory_order_relaxed);
+		}
+		return detail::SteadyMs();
+	}
+
+	// Time of the current frame. Before the first NextFrame() (start-up, tools) it is PreciseMs().
+	[[nodiscard]] inline Ms FrameMs() noexcept
+	{
+		if (detail::g_frame.load(std::memory_order_acquire) == 0) {
+			return PreciseMs();  // acquire: a non-zero frame count comes with its time
+		}
+		return detail::g_frameMs.load(std::memory_order_relaxed);
+	}
+
+	// Frames started since start-up (or since a Fake was installed).
+	[[nodiscard]] inline std::uint64_t Frame() noexcept
+	{
+		return detail::g_frame.load(std::memory_order_relaxed);
+	}
+
+	// Main thread, once per frame, before anything that reads the frame time.
+	void NextFrame() noexcept;
+
+	// Deterministic time for tests and replays. One at a time; restores the real clock when
+	// destroyed. Starts an hour in so that zero-initialised timestamps read as "long ago", as
+	// they do in game.
+	class Fake
+	{
+	public:
+		static constexpr Ms kDefaultStartMs = 60 * 60 * 1000;
+
+		explicit Fake(Ms a_startMs = kDefaultStartMs) noexcept;
+		~Fake();
+
+		Fake(const Fake&) = delete;
+		Fake& operator=(const Fake&) = delete;
+
+		void Set(Ms a_nowMs) noexcept { detail::g_fakeMs.store(a_nowMs, std::memory_order_relaxed); }
+		void Advance(Ms a_ms) noexcept { detail::g_fakeMs.fetch_add(a_ms, std::memory_order_relaxed); }
+		[[nodiscard]] Ms Now() const noexcept { return detail::g_fakeMs.load(std::memory_order_relaxed); }
+
+		// Advance by a_frameMs and start a frame, like one pass of the frame hook.
+		void Step(Ms a_frameMs = 16) noexcept
+		{
+			Advance(a_frameMs);
+			NextFrame();
+		}
+	};
+}
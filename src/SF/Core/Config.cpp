@@ -0,0 +1,425 @@
+#include "SF/Core/Config.h"
+
+#include "SF/Core/Clock.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <utility>
+
+namespace SF::Core::Config
+{
+	namespace detail
+	{
+		const Snapshot g_defaults{};
+	}
+
+	namespace
+	{
+		enum class Type : std::uint8_t
+		{
+			kFloat,
+			kUInt,
+			kInt,
+			kBool,
+			kString,
+			kAccepted,  // known key owned by someone else (log settings): no warning, no value
+		};
+
+		struct Field
+		{
+			std::string_view key;
+			Type type;
+			double min;
+			double max;
+			void* (*member)(Snapshot&);
+		};
+
+#define SF_CONFIG_FIELD(a_key, a_type, a_min, a_max, a_member) \
+	Field { a_key, Type::a_type, a_min, a_max, [](Snapshot& s) -> void* { return &s.a_member; } }
+
+		// The schema. Ranges are sanity bounds, not gameplay advice.
+		const std::array kSchema{
+			SF_CONFIG_FIELD("LightAttack.BaseUnarmed", kFloat, 0.0, 1000.0, lightAttack.baseUnarmed),
+			SF_CONFIG_FIELD("LightAttack.BaseWeapon", kFloat, 0.0, 1000.0, lightAttack.baseWeapon),
+			SF_CONFIG_FIELD("LightAttack.WeaponWeightMult", kFloat, 0.0, 100.0, lightAttack.weaponWeightMult),
+			SF_CONFIG_FIELD("LightAttack.PowerAttackMult", kFloat, 0.0, 100.0, lightAttack.powerAttackMult),
+			SF_CONFIG_FIELD("LightAttack.DamagePenaltyWindowMs", kUInt, 0.0, 10000.0, lightAttack.damagePenaltyWindowMs),
+			SF_CONFIG_FIELD("LightAttack.UnarmedPairWindowMs", kUInt, 0.0, 10000.0, lightAttack.unarmedPairWindowMs),
+			SF_CONFIG_FIELD("LightAttack.ExplicitHandWindowMs", kUInt, 0.0, 10000.0, lightAttack.explicitHandWindowMs),
+			SF_CONFIG_FIELD("LightAttack.SessionTimeoutMs", kUInt, 1.0, 60000.0, lightAttack.sessionTimeoutMs),
+			SF_CONFIG_FIELD("WeaponCostOverrides", kString, 0.0, 0.0, lightAttack.weaponCostOverrides),
+
+			SF_CONFIG_FIELD("Jump.StaminaCost", kFloat, 0.0, 1000.0, jump.staminaCost),
+
+			SF_CONFIG_FIELD("BlockKey", kInt, 0.0, 511.0, dualWielding.blockKey),
+			SF_CONFIG_FIELD("BashKey", kInt, 0.0, 511.0, dualWielding.parryKey),
+			SF_CONFIG_FIELD("Parry.ModifierKey", kInt, 0.0, 511.0, dualWielding.parryModifierKey),
+			SF_CONFIG_FIELD("Parry.HoldMs", kUInt, 0.0, 10000.0, dualWielding.parryHoldMs),
+			SF_CONFIG_FIELD("Parry.StaminaCost", kFloat, 0.0, 1000.0, dualWielding.parryStaminaCost),
+			SF_CONFIG_FIELD("Parry.DebounceMs", kUInt, 0.0, 10000.0, dualWielding.parryDebounceMs),
+
+			SF_CONFIG_FIELD("Shield.StaminaDamageMult", kFloat, 0.01, 100.0, shield.staminaDamageMult),
+			SF_CONFIG_FIELD("Shield.PlayerMult", kFloat, 0.01, 100.0, shield.playerMult),
+			SF_CONFIG_FIELD("Shield.NPCMult", kFloat, 0.01, 100.0, shield.npcMult),
+			SF_CONFIG_FIELD("Shield.ShieldBlockMult", kFloat, 0.01, 100.0, shield.shieldBlockMult),
+			SF_CONFIG_FIELD("Shield.WeaponBlockMult", kFloat, 0.01, 100.0, shield.weaponBlockMult),
+			SF_CONFIG_FIELD("Shield.UnarmedMult", kFloat, 0.01, 100.0, shield.unarmedMult),
+			SF_CONFIG_FIELD("Shield.OneHandMult", kFloat, 0.01, 100.0, shield.oneHandMult),
+			SF_CONFIG_FIELD("Shield.TwoHandMult", kFloat, 0.01, 100.0, shield.twoHandMult),
+			SF_CONFIG_FIELD("Shield.RangedMult", kFloat, 0.01, 100.0, shield.rangedMult),
+			SF_CONFIG_FIELD("Shield.GuardBreakThreshold", kFloat, 0.0, 100000.0, shield.guardBreakThreshold),
+			SF_CONFIG_FIELD("Shield.GuardBreakStagger", kFloat, 0.0, 1.0, shield.guardBreakStagger),
+
+			SF_CONFIG_FIELD("FlightRecorder", kBool, 0.0, 0.0, trace.flightRecorder),
+			SF_CONFIG_FIELD("TraceDumpKey", kInt, 0.0, 511.0, trace.dumpKey),
+
+			SF_CONFIG_FIELD("PerkMultCache", kBool, 0.0, 0.0, perkMultCache.enabled),
+			SF_CONFIG_FIELD("PerkMultCacheTTLMs", kUInt, 0.0, 600000.0, perkMultCache.ttlMs),
+
+			SF_CONFIG_FIELD("ActorValues.CoalesceWrites", kBool, 0.0, 0.0, actorValues.coalesceWrites),
+			SF_CONFIG_FIELD("ActorValues.ReadCache", kBool, 0.0, 0.0, actorValues.readCache),
+			SF_CONFIG_FIELD("ActorValues.VerifyReadCache", kBool, 0.0, 0.0, actorValues.verifyReadCache),
+
+			SF_CONFIG_FIELD("AnimEvents.FullPathRadius", kFloat, 0.0, 1000000.0, animEvents.fullPathRadius),
+			SF_CONFIG_FIELD("AnimEvents.CombatDetachDelayMs", kUInt, 0.0, 600000.0, animEvents.combatDetachDelayMs),
+
+			SF_CONFIG_FIELD("Latency.Enabled", kBool, 0.0, 0.0, latency.enabled),
+			SF_CONFIG_FIELD("Latency.ReportIntervalSec", kUInt, 0.0, 86400.0, latency.reportIntervalSec),
+
+			SF_CONFIG_FIELD("Telemetry.PublishMs", kUInt, 0.0, 60000.0, telemetry.publishMs),
+		};
+
+#undef SF_CONFIG_FIELD
+
+		bool IsLogKey(std::string_view a_key)
+		{
+			return a_key == "LogLevel" || a_key.starts_with("LogLevel.") || a_key == "LogMaxFileKB" || a_key == "LogMaxFiles";
+		}
+
+		const Field* FindField(std::string_view a_key)
+		{
+			for (const auto& f : kSchema) {
+				if (f.key == a_key) {
+					return &f;
+				}
+			}
+			return nullptr;
+		}
+
+		// Flat JSON object: {"key": number | "string" | true | false | null, ...}
+		class Parser
+		{
+		public:
+			Parser(std::string_view a_text, ParseResult& a_out) :
+				_text(a_text),
+				_out(a_out)
+			{}
+
+			void Run()
+			{
+				SkipSpace();
+				if (Done()) {
+					return;  // empty file: defaults
+				}
+				if (!Consume('{')) {
+					Error("expected '{' at offset %zu");
+					return;
+				}
+
+				SkipSpace();
+				if (Consume('}')) {
+					return;
+				}
+
+				while (true) {
+					std::string key;
+					SkipSpace();
+					if (!String(key)) {
+						Error("expected a key at offset %zu");
+						return;
+					}
+					SkipSpace();
+					if (!Consume(':')) {
+						Error("expected ':' at offset %zu");
+						return;
+					}
+					SkipSpace();
+					if (!Value(key)) {
+						return;
+					}
+					SkipSpace();
+					if (Consume(',')) {
+						continue;
+					}
+					if (Consume('}')) {
+						return;
+					}
+					Error("expected ',' or '}' at offset %zu");
+					return;
+				}
+			}
+
+		private:
+			bool Done() const { return _pos >= _text.size(); }
+
+			bool Consume(char a_c)
+			{
+				if (!Done() && _text[_pos] == a_c) {
+					++_pos;
+					return true;
+				}
+				return false;
+			}
+
+			void SkipSpace()
+			{
+				while (!Done() && std::isspace(static_cast<unsigned char>(_text[_pos]))) {
+					++_pos;
+				}
+			}
+
+			// a_fmt takes the offset (%zu).
+			void Error(const char* a_fmt)
+			{
+				char buf[128];
+				std::snprintf(buf, sizeof(buf), a_fmt, _pos);
+				_out.errors.emplace_back(buf);
+				_out.malformed = true;
+			}
+
+			bool String(std::string& a_out)
+			{
+				if (!Consume('"')) {
+					return false;
+				}
+				while (!Done()) {
+					const char c = _text[_pos++];
+					if (c == '"') {
+						return true;
+					}
+					if (c == '\\' && !Done()) {
+						const char e = _text[_pos++];
+						a_out += e == 'n' ? '\n' : e == 't' ? '\t' : e;
+						continue;
+					}
+					a_out += c;
+				}
+				return false;
+			}
+
+			// Skips a nested object/array (not part of the schema).
+			bool SkipNested()
+			{
+				int depth = 0;
+				while (!Done()) {
+					const char c = _text[_pos];
+					if (c == '"') {
+						std::string ignored;
+						if (!String(ignored)) {
+							return false;
+						}
+						continue;
+					}
+					++_pos;
+					if (c == '{' || c == '[') {
+						++depth;
+					} else if ((c == '}' || c == ']') && --depth == 0) {
+						return true;
+					}
+				}
+				return false;
+			}
+
+			bool Value(const std::string& a_key)
+			{
+				const Field* field = FindField(a_key);
+				if (!field && !IsLogKey(a_key)) {
+					_out.warnings.push_back("unknown key \"" + a_key + "\"");
+				}
+				if (!field && IsLogKey(a_key)) {
+					static const Field kAccepted{ {}, Type::kAccepted, 0.0, 0.0, nullptr };
+					field = &kAccepted;
+				}
+
+				if (Done()) {
+					Error("unexpected end of file at offset %zu");
+					return false;
+				}
+
+				const char c = _text[_pos];
+				if (c == '"') {
+					std::string s;
+					if (!String(s)) {
+						Error("unterminated string at offset %zu");
+						return false;
+					}
+					if (field && field->type == Type::kString) {
+						*static_cast<std::string*>(field->member(*_out.snapshot)) = std::move(s);
+					} else if (field && field->type != Type::kAccepted) {
+						TypeError(a_key, "a string");
+					}
+					return true;
+				}
+
+				if (c == '{' || c == '[') {
+					if (!SkipNested()) {
+						Error("unterminated object/array at offset %zu");
+						return false;
+					}
+					if (field && field->type != Type::kAccepted) {
+						TypeError(a_key, "an object/array");
+					}
+					return true;
+				}
+
+				if (_text.substr(_pos).starts_with("true") || _text.substr(_pos).starts_with("false")) {
+					const bool v = _text[_pos] == 't';
+					_pos += v ? 4 : 5;
+					if (field && field->type == Type::kBool) {
+						*static_cast<bool*>(field->member(*_out.snapshot)) = v;
+					} else if (field && field->type != Type::kAccepted) {
+						TypeError(a_key, "a bool");
+					}
+					return true;
+				}
+
+				if (_text.substr(_pos).starts_with("null")) {
+					_pos += 4;
+					return true;  // explicit default
+				}
+
+				// Number
+				const std::string token{ _text.substr(_pos, std::min<std::size_t>(64, _text.size() - _pos)) };
+				char* end = nullptr;
+				const double v = std::strtod(token.c_str(), &end);
+				if (end == token.c_str()) {
+					Error("invalid value at offset %zu");
+					return false;
+				}
+				_pos += static_cast<std::size_t>(end - token.c_str());
+
+				if (field && field->type != Type::kAccepted) {
+					Number(*field, v);
+				}
+				return true;
+			}
+
+			void Number(const Field& a_field, double a_value)
+			{
+				if (a_field.type == Type::kString) {
+					TypeError(a_field.key, "a number");
+					return;
+				}
+
+				if (a_field.type == Type::kBool) {
+					// "FlightRecorder": 0/1 has always been the documented form.
+					*static_cast<bool*>(a_field.member(*_out.snapshot)) = a_value != 0.0;
+					return;
+				}
+
+				const bool integral = a_field.type != Type::kFloat;
+				if (!std::isfinite(a_value) || (integral && a_value != std::floor(a_value))) {
+					TypeError(a_field.key, integral ? "a non-integer" : "not a finite number");
+					return;
+				}
+				if (a_value < a_field.min || a_value > a_field.max) {
+					char buf[256];
+					std::snprintf(buf, sizeof(buf), "\"%.*s\" = %g is outside [%g, %g], default kept",
+						static_cast<int>(a_field.key.size()), a_field.key.data(), a_value, a_field.min, a_field.max);
+					_out.errors.emplace_back(buf);
+					return;
+				}
+
+				void* dst = a_field.member(*_out.snapshot);
+				switch (a_field.type) {
+				case Type::kFloat:
+					*static_cast<float*>(dst) = static_cast<float>(a_value);
+					break;
+				case Type::kUInt:
+					*static_cast<std::uint32_t*>(dst) = static_cast<std::uint32_t>(a_value);
+					break;
+				case Type::kInt:
+					*static_cast<int*>(dst) = static_cast<int>(a_value);
+					break;
+				default:
+					break;
+				}
+			}
+
+			void TypeError(std::string_view a_key, const char* a_what)
+			{
+				char buf[256];
+				std::snprintf(buf, sizeof(buf), "\"%.*s\" is %s, default kept", static_cast<int>(a_key.size()), a_key.data(), a_what);
+				_out.errors.emplace_back(buf);
+			}
+
+			std::string_view _text;
+			ParseResult& _out;
+			std::size_t _pos{ 0 };
+		};
+
+		struct Retired
+		{
+			std::unique_ptr<Snapshot> snapshot;
+			std::uint64_t frame{ 0 };  // Clock::Frame() when it was replaced
+		};
+
+		std::mutex g_publishLock;
+		std::unique_ptr<Snapshot> g_live;  // what g_current points to, once something was published
+		std::vector<Retired> g_retired;
+		std::atomic<std::size_t> g_retiredCount{ 0 };  // lets CollectRetired() skip the lock
+		std::uint64_t g_version{ 0 };
+
+		// g_publishLock held.
+		std::size_t CollectLocked()
+		{
+			const auto now = Clock::Frame();
+			const auto freed = std::erase_if(g_retired, [now](const Retired& a_retired) {
+				return now >= a_retired.frame + kRetireFrames;
+			});
+			g_retiredCount.store(g_retired.size(), std::memory_order_relaxed);
+			return freed;
+		}
+	}
+
+	ParseResult Parse(std::string_view a_text)
+	{
+		ParseResult out;
+		out.snapshot = std::make_unique<Snapshot>();
+		Parser{ a_text, out }.Run();
+		return out;
+	}
+
+	std::uint64_t Publish(std::unique_ptr<Snapshot> a_snapshot)
+	{
+		std::scoped_lock _{ g_publishLock };
+		a_snapshot->version = ++g_version;
+		detail::g_current.store(a_snapshot.get(), std::memory_order_release);
+
+		if (auto old = std::exchange(g_live, std::move(a_snapshot))) {
+			g_retired.push_back({ std::move(old), Clock::Frame() });
+		}
+		CollectLocked();
+		return g_version;
+	}
+
+	std::size_t CollectRetired()
+	{
+		if (g_retiredCount.load(std::memory_order_relaxed) == 0) {
+			return 0;
+		}
+		std::scoped_lock _{ g_publishLock };
+		return CollectLocked();
+	}
+
+	std::uint64_t Version() noexcept
+	{
+		std::scoped_lock _{ g_publishLock };
+		return g_version;
+	}
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace SF::Core::Config
+{
+	// Every module's tunables, parsed from SunderForge.json in one pass against a schema
+	// (Config.cpp) into an immutable snapshot.
+	//
+	// Readers: `const auto& cfg = Config::Get();` - one acquire load, no lock. Keep the reference
+	// for the duration of one event so the event sees a consistent set of values.
+	// Reload: Publish() swaps in a whole new snapshot. The old one is retired with the current
+	// frame number (Clock::Frame()) and freed by CollectRetired() kRetireFrames later, long after
+	// any event that could still hold it has returned. So a reference must not outlive the event
+	// (or be kept across a co_await), and code that remembers which snapshot it applied keeps the
+	// version, not the address: a freed snapshot's address can come back.
+	//
+	// Keys are flat, "Section.Name"; the older un-prefixed keys (BlockKey, BashKey, FlightRecorder,
+	// TraceDumpKey, PerkMultCache*, WeaponCostOverrides) keep working. "LogLevel*"/"LogMax*" are
+	// read by Log::ParseSettings before anything else starts and are only accepted here.
+	struct Snapshot
+	{
+		struct LightAttack
+		{
+			float baseUnarmed{ 6.0f };      // Base cost for unarmed attacks
+			float baseWeapon{ 6.0f };       // Base cost for weapon attacks
+			float weaponWeightMult{ 1.0f };  // Additional cost per weapon weight unit
+			float powerAttackMult{ 2.0f };
+
+			std::uint32_t damagePenaltyWindowMs{ 200 };  // "damage scaled" window after a low-stamina start
+			std::uint32_t unarmedPairWindowMs{ 80 };     // SoundPlay.WPNSwingUnarmed -> weaponSwing
+			std::uint32_t explicitHandWindowMs{ 250 };   // recent explicit hand tag resolves weaponSwing
+			std::uint32_t sessionTimeoutMs{ 800 };       // failsafe if the graph never emits a spend tag
+
+			std::string weaponCostOverrides;  // "KeywordEditorID=cost, ..." (WeaponCostTable.h)
+		};
+
+		struct Jump
+		{
+			float staminaCost{ 5.0f };
+		};
+
+		struct DualWielding
+		{
+			int blockKey{ 47 };
+			int parryKey{ 48 };
+			int parryModifierKey{ 0 };  // chord: held together with parryKey, 0 = none
+			std::uint32_t parryHoldMs{ 0 };  // 0 = parry on press, otherwise once held this long
+			float parryStaminaCost{ 20.0f };
+			std::uint32_t parryDebounceMs{ 120 };
+		};
+
+		// Blocked-hit stamina policy (Logic/BlockedHit.h). Every factor multiplies staminaDamageMult;
+		// a group left at 1.0 (or a 0 threshold) is compiled out of the per-hit path.
+		struct Shield
+		{
+			float staminaDamageMult{ 1.0f };  // stamina per point of blocked damage
+
+			float playerMult{ 1.0f };  // defender is the player
+			float npcMult{ 1.0f };     // defender is an NPC
+
+			float shieldBlockMult{ 1.0f };
+			float weaponBlockMult{ 1.0f };
+
+			float unarmedMult{ 1.0f };  // attacker's weapon class
+			float oneHandMult{ 1.0f };
+			float twoHandMult{ 1.0f };
+			float rangedMult{ 1.0f };
+
+			float guardBreakThreshold{ 0.0f };  // stamina damage that breaks an emptied guard; 0 = off
+			float guardBreakStagger{ 0.5f };    // StaggerMagnitude on a guard break
+		};
+
+		struct Trace
+		{
+			bool flightRecorder{ true };
+			int dumpKey{ 0x44 };  // DIK_F10, 0 = off
+		};
+
+		struct PerkMultCache
+		{
+			bool enabled{ true };
+			std::uint32_t ttlMs{ 500 };  // 0 = until invalidated
+		};
+
+		struct ActorValues
+		{
+			bool coalesceWrites{ true };  // one net AV write per actor/layer per frame (Core/AvWriteQueue.h)
+			bool readCache{ true };       // AV reads served from a per-frame cache (Core/AvReadCache.h)
+			bool verifyReadCache{ false };  // debug: cross-check cached reads against the engine, log differences
+		};
+
+		struct AnimEvents
+		{
+			float fullPathRadius{ 4096.0f };             // combat actors farther from the player get the reduced path
+			std::uint32_t combatDetachDelayMs{ 10000 };  // keep the sink this long after combat ends
+		};
+
+		struct Latency
+		{
+			bool enabled{ true };                 // hook/sink timing histograms (Core/Latency.h)
+			std::uint32_t reportIntervalSec{ 0 };  // also log the report this often; 0 = on the dump key only
+		};
+
+		struct Telemetry
+		{
+			std::uint32_t publishMs{ 250 };  // shared-memory telemetry (Core/Telemetry.h) refresh; 0 = off
+		};
+
+		LightAttack lightAttack;
+		Jump jump;
+		DualWielding dualWielding;
+		Shield shield;
+		Trace trace;
+		PerkMultCache perkMultCache;
+		ActorValues actorValues;
+		AnimEvents animEvents;
+		Latency latency;
+		Telemetry telemetry;
+
+		std::uint64_t version{ 0 };  // set by Publish(); 0 = the built-in defaults
+	};
+
+	struct ParseResult
+	{
+		std::unique_ptr<Snapshot> snapshot;  // always set; invalid values keep their defaults
+		std::vector<std::string> errors;      // malformed JSON, wrong types, out of range
+		std::vector<std::string> warnings;    // unknown keys (typos)
+		bool malformed{ false };              // not valid JSON: callers keep the current snapshot
+	};
+
+	[[nodiscard]] ParseResult Parse(std::string_view a_text);
+
+	namespace detail
+	{
+		extern const Snapshot g_defaults;
+		inline std::atomic<const Snapshot*> g_current{ &g_defaults };
+	}
+
+	[[nodiscard]] inline const Snapshot& Get() noexcept
+	{
+		return *detail::g_current.load(std::memory_order_acquire);
+	}
+
+	// Frames a replaced snapshot is kept before CollectRetired() frees it.
+	inline constexpr std::uint64_t kRetireFrames = 120;
+
+	// Makes a_snapshot the current one. Returns the new version (1 for the first publish).
+	std::uint64_t Publish(std::unique_ptr<Snapshot> a_snapshot);
+
+	// Frees the snapshots retired at least kRetireFrames frames ago; returns how many. Main thread,
+	// once per frame (Events/FrameHook.cpp); Publish() collects too. Without a frame loop (tools
+	// that never call Clock::NextFrame()) nothing is old enough and retired snapshots are kept.
+	std::size_t CollectRetired();
+
+	[[nodiscard]] std::uint64_t Version() noexcept;
+}
@@ -0,0 +1,94 @@
+#include "SF/Core/ConfigText.h"
+
+#include <cctype>
+#include <fstream>
+
+namespace SF::Core::ConfigText
+{
+	namespace
+	{
+		// Position right after `"key":` and any whitespace, or npos.
+		std::size_t FindValue(std::string_view a_text, std::string_view a_key)
+		{
+			std::string needle;
+			needle.reserve(a_key.size() + 2);
+			needle += '"';
+			needle += a_key;
+			needle += '"';
+
+			auto pos = a_text.find(needle);
+			if (pos == std::string_view::npos) {
+				return std::string_view::npos;
+			}
+			pos = a_text.find(':', pos + needle.size());
+			if (pos == std::string_view::npos) {
+				return std::string_view::npos;
+			}
+			pos++;
+			while (pos < a_text.size() && std::isspace(static_cast<unsigned char>(a_text[pos]))) {
+				pos++;
+			}
+			return pos;
+		}
+	}
+
+	std::string ReadAllText(const std::filesystem::path& a_path)
+	{
+		std::ifstream ifs(a_path, std::ios::binary);
+		if (!ifs.is_open()) {
+			return {};
+		}
+		std::string s;
+		ifs.seekg(0, std::ios::end);
+		s.resize(static_cast<size_t>(ifs.tellg()));
+		ifs.seekg(0, std::ios::beg);
+		ifs.read(s.data(), static_cast<std::streamsize>(s.size()));
+		return s;
+	}
+
+	bool ExtractInt(std::string_view a_text, std::string_view a_key, int& a_out)
+	{
+		auto pos = FindValue(a_text, a_key);
+		if (pos == std::string_view::npos) {
+			return false;
+		}
+
+		bool neg = false;
+		if (pos < a_text.size() && a_text[pos] == '-') {
+			neg = true;
+			pos++;
+		}
+
+		long long val = 0;
+		bool any = false;
+		while (pos < a_text.size() && a_text[pos] >= '0' && a_text[pos] <= '9') {
+			any = true;
+			val = (val * 10) + (a_text[pos] - '0');
+			pos++;
+		}
+
+		if (!any) {
+			return false;
+		}
+
+		a_out = static_cast<int>(neg ? -val : val);
+		return true;
+	}
+
+	bool ExtractString(std::string_view a_text, std::string_view a_key, std::string& a_out)
+	{
+		auto pos = FindValue(a_text, a_key);
+		if (pos == std::string_view::npos || pos >= a_text.size() || a_text[pos] != '"') {
+			return false;
+		}
+		pos++;
+
+		const auto end = a_text.find('"', pos);
+		if (end == std::string_view::npos) {
+			return false;
+		}
+
+		a_out.assign(a_text.substr(pos, end - pos));
+		return true;
+	}
+}
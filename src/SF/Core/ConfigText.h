@@ -0,0 +1,16 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace SF::Core::ConfigText
+{
+	// Minimal helpers for our flat SunderForge.json: whole-file read plus "key": value lookups.
+	// Keys are matched with their quotes, so "LogLevel" does not match "LogLevel.Jump".
+
+	[[nodiscard]] std::string ReadAllText(const std::filesystem::path& a_path);
+
+	bool ExtractInt(std::string_view a_text, std::string_view a_key, int& a_out);
+	bool ExtractString(std::string_view a_text, std::string_view a_key, std::string& a_out);
+}
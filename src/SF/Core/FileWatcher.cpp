@@ -0,0 +1,289 @@
+#include "SF/Core/FileWatcher.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <system_error>
+
+#ifdef _WIN32
+#	include <windows.h>
+#elif defined(__linux__)
+#	include <poll.h>
+#	include <sys/eventfd.h>
+#	include <sys/inotify.h>
+#	include <unistd.h>
+#endif
+
+namespace SF::Core
+{
+	namespace
+	{
+		struct Stamp
+		{
+			bool exists{ false };
+			std::filesystem::file_time_type writeTime{};
+			std::uintmax_t size{ 0 };
+
+			bool operator==(const Stamp&) const = default;
+		};
+
+		Stamp StampOf(const std::filesystem::path& a_file)
+		{
+			std::error_code ec;
+			Stamp s;
+			s.writeTime = std::filesystem::last_write_time(a_file, ec);
+			if (ec) {
+				return {};
+			}
+			s.size = std::filesystem::file_size(a_file, ec);
+			if (ec) {
+				return {};
+			}
+			s.exists = true;
+			return s;
+		}
+
+		enum class Wake : std::uint8_t
+		{
+			kChanged,  // something in the directory changed (maybe not our file)
+			kTimeout,
+			kStopped,
+		};
+	}
+
+	// One OS wait primitive per backend plus the stop signal. Stop() only touches `stop` and
+	// the wake handle, both valid until the thread is joined.
+	struct FileWatcher::Impl
+	{
+		std::atomic<bool> stop{ false };
+
+		// Polling backend (and the stop signal for it).
+		std::mutex lock;
+		std::condition_variable cv;
+
+#ifdef _WIN32
+		HANDLE change{ INVALID_HANDLE_VALUE };
+		HANDLE wake{ nullptr };
+#elif defined(__linux__)
+		int inotify{ -1 };
+		int wake{ -1 };
+		std::string fileName;
+#endif
+
+		~Impl()
+		{
+#ifdef _WIN32
+			if (change != INVALID_HANDLE_VALUE) {
+				::FindCloseChangeNotification(change);
+			}
+			if (wake) {
+				::CloseHandle(wake);
+			}
+#elif defined(__linux__)
+			if (inotify >= 0) {
+				::close(inotify);
+			}
+			if (wake >= 0) {
+				::close(wake);
+			}
+#endif
+		}
+
+		// Returns the backend name; "poll" when the OS one could not be set up.
+		const char* Open(const std::filesystem::path& a_file, bool a_forcePolling)
+		{
+			if (a_forcePolling) {
+				return "poll";
+			}
+
+			const auto dir = a_file.has_parent_path() ? a_file.parent_path() : std::filesystem::path{ "." };
+
+#ifdef _WIN32
+			wake = ::CreateEventW(nullptr, TRUE, FALSE, nullptr);
+			change = ::FindFirstChangeNotificationW(dir.c_str(), FALSE,
+				FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE);
+			if (wake && change != INVALID_HANDLE_VALUE) {
+				return "FindFirstChangeNotification";
+			}
+#elif defined(__linux__)
+			fileName = a_file.filename().string();
+			wake = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+			inotify = ::inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+			if (wake >= 0 && inotify >= 0 &&
+				::inotify_add_watch(inotify, dir.c_str(),
+					IN_CLOSE_WRITE | IN_MODIFY | IN_ATTRIB | IN_CREATE | IN_DELETE | IN_MOVED_TO | IN_MOVED_FROM) >= 0) {
+				return "inotify";
+			}
+			if (inotify >= 0) {
+				::close(inotify);
+				inotify = -1;
+			}
+#endif
+			return "poll";
+		}
+
+		bool Polling() const noexcept
+		{
+#ifdef _WIN32
+			return change == INVALID_HANDLE_VALUE;
+#elif defined(__linux__)
+			return inotify < 0;
+#else
+			return true;
+#endif
+		}
+
+		// a_timeout < 0: wait until something happens.
+		Wake Wait(std::chrono::milliseconds a_timeout)
+		{
+			if (stop.load(std::memory_order_acquire)) {
+				return Wake::kStopped;
+			}
+
+			if (Polling()) {
+				std::unique_lock guard{ lock };
+				const auto stopped = [this] { return stop.load(std::memory_order_acquire); };
+				if (a_timeout.count() < 0) {
+					cv.wait(guard, stopped);
+					return Wake::kStopped;
+				}
+				return cv.wait_for(guard, a_timeout, stopped) ? Wake::kStopped : Wake::kTimeout;
+			}
+
+#ifdef _WIN32
+			const HANDLE handles[]{ change, wake };
+			const DWORD ms = a_timeout.count() < 0 ? INFINITE : static_cast<DWORD>(a_timeout.count());
+			switch (::WaitForMultipleObjects(2, handles, FALSE, ms)) {
+			case WAIT_OBJECT_0:
+				::FindNextChangeNotification(change);  // re-arm
+				return Wake::kChanged;
+			case WAIT_TIMEOUT:
+				return Wake::kTimeout;
+			default:
+				return Wake::kStopped;
+			}
+#elif defined(__linux__)
+			pollfd fds[]{ { inotify, POLLIN, 0 }, { wake, POLLIN, 0 } };
+			const int ms = a_timeout.count() < 0 ? -1 : static_cast<int>(a_timeout.count());
+			const int n = ::poll(fds, 2, ms);
+			if (n == 0) {
+				return Wake::kTimeout;
+			}
+			if (n < 0 || (fds[1].revents & POLLIN) || stop.load(std::memory_order_acquire)) {
+				return Wake::kStopped;
+			}
+
+			// Drain the queue; only events naming our file count.
+			bool ours = false;
+			alignas(inotify_event) char buf[4096];
+			for (ssize_t len; (len = ::read(inotify, buf, sizeof(buf))) > 0;) {
+				for (ssize_t off = 0; off < len;) {
+					const auto* ev = reinterpret_cast<const inotify_event*>(buf + off);
+					if (ev->len && fileName == ev->name) {
+						ours = true;
+					}
+					off += static_cast<ssize_t>(sizeof(inotify_event) + ev->len);
+				}
+			}
+			return ours ? Wake::kChanged : Wake::kTimeout;
+#else
+			return Wake::kStopped;
+#endif
+		}
+
+		void Signal()
+		{
+			stop.store(true, std::memory_order_release);
+			{
+				std::scoped_lock guard{ lock };
+			}
+			cv.notify_all();
+#ifdef _WIN32
+			if (wake) {
+				::SetEvent(wake);
+			}
+#elif defined(__linux__)
+			if (wake >= 0) {
+				const std::uint64_t one = 1;
+				[[maybe_unused]] const auto written = ::write(wake, &one, sizeof(one));
+			}
+#endif
+		}
+	};
+
+	FileWatcher::FileWatcher() = default;
+
+	FileWatcher::~FileWatcher()
+	{
+		Stop();
+	}
+
+	bool FileWatcher::Start(std::filesystem::path a_file, Callback a_onChange, Options a_options)
+	{
+		if (_thread.joinable()) {
+			return false;
+		}
+
+		_impl = std::make_unique<Impl>();
+		_backend.store(_impl->Open(a_file, a_options.forcePolling), std::memory_order_release);
+		_thread = std::thread(&FileWatcher::Run, this, std::move(a_file), std::move(a_onChange), a_options);
+		return true;
+	}
+
+	void FileWatcher::Stop()
+	{
+		if (!_thread.joinable()) {
+			return;
+		}
+		_impl->Signal();
+		_thread.join();
+		_impl.reset();
+	}
+
+	void FileWatcher::Run(std::filesystem::path a_file, Callback a_onChange, Options a_options)
+	{
+		auto& impl = *_impl;
+		const bool polling = impl.Polling();
+		Stamp last = StampOf(a_file);
+
+		while (true) {
+			auto wake = impl.Wait(polling ? a_options.pollInterval : std::chrono::milliseconds{ -1 });
+			if (wake == Wake::kStopped) {
+				return;
+			}
+			if (!polling && wake != Wake::kChanged) {
+				continue;
+			}
+
+			// Let the save settle: every further event restarts the quiet period.
+			if (!polling) {
+				while ((wake = impl.Wait(a_options.debounce)) == Wake::kChanged) {}
+				if (wake == Wake::kStopped) {
+					return;
+				}
+			}
+
+			Stamp now = StampOf(a_file);
+			if (now == last) {
+				continue;
+			}
+
+			// Polling only sees the first write of a save; give the rest of it time to land.
+			if (polling) {
+				if (impl.Wait(a_options.debounce) == Wake::kStopped) {
+					return;
+				}
+				now = StampOf(a_file);
+			}
+			last = now;
+
+			// Deleted (or mid-rename): nothing to read yet, the recreate is the change.
+			if (!now.exists) {
+				continue;
+			}
+
+			_changes.fetch_add(1, std::memory_order_relaxed);
+			a_onChange();
+		}
+	}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <thread>
+
+namespace SF::Core
+{
+	// Watches one file from a background thread and calls back when its contents change.
+	//
+	// The thread sleeps in the OS change notification for the file's directory
+	// (FindFirstChangeNotification on Windows, inotify on Linux) and falls back to polling the
+	// write time when neither is available. Editors save in bursts (truncate + write, or write to a
+	// temp file + rename), so a change is reported once the file has been quiet for `debounce`
+	// and only if its write time or size actually differs from the last report.
+	//
+	// The callback runs on the watcher thread. Whatever it publishes must be safe for other
+	// threads to read (Core::Config::Publish is).
+	class FileWatcher
+	{
+	public:
+		using Callback = std::function<void()>;
+
+		struct Options
+		{
+			std::chrono::milliseconds debounce{ 150 };
+			std::chrono::milliseconds pollInterval{ 1000 };  // polling backend only
+			bool forcePolling{ false };
+		};
+
+		FileWatcher();
+		~FileWatcher();
+
+		FileWatcher(const FileWatcher&) = delete;
+		FileWatcher& operator=(const FileWatcher&) = delete;
+
+		// Starts the thread. The current state of the file is the baseline: no callback for it.
+		// Returns false if already running.
+		bool Start(std::filesystem::path a_file, Callback a_onChange, Options a_options);
+		bool Start(std::filesystem::path a_file, Callback a_onChange) { return Start(std::move(a_file), std::move(a_onChange), Options{}); }
+
+		// Wakes the thread and joins it. Safe to call when not running.
+		void Stop();
+
+		[[nodiscard]] bool Running() const noexcept { return _thread.joinable(); }
+
+		// "FindFirstChangeNotification", "inotify" or "poll"; valid once Start() returned.
+		[[nodiscard]] std::string_view Backend() const noexcept { return _backend.load(std::memory_order_acquire); }
+
+		// Callbacks delivered so far.
+		[[nodiscard]] std::uint64_t Changes() const noexcept { return _changes.load(std::memory_order_relaxed); }
+
+		struct Impl;
+
+	private:
+		void Run(std::filesystem::path a_file, Callback a_onChange, Options a_options);
+
+		std::thread _thread;
+		std::unique_ptr<Impl> _impl;  // OS handles shared with Stop()
+		std::atomic<const char*> _backend{ "none" };
+		std::atomic<std::uint64_t> _changes{ 0 };
+	};
+}
@@ -0,0 +1,237 @@
+#include "SF/Core/FlightRecorder.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <new>
+
+#ifdef _WIN32
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+
+namespace SF::Core::FlightRecorder
+{
+	namespace
+	{
+		struct Ring
+		{
+			std::uint32_t threadIndex{ 0 };
+			std::atomic<std::uint64_t> head{ 0 };  // total records ever written by the owner
+			std::array<Record, kRecordsPerThread> records{};
+		};
+
+		// Lock-free registry: slots are claimed once with fetch_add and never released,
+		// rings are leaked on purpose (they must survive thread exit for a later dump).
+		std::array<std::atomic<Ring*>, kMaxThreads> g_rings{};
+		std::atomic<std::uint32_t> g_ringCount{ 0 };
+
+		Ring* ClaimRing() noexcept
+		{
+			const auto idx = g_ringCount.fetch_add(1, std::memory_order_relaxed);
+			if (idx >= kMaxThreads) {
+				return nullptr;
+			}
+			auto* ring = new (std::nothrow) Ring();
+			if (!ring) {
+				return nullptr;
+			}
+			ring->threadIndex = idx;
+			g_rings[idx].store(ring, std::memory_order_release);
+			return ring;
+		}
+
+		Ring* ThisThreadRing() noexcept
+		{
+			thread_local Ring* ring = ClaimRing();
+			return ring;
+		}
+
+		// Raw OS file: no CRT stream, no buffer, no lock, so Dump() stays usable from a crash
+		// handler. Each Write() is one system call.
+		class RawFile
+		{
+		public:
+			explicit RawFile(const std::filesystem::path& a_path) noexcept
+			{
+#ifdef _WIN32
+				_handle = ::CreateFileW(a_path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+				_fd = ::open(a_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+#endif
+			}
+
+			RawFile(const RawFile&) = delete;
+			RawFile& operator=(const RawFile&) = delete;
+
+			~RawFile() { (void)Close(); }
+
+			[[nodiscard]] bool IsOpen() const noexcept
+			{
+#ifdef _WIN32
+				return _handle != INVALID_HANDLE_VALUE;
+#else
+				return _fd >= 0;
+#endif
+			}
+
+			[[nodiscard]] bool Write(const void* a_data, std::size_t a_size) noexcept
+			{
+				const auto* bytes = static_cast<const char*>(a_data);
+				while (a_size > 0) {
+#ifdef _WIN32
+					DWORD written = 0;
+					if (!::WriteFile(_handle, bytes, static_cast<DWORD>(a_size), &written, nullptr) || written == 0) {
+						return false;
+					}
+#else
+					const auto written = ::write(_fd, bytes, a_size);
+					if (written <= 0) {
+						return false;
+					}
+#endif
+					bytes += written;
+					a_size -= static_cast<std::size_t>(written);
+				}
+				return true;
+			}
+
+			bool Close() noexcept
+			{
+				if (!IsOpen()) {
+					return true;
+				}
+#ifdef _WIN32
+				const bool ok = ::CloseHandle(_handle) != 0;
+				_handle = INVALID_HANDLE_VALUE;
+#else
+				const bool ok = ::close(_fd) == 0;
+				_fd = -1;
+#endif
+				return ok;
+			}
+
+		private:
+#ifdef _WIN32
+			HANDLE _handle{ INVALID_HANDLE_VALUE };
+#else
+			int _fd{ -1 };
+#endif
+		};
+	}
+
+	namespace detail
+	{
+		void Append(const Record& a_record) noexcept
+		{
+			auto* ring = ThisThreadRing();
+			if (!ring) {
+				return;
+			}
+
+			const auto idx = ring->head.load(std::memory_order_relaxed);
+			auto& slot = ring->records[idx & (kRecordsPerThread - 1)];
+			slot = a_record;
+			slot.timeUs = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count());
+			ring->head.store(idx + 1, std::memory_order_release);
+		}
+	}
+
+	void SetEnabled(bool a_enabled) noexcept
+	{
+		detail::g_enabled.store(a_enabled, std::memory_order_relaxed);
+	}
+
+	bool Dump(const std::filesystem::path& a_path) noexcept
+	{
+		RawFile f{ a_path };
+		if (!f.IsOpen()) {
+			return false;
+		}
+
+		const auto ringCount = std::min<std::uint32_t>(g_ringCount.load(std::memory_order_acquire), kMaxThreads);
+
+		FileHeader header{};
+		for (std::uint32_t i = 0; i < ringCount; ++i) {
+			if (g_rings[i].load(std::memory_order_acquire)) {
+				header.threadCount++;
+			}
+		}
+		bool ok = f.Write(&header, sizeof(header));
+
+		for (std::uint32_t i = 0; ok && i < ringCount; ++i) {
+			const auto* ring = g_rings[i].load(std::memory_order_acquire);
+			if (!ring) {
+				continue;
+			}
+
+			const auto head = ring->head.load(std::memory_order_acquire);
+			const auto count = static_cast<std::uint32_t>(std::min<std::uint64_t>(head, kRecordsPerThread));
+			const ThreadHeader th{ ring->threadIndex, count };
+			ok = f.Write(&th, sizeof(th));
+
+			// Oldest first: [head - count, head), at most two contiguous runs of the ring.
+			const auto first = static_cast<std::size_t>((head - count) & (kRecordsPerThread - 1));
+			const auto tail = std::min<std::size_t>(count, kRecordsPerThread - first);
+			ok = ok && f.Write(&ring->records[first], tail * sizeof(Record));
+			ok = ok && f.Write(&ring->records[0], (count - tail) * sizeof(Record));
+		}
+
+		ok = f.Close() && ok;
+		return ok;
+	}
+
+	std::size_t Latest(std::span<Record> a_out) noexcept
+	{
+		if (a_out.empty()) {
+			return 0;
+		}
+
+		// a_out[0, n) is a min-heap on time: the oldest kept record is evicted first.
+		const auto newer = [](const Record& a_lhs, const Record& a_rhs) { return a_lhs.timeUs > a_rhs.timeUs; };
+		std::size_t n = 0;
+
+		const auto ringCount = std::min<std::uint32_t>(g_ringCount.load(std::memory_order_acquire), kMaxThreads);
+		for (std::uint32_t i = 0; i < ringCount; ++i) {
+			const auto* ring = g_rings[i].load(std::memory_order_acquire);
+			if (!ring) {
+				continue;
+			}
+
+			const auto head = ring->head.load(std::memory_order_acquire);
+			const auto count = std::min<std::uint64_t>({ head, kRecordsPerThread, a_out.size() });
+			for (std::uint64_t j = head; j-- > head - count;) {
+				const Record& rec = ring->records[j & (kRecordsPerThread - 1)];
+				if (n < a_out.size()) {
+					a_out[n++] = rec;
+					std::push_heap(a_out.begin(), a_out.begin() + n, newer);
+				} else if (rec.timeUs > a_out.front().timeUs) {
+					std::pop_heap(a_out.begin(), a_out.begin() + n, newer);
+					a_out[n - 1] = rec;
+					std::push_heap(a_out.begin(), a_out.begin() + n, newer);
+				} else {
+					break;  // this ring only gets older from here
+				}
+			}
+		}
+
+		std::sort_heap(a_out.begin(), a_out.begin() + n, newer);
+		std::reverse(a_out.begin(), a_out.begin() + n);
+		return n;
+	}
+
+	std::size_t Count() noexcept
+	{
+		std::size_t n = 0;
+		const auto ringCount = std::min<std::uint32_t>(g_ringCount.load(std::memory_order_acquire), kMaxThreads);
+		for (std::uint32_t i = 0; i < ringCount; ++i) {
+			if (const auto* ring = g_rings[i].load(std::memory_order_acquire)) {
+				n += static_cast<std::size_t>(std::min<std::uint64_t>(ring->head.load(std::memory_order_acquire), kRecordsPerThread));
+			}
+		}
+		return n;
+	}
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "SF/Core/AnimTag.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace SF::Core::FlightRecorder
+{
+	// Always-on binary trace of stamina decisions for every actor.
+	//
+	// Each thread that records gets its own fixed-size ring (no locks, no allocation after the
+	// first record on that thread). Old records are overwritten. Dump() writes every ring to a
+	// file that tools can decode offline; it can run at any time, including from a crash handler.
+	// A record being written while a dump runs may come out torn; its timestamp gives it away.
+
+	enum class Kind : std::uint8_t
+	{
+		kStart,         // attackStart*: session opened/refreshed
+		kUnarmedSound,  // SoundPlay.WPNSwingUnarmed: pairing hint only
+		kSpend,         // stamina charged for a swing
+		kSkip,          // swing seen but not charged (see SkipReason)
+		kBlockedHit,    // ShieldOfStaminaLite decision
+	};
+
+	enum class SkipReason : std::uint8_t
+	{
+		kNone,
+		kDuplicate,  // session already spent
+		kNotMelee,
+		kZeroBaseCost,
+		kZeroFinalCost,
+	};
+
+	enum Flag : std::uint8_t
+	{
+		kFlagPower = 1 << 0,
+		kFlagTwoHanded = 1 << 1,
+		kFlagAmbiguous = 1 << 2,
+		kFlagUnarmed = 1 << 3,
+		kFlagInsufficient = 1 << 4,  // could not pay in full -> damage scaled
+	};
+
+	inline constexpr std::uint8_t kHandLeft = 0;
+	inline constexpr std::uint8_t kHandRight = 1;
+	inline constexpr std::uint8_t kHandNone = 0xFF;
+
+	// 40 bytes. Float meaning per kind:
+	//   kStart/kUnarmedSound: staminaBefore = snapshot
+	//   kSpend : cost = final cost, baseCost = pre-multiplier cost, startStamina = session snapshot,
+	//            staminaBefore = current before adjust, staminaAfter = enforced target
+	//   kSkip  : whatever was known when the swing was rejected
+	//   kBlockedHit: baseCost = incoming damage, cost = stamina absorbed,
+	//            startStamina = damage left on health, staminaBefore/After = target stamina
+	struct Record
+	{
+		std::uint64_t timeUs{ 0 };  // steady clock, microseconds
+		std::uint32_t actor{ 0 };   // FormID (target for kBlockedHit)
+		Kind kind{ Kind::kStart };
+		AnimTag::Id tag{ AnimTag::Id::kNone };
+		std::uint8_t hand{ kHandNone };
+		std::uint8_t session{ kHandNone };
+		std::uint8_t flags{ 0 };
+		SkipReason reason{ SkipReason::kNone };
+		std::uint16_t reserved{ 0 };
+		float cost{ 0.0f };
+		float baseCost{ 0.0f };
+		float startStamina{ 0.0f };
+		float staminaBefore{ 0.0f };
+		float staminaAfter{ 0.0f };
+	};
+	static_assert(sizeof(Record) == 40);
+
+	// File layout: FileHeader, then `threadCount` x (ThreadHeader + records oldest-first).
+	inline constexpr std::uint32_t kFileMagic = 0x52544653;  // "SFTR"
+	inline constexpr std::uint32_t kFileVersion = 1;
+
+	struct FileHeader
+	{
+		std::uint32_t magic{ kFileMagic };
+		std::uint32_t version{ kFileVersion };
+		std::uint32_t recordSize{ sizeof(Record) };
+		std::uint32_t threadCount{ 0 };
+	};
+
+	struct ThreadHeader
+	{
+		std::uint32_t threadIndex{ 0 };
+		std::uint32_t recordCount{ 0 };
+	};
+
+	inline constexpr std::size_t kRecordsPerThread = 4096;  // power of two
+	inline constexpr std::size_t kMaxThreads = 64;          // later threads are not recorded
+
+	namespace detail
+	{
+		inline std::atomic<bool> g_enabled{ true };
+
+		void Append(const Record& a_record) noexcept;
+	}
+
+	[[nodiscard]] inline bool Enabled() noexcept
+	{
+		return detail::g_enabled.load(std::memory_order_relaxed);
+	}
+
+	void SetEnabled(bool a_enabled) noexcept;
+
+	// Stamps the time and appends to the calling thread's ring.
+	inline void Add(const Record& a_record) noexcept
+	{
+		if (Enabled()) {
+			detail::Append(a_record);
+		}
+	}
+
+	// Writes all rings straight through the OS file API (CreateFileW/WriteFile, open/write):
+	// no locks, no heap, no CRT streams, so it is usable from a crash handler (build the path
+	// up front there).
+	bool Dump(const std::filesystem::path& a_path) noexcept;
+
+	// Number of records currently held (for the log).
+	[[nodiscard]] std::size_t Count() noexcept;
+
+	// The newest a_out.size() records across all threads, oldest first (live telemetry).
+	// Like Dump(), takes no locks; returns how many were filled.
+	std::size_t Latest(std::span<Record> a_out) noexcept;
+}
@@ -0,0 +1,183 @@
+#include "SF/Core/FrameScheduler.h"
+
+#include <atomic>
+#include <new>
+
+namespace SF::Core::Frame
+{
+	namespace
+	{
+		// Free list of kPooledFrameBytes blocks, grown a chunk at a time and never shrunk. Frames
+		// are created on whatever thread calls the coroutine (Post() may come from animation
+		// threads), so the list takes a lock; it is held for a pointer swap.
+		constexpr std::size_t kBlocksPerChunk = 64;
+
+		struct FreeBlock
+		{
+			FreeBlock* next;
+		};
+
+		std::mutex g_poolLock;
+		FreeBlock* g_free{ nullptr };
+		std::size_t g_poolFrames{ 0 };
+		std::size_t g_poolFree{ 0 };
+		std::atomic<std::uint64_t> g_heapFrames{ 0 };
+
+		void GrowLocked()
+		{
+			auto* chunk = static_cast<std::byte*>(::operator new(detail::kPooledFrameBytes * kBlocksPerChunk));
+			for (std::size_t i = 0; i < kBlocksPerChunk; ++i) {
+				auto* block = reinterpret_cast<FreeBlock*>(chunk + i * detail::kPooledFrameBytes);
+				block->next = g_free;
+				g_free = block;
+			}
+			g_poolFrames += kBlocksPerChunk;
+			g_poolFree += kBlocksPerChunk;
+		}
+	}
+
+	namespace detail
+	{
+		void* AllocateFrame(std::size_t a_size)
+		{
+			if (a_size > kPooledFrameBytes) {
+				g_heapFrames.fetch_add(1, std::memory_order_relaxed);
+				return ::operator new(a_size);
+			}
+
+			std::scoped_lock _{ g_poolLock };
+			if (!g_free) {
+				GrowLocked();
+			}
+			auto* block = g_free;
+			g_free = block->next;
+			--g_poolFree;
+			return block;
+		}
+
+		void FreeFrame(void* a_frame, std::size_t a_size) noexcept
+		{
+			if (!a_frame) {
+				return;
+			}
+			if (a_size > kPooledFrameBytes) {
+				::operator delete(a_frame);
+				return;
+			}
+
+			std::scoped_lock _{ g_poolLock };
+			auto* block = static_cast<FreeBlock*>(a_frame);
+			block->next = g_free;
+			g_free = block;
+			++g_poolFree;
+		}
+	}
+
+	void Scheduler::Start(Task a_task)
+	{
+		auto handle = a_task.Release();
+		if (!handle) {
+			return;
+		}
+		handle.promise().scheduler = this;
+		Resume(handle);
+	}
+
+	void Scheduler::Post(Task a_task)
+	{
+		auto handle = a_task.Release();
+		if (!handle) {
+			return;
+		}
+		handle.promise().scheduler = this;
+
+		std::scoped_lock _{ _postLock };
+		_posted.push_back(handle);
+		_hasPosted.store(true, std::memory_order_release);
+	}
+
+	void Scheduler::Wait(Task::Handle a_handle, std::uint64_t a_frames, std::uint64_t a_ms)
+	{
+		_waiting.push_back({ a_handle, _frame + a_frames, a_ms ? _clock() + a_ms : 0 });
+	}
+
+	void Scheduler::Resume(Task::Handle a_handle)
+	{
+		++_resumed;
+		a_handle.resume();  // may Wait() again or finish and free itself
+	}
+
+	std::size_t Scheduler::Tick()
+	{
+		++_frame;
+		const std::uint64_t resumedBefore = _resumed;
+
+		if (_hasPosted.load(std::memory_order_acquire)) {
+			{
+				std::scoped_lock _{ _postLock };
+				_starting.swap(_posted);
+				_hasPosted.store(false, std::memory_order_relaxed);
+			}
+			for (auto handle : _starting) {
+				Resume(handle);
+			}
+			_starting.clear();
+		}
+
+		if (_waiting.empty()) {
+			return static_cast<std::size_t>(_resumed - resumedBefore);
+		}
+
+		// Frames resumed below may Wait() again; those land in the fresh _waiting list and are
+		// due next frame at the earliest.
+		const std::uint64_t now = _clock();
+		_due.swap(_waiting);
+		for (const auto& w : _due) {
+			if (w.dueFrame <= _frame && w.dueMs <= now) {
+				Resume(w.handle);
+			} else {
+				_waiting.push_back(w);
+			}
+		}
+		_due.clear();
+
+		return static_cast<std::size_t>(_resumed - resumedBefore);
+	}
+
+	std::size_t Scheduler::CancelAll()
+	{
+		std::size_t n = 0;
+		{
+			std::scoped_lock _{ _postLock };
+			for (auto handle : _posted) {
+				handle.destroy();
+				++n;
+			}
+			_posted.clear();
+			_hasPosted.store(false, std::memory_order_relaxed);
+		}
+		for (const auto& w : _waiting) {
+			w.handle.destroy();
+			++n;
+		}
+		_waiting.clear();
+
+		_cancelled += n;
+		return n;
+	}
+
+	Scheduler::Stats Scheduler::GetStats() const noexcept
+	{
+		Stats s;
+		s.waiting = _waiting.size();
+		s.resumed = _resumed;
+		s.cancelled = _cancelled;
+		{
+			std::scoped_lock _{ g_poolLock };
+			s.poolFrames = g_poolFrames;
+			s.poolFree = g_poolFree;
+		}
+		s.heapFrames = g_heapFrames.load(std::memory_order_relaxed);
+		return s;
+	}
+}
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "SF/Core/Clock.h"
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace SF::Core::Frame
+{
+	// Multi-step main-thread sequences as coroutines:
+	//
+	//   Frame::Task Parry(RE::ActorHandle a_handle)
+	//   {
+	//       Interrupt(a_handle);
+	//       co_await Frame::Frames(2);
+	//       Drain(a_handle);
+	//       co_await Frame::Delay(40ms);
+	//       Bash(a_handle);
+	//   }
+	//   scheduler.Start(Parry(handle));
+	//
+	// The scheduler is driven by one per-frame hook (Events/FrameHook.h) calling Tick(). Frames
+	// come from a fixed-size pool, so a sequence costs no allocation once the pool is warm, and
+	// nothing polls: a waiting frame sits in a list until its frame index or deadline comes up.
+	// Anything can happen while suspended (the actor unloads, a save loads), so re-resolve handles
+	// after every co_await.
+
+	class Scheduler;
+
+	namespace detail
+	{
+		// Frames up to kPooledFrameBytes come from the pool; larger ones fall back to the heap.
+		inline constexpr std::size_t kPooledFrameBytes = 512;
+
+		void* AllocateFrame(std::size_t a_size);
+		void FreeFrame(void* a_frame, std::size_t a_size) noexcept;
+	}
+
+	// Fire-and-forget coroutine. Does nothing until handed to Scheduler::Start()/Post(); the frame
+	// frees itself when the body returns.
+	class Task
+	{
+	public:
+		struct promise_type
+		{
+			Scheduler* scheduler{ nullptr };
+
+			Task get_return_object() noexcept { return Task{ std::coroutine_handle<promise_type>::from_promise(*this) }; }
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			std::suspend_never final_suspend() noexcept { return {}; }
+			void return_void() noexcept {}
+			void unhandled_exception() noexcept { std::terminate(); }
+
+			static void* operator new(std::size_t a_size) { return detail::AllocateFrame(a_size); }
+			static void operator delete(void* a_frame, std::size_t a_size) noexcept { detail::FreeFrame(a_frame, a_size); }
+		};
+
+		using Handle = std::coroutine_handle<promise_type>;
+
+		Task(Task&& a_other) noexcept :
+			_handle(std::exchange(a_other._handle, {}))
+		{}
+		Task(const Task&) = delete;
+		Task& operator=(const Task&) = delete;
+		Task& operator=(Task&&) = delete;
+
+		~Task()
+		{
+			if (_handle) {
+				_handle.destroy();  // never started
+			}
+		}
+
+	private:
+		friend class Scheduler;
+
+		explicit Task(Handle a_handle) noexcept :
+			_handle(a_handle)
+		{}
+
+		Handle Release() noexcept { return std::exchange(_handle, {}); }
+
+		Handle _handle;
+	};
+
+	class Scheduler
+	{
+	public:
+		using Clock = Core::Clock::Ms (*)();  // milliseconds, monotonic
+
+		struct Stats
+		{
+			std::size_t waiting{ 0 };       // suspended in Frames()/Delay()
+			std::uint64_t resumed{ 0 };     // total resumptions
+			std::uint64_t cancelled{ 0 };   // destroyed by CancelAll()
+			std::size_t poolFrames{ 0 };    // pool capacity (all schedulers)
+			std::size_t poolFree{ 0 };
+			std::uint64_t heapFrames{ 0 };  // frames too large for the pool
+		};
+
+		explicit Scheduler(Clock a_clock = Core::Clock::PreciseMs) noexcept :
+			_clock(a_clock)
+		{}
+
+		~Scheduler() { CancelAll(); }
+
+		Scheduler(const Scheduler&) = delete;
+		Scheduler& operator=(const Scheduler&) = delete;
+
+		// The plugin's main-thread scheduler.
+		[[nodiscard]] static Scheduler& GetSingleton()
+		{
+			static Scheduler singleton;
+			return singleton;
+		}
+
+		// Scheduler thread only: runs the body now, up to its first co_await.
+		void Start(Task a_task);
+
+		// Any thread: the body starts on the next Tick().
+		void Post(Task a_task);
+
+		// Once per frame on the scheduler thread. Starts posted tasks, then resumes every frame
+		// whose frame count or deadline is due. Returns how many were resumed.
+		std::size_t Tick();
+
+		// Destroys every posted and waiting frame (new game / load). Scheduler thread only.
+		std::size_t CancelAll();
+
+		[[nodiscard]] std::uint64_t FrameIndex() const noexcept { return _frame; }
+		[[nodiscard]] Core::Clock::Ms NowMs() const noexcept { return _clock(); }
+		[[nodiscard]] Stats GetStats() const noexcept;
+
+		// Awaiter plumbing (see Frames()/Delay()).
+		void Wait(Task::Handle a_handle, std::uint64_t a_frames, std::uint64_t a_ms);
+
+	private:
+		struct Waiter
+		{
+			Task::Handle handle;
+			std::uint64_t dueFrame{ 0 };
+			std::uint64_t dueMs{ 0 };
+		};
+
+		void Resume(Task::Handle a_handle);
+
+		Clock _clock;
+		std::uint64_t _frame{ 0 };
+		std::uint64_t _resumed{ 0 };
+		std::uint64_t _cancelled{ 0 };
+
+		std::vector<Waiter> _waiting;
+		std::vector<Waiter> _due;  // Tick() scratch, kept for its capacity
+
+		std::mutex _postLock;
+		std::atomic<bool> _hasPosted{ false };  // lets Tick() skip the lock on quiet frames
+		std::vector<Task::Handle> _posted;
+		std::vector<Task::Handle> _starting;  // Tick() scratch
+	};
+
+	// co_await Frames(n): resume on the n-th Tick() from now (n = 0 behaves like 1).
+	struct Frames
+	{
+		explicit Frames(std::uint64_t a_frames) noexcept :
+			frames(a_frames ? a_frames : 1)
+		{}
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(Task::Handle a_handle) const { a_handle.promise().scheduler->Wait(a_handle, frames, 0); }
+		void await_resume() const noexcept {}
+
+		std::uint64_t frames;
+	};
+
+	[[nodiscard]] inline Frames NextFrame() noexcept { return Frames{ 1 }; }
+
+	// co_await Delay(40ms): resume on the first Tick() at least that long from now (never in
+	// the current frame).
+	struct Delay
+	{
+		explicit Delay(std::chrono::milliseconds a_delay) noexcept :
+			ms(static_cast<std::uint64_t>(a_delay.count() > 0 ? a_delay.count() : 0))
+		{}
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(Task::Handle a_handle) const { a_handle.promise().scheduler->Wait(a_handle, 1, ms); }
+		void await_resume() const noexcept {}
+
+		std::uint64_t ms;
+	};
+}
@@ -0,0 +1,177 @@
+#include "SF/Core/Latency.h"
+
+#include <algorithm>
+#include <new>
+#include <thread>
+
+namespace SF::Core::Latency
+{
+	namespace
+	{
+		struct Histogram
+		{
+			std::array<std::atomic<std::uint32_t>, kBuckets> buckets{};
+			std::atomic<std::uint64_t> count{ 0 };
+			std::atomic<std::uint64_t> sum{ 0 };
+			std::atomic<std::uint64_t> max{ 0 };
+		};
+
+		// Written by its owner thread only (plain load + store, no read-modify-write);
+		// Collect() reads it from anywhere.
+		struct Block
+		{
+			std::array<Histogram, kProbes> probes{};
+		};
+
+		// Claimed once per thread, never released: a report may run after the thread is gone.
+		std::array<std::atomic<Block*>, kMaxThreads> g_blocks{};
+		std::atomic<std::uint32_t> g_blockCount{ 0 };
+
+		Block* ClaimBlock() noexcept
+		{
+			const auto idx = g_blockCount.fetch_add(1, std::memory_order_relaxed);
+			if (idx >= kMaxThreads) {
+				return nullptr;
+			}
+			auto* block = new (std::nothrow) Block();
+			if (block) {
+				g_blocks[idx].store(block, std::memory_order_release);
+			}
+			return block;
+		}
+
+		Block* ThisThreadBlock() noexcept
+		{
+			thread_local Block* block = ClaimBlock();
+			return block;
+		}
+
+		template <class T>
+		void Bump(std::atomic<T>& a_value, T a_by) noexcept
+		{
+			a_value.store(a_value.load(std::memory_order_relaxed) + a_by, std::memory_order_relaxed);
+		}
+
+		// Calibration origin: taken at static initialization, so by the first report the interval
+		// is long enough for a precise ratio.
+		struct Origin
+		{
+			std::uint64_t ticks{ Now() };
+			std::chrono::steady_clock::time_point time{ std::chrono::steady_clock::now() };
+		};
+
+		const Origin g_origin;
+	}
+
+	namespace detail
+	{
+		void Record(Probe a_probe, std::uint64_t a_ticks) noexcept
+		{
+			auto* block = ThisThreadBlock();
+			if (!block) {
+				return;
+			}
+
+			auto& h = block->probes[static_cast<std::size_t>(a_probe)];
+			Bump(h.buckets[BucketOf(a_ticks)], std::uint32_t{ 1 });
+			Bump(h.count, std::uint64_t{ 1 });
+			Bump(h.sum, a_ticks);
+			if (a_ticks > h.max.load(std::memory_order_relaxed)) {
+				h.max.store(a_ticks, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	void SetEnabled(bool a_enabled) noexcept
+	{
+		detail::g_enabled.store(a_enabled, std::memory_order_relaxed);
+	}
+
+	double TicksPerUs() noexcept
+	{
+#if SF_LATENCY_TSC
+		auto elapsed = std::chrono::steady_clock::now() - g_origin.time;
+		if (elapsed < std::chrono::milliseconds(10)) {
+			// Right after start-up (benchmarks): wait for a usable interval.
+			std::this_thread::sleep_for(std::chrono::milliseconds(10) - elapsed);
+			elapsed = std::chrono::steady_clock::now() - g_origin.time;
+		}
+		const auto ticks = Now() - g_origin.ticks;
+		const double us = std::chrono::duration<double, std::micro>(elapsed).count();
+		return static_cast<double>(ticks) / us;
+#else
+		return static_cast<double>(std::chrono::steady_clock::period::den) /
+		       (static_cast<double>(std::chrono::steady_clock::period::num) * 1e6);
+#endif
+	}
+
+	std::array<Summary, kProbes> Collect() noexcept
+	{
+		const double ticksPerUs = TicksPerUs();
+		const auto blockCount = std::min<std::uint32_t>(g_blockCount.load(std::memory_order_acquire), kMaxThreads);
+
+		std::array<Summary, kProbes> out{};
+		std::array<std::uint64_t, kBuckets> merged;
+		for (std::size_t p = 0; p < kProbes; ++p) {
+			merged.fill(0);
+			std::uint64_t sum = 0;
+			std::uint64_t max = 0;
+			for (std::uint32_t b = 0; b < blockCount; ++b) {
+				const auto* block = g_blocks[b].load(std::memory_order_acquire);
+				if (!block) {
+					continue;
+				}
+				const auto& h = block->probes[p];
+				for (std::size_t i = 0; i < kBuckets; ++i) {
+					merged[i] += h.buckets[i].load(std::memory_order_relaxed);
+				}
+				sum += h.sum.load(std::memory_order_relaxed);
+				max = std::max(max, h.max.load(std::memory_order_relaxed));
+			}
+
+			// Count from the buckets, not the counters: the two may be a record apart.
+			std::uint64_t count = 0;
+			for (const auto n : merged) {
+				count += n;
+			}
+			if (count == 0) {
+				continue;
+			}
+
+			const auto percentile = [&](double a_q) {
+				const auto rank = static_cast<std::uint64_t>(a_q * static_cast<double>(count - 1)) + 1;
+				std::uint64_t seen = 0;
+				for (std::size_t i = 0; i < kBuckets; ++i) {
+					seen += merged[i];
+					if (seen >= rank) {
+						// Upper edge of the bucket (never above the recorded max).
+						const auto hi = i + 1 < kBuckets ? BucketFloor(i + 1) - 1 : max;
+						return static_cast<double>(std::min(hi, max)) / ticksPerUs;
+					}
+				}
+				return static_cast<double>(max) / ticksPerUs;
+			};
+
+			auto& s = out[p];
+			s.count = count;
+			s.meanUs = static_cast<double>(sum) / static_cast<double>(count) / ticksPerUs;
+			s.p50Us = percentile(0.50);
+			s.p99Us = percentile(0.99);
+			s.p999Us = percentile(0.999);
+			s.maxUs = static_cast<double>(max) / ticksPerUs;
+		}
+		return out;
+	}
+
+	std::size_t Threads() noexcept
+	{
+		std::size_t n = 0;
+		const auto blockCount = std::min<std::uint32_t>(g_blockCount.load(std::memory_order_acquire), kMaxThreads);
+		for (std::uint32_t b = 0; b < blockCount; ++b) {
+			if (g_blocks[b].load(std::memory_order_acquire)) {
+				++n;
+			}
+		}
+		return n;
+	}
+}
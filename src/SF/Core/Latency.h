@@ -0,0 +1,180 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#	include <intrin.h>
+#	define SF_LATENCY_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#	include <x86intrin.h>
+#	define SF_LATENCY_TSC 1
+#else
+#	define SF_LATENCY_TSC 0
+#endif
+
+// Build flag (CMake option SF_LATENCY_PROBES): 0 compiles every SF_LATENCY_SCOPE away.
+#ifndef SF_LATENCY
+#	define SF_LATENCY 1
+#endif
+
+namespace SF::Core::Latency
+{
+	// How long our hooks and sinks take, per call.
+	//
+	// SF_LATENCY_SCOPE(kProbe) at the top of a hook reads the TSC on entry and exit and adds the
+	// difference to a histogram owned by the calling thread (claimed on first use, like the
+	// FlightRecorder rings: no locks, no allocation afterwards). Buckets are log-linear (HDR
+	// style): 32 linear steps per power of two, so a percentile is within ~3% of the real value.
+	//
+	// Collect() merges every thread's histograms into percentiles at any time; a record being
+	// added meanwhile may or may not be counted. Ticks are converted to microseconds against
+	// steady_clock at that point.
+	//
+	// "Latency.Enabled": false leaves one relaxed load per scope; building with SF_LATENCY=0
+	// leaves nothing.
+
+	enum class Probe : std::uint8_t
+	{
+		kProcessHit,        // ShieldOfStaminaLite: HitEventHook::ProcessHit (our part, not the engine's)
+		kAnimEventBus,      // Events::AnimEventBus sink, whole ProcessEvent
+		kLightAttackAnim,   // LightAttackStaminaCost's bus subscriber
+		kJumpAnim,          // JumpStaminaCost's bus subscriber
+		kDualWieldingInput, // DualWielding InputSink::ProcessEvent
+		kLockpickMenu,      // LockpickBlockerSink::ProcessEvent
+		kFrameUpdate,       // FrameHook: scheduler tick + AV flush (our part of Main::Update)
+
+		kTotal
+	};
+
+	inline constexpr std::size_t kProbes = static_cast<std::size_t>(Probe::kTotal);
+
+	inline constexpr std::array<std::string_view, kProbes> kProbeNames{
+		"ProcessHit",
+		"AnimEventBus",
+		"LightAttackAnim",
+		"JumpAnim",
+		"DualWieldingInput",
+		"LockpickMenu",
+		"FrameUpdate",
+	};
+
+	// Bucket layout: values below 2^kSubBits get one bucket each, then kSubBuckets per power of two
+	// up to 2^kMaxBits ticks (minutes at any clock rate); longer calls land in the last bucket.
+	inline constexpr unsigned kSubBits = 5;
+	inline constexpr std::uint64_t kSubBuckets = 1ull << kSubBits;
+	inline constexpr unsigned kMaxBits = 40;
+	inline constexpr std::size_t kBuckets = (kMaxBits - kSubBits + 1) * kSubBuckets;
+
+	inline constexpr std::size_t kMaxThreads = 64;  // later threads are not recorded
+
+	[[nodiscard]] constexpr std::size_t BucketOf(std::uint64_t a_ticks) noexcept
+	{
+		if (a_ticks < kSubBuckets) {
+			return static_cast<std::size_t>(a_ticks);
+		}
+		if (a_ticks >= (1ull << kMaxBits)) {
+			return kBuckets - 1;
+		}
+		unsigned width = 0;
+		for (auto v = a_ticks; v; v >>= 1) {
+			++width;
+		}
+		const unsigned group = width - kSubBits;
+		return group * kSubBuckets + static_cast<std::size_t>((a_ticks >> (group - 1)) & (kSubBuckets - 1));
+	}
+
+	// Smallest value that lands in a_bucket.
+	[[nodiscard]] constexpr std::uint64_t BucketFloor(std::size_t a_bucket) noexcept
+	{
+		if (a_bucket < kSubBuckets) {
+			return a_bucket;
+		}
+		const auto group = a_bucket / kSubBuckets;
+		return (kSubBuckets + a_bucket % kSubBuckets) << (group - 1);
+	}
+
+	static_assert(BucketOf(31) == 31 && BucketOf(32) == 32 && BucketOf(63) == 63 && BucketOf(64) == 64);
+	static_assert(BucketFloor(BucketOf(1000)) <= 1000 && BucketFloor(BucketOf(1000) + 1) > 1000);
+	static_assert(BucketOf((1ull << kMaxBits) - 1) == kBuckets - 1);
+
+	[[nodiscard]] inline std::uint64_t Now() noexcept
+	{
+#if SF_LATENCY_TSC
+		return __rdtsc();
+#else
+		return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+	}
+
+	namespace detail
+	{
+		inline std::atomic<bool> g_enabled{ true };
+
+		void Record(Probe a_probe, std::uint64_t a_ticks) noexcept;
+	}
+
+	[[nodiscard]] inline bool Enabled() noexcept
+	{
+		return detail::g_enabled.load(std::memory_order_relaxed);
+	}
+
+	void SetEnabled(bool a_enabled) noexcept;
+
+	// Times its own lifetime. Prefer SF_LATENCY_SCOPE, which disappears with SF_LATENCY=0.
+	class Scope
+	{
+	public:
+		explicit Scope(Probe a_probe) noexcept :
+			_start(Enabled() ? Now() : 0),
+			_probe(a_probe)
+		{}
+
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+
+		~Scope()
+		{
+			if (_start) {
+				detail::Record(_probe, Now() - _start);
+			}
+		}
+
+	private:
+		std::uint64_t _start;
+		Probe _probe;
+	};
+
+	struct Summary
+	{
+		std::uint64_t count{ 0 };
+		double meanUs{ 0.0 };
+		double p50Us{ 0.0 };
+		double p99Us{ 0.0 };
+		double p999Us{ 0.0 };
+		double maxUs{ 0.0 };
+	};
+
+	// Every thread merged, per probe. Cheap enough for a hotkey; not meant for every frame.
+	[[nodiscard]] std::array<Summary, kProbes> Collect() noexcept;
+
+	// Clock ticks per microsecond (TSC against steady_clock since start-up).
+	[[nodiscard]] double TicksPerUs() noexcept;
+
+	// Threads that have recorded at least once.
+	[[nodiscard]] std::size_t Threads() noexcept;
+}
+
+#define SF_LATENCY_CONCAT_IMPL(a, b) a##b
+#define SF_LATENCY_CONCAT(a, b) SF_LATENCY_CONCAT_IMPL(a, b)
+
+#if SF_LATENCY
+#	define SF_LATENCY_SCOPE(a_probe) \
+		const ::SF::Core::Latency::Scope SF_LATENCY_CONCAT(sfLatencyScope, __LINE__) { ::SF::Core::Latency::Probe::a_probe }
+#else
+#	define SF_LATENCY_SCOPE(a_probe) static_cast<void>(0)
+#endif
@@ -0,0 +1,286 @@
+#include "SF/Core/Log.h"
+
+#include "SF/Core/ConfigText.h"
+
+#include <spdlog/sinks/rotating_file_sink.h>
+#include <spdlog/sinks/sink.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace SF::Core::Log
+{
+	namespace
+	{
+		// Bounded lock-free queue (Vyukov): any thread pushes, the writer thread pops.
+		// Producers never block: when the ring is full the line is dropped and counted.
+		class Ring
+		{
+		public:
+			static constexpr std::size_t kCapacity = 1024;  // power of two
+			static constexpr std::size_t kMaxText = 960;    // longer lines are truncated
+
+			struct Record
+			{
+				spdlog::log_clock::time_point time{};
+				std::size_t threadId{ 0 };
+				spdlog::string_view_t loggerName{};  // points into a logger that lives forever
+				spdlog::level::level_enum level{ spdlog::level::info };
+				std::uint16_t length{ 0 };
+				char text[kMaxText];
+			};
+
+			Ring()
+			{
+				for (std::size_t i = 0; i < kCapacity; ++i) {
+					_cells[i].seq.store(i, std::memory_order_relaxed);
+				}
+			}
+
+			bool Push(const spdlog::details::log_msg& a_msg)
+			{
+				auto pos = _enqueue.load(std::memory_order_relaxed);
+				Cell* cell = nullptr;
+				for (;;) {
+					cell = &_cells[pos & (kCapacity - 1)];
+					const auto seq = cell->seq.load(std::memory_order_acquire);
+					const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+					if (diff == 0) {
+						if (_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+							break;
+						}
+					} else if (diff < 0) {
+						_dropped.fetch_add(1, std::memory_order_relaxed);
+						return false;
+					} else {
+						pos = _enqueue.load(std::memory_order_relaxed);
+					}
+				}
+
+				auto& rec = cell->record;
+				rec.time = a_msg.time;
+				rec.threadId = a_msg.thread_id;
+				rec.loggerName = a_msg.logger_name;
+				rec.level = a_msg.level;
+				const auto n = std::min(a_msg.payload.size(), kMaxText);
+				std::memcpy(rec.text, a_msg.payload.data(), n);
+				rec.length = static_cast<std::uint16_t>(n);
+
+				cell->seq.store(pos + 1, std::memory_order_release);
+				return true;
+			}
+
+			// Single consumer.
+			template <class Fn>
+			std::size_t Drain(Fn&& a_fn)
+			{
+				std::size_t n = 0;
+				for (;;) {
+					auto& cell = _cells[_dequeue & (kCapacity - 1)];
+					if (cell.seq.load(std::memory_order_acquire) != _dequeue + 1) {
+						break;
+					}
+					a_fn(cell.record);
+					cell.seq.store(_dequeue + kCapacity, std::memory_order_release);
+					++_dequeue;
+					_consumed.store(_dequeue, std::memory_order_release);
+					++n;
+				}
+				return n;
+			}
+
+			[[nodiscard]] std::size_t Produced() const noexcept { return _enqueue.load(std::memory_order_acquire); }
+			[[nodiscard]] std::size_t Consumed() const noexcept { return _consumed.load(std::memory_order_acquire); }
+			[[nodiscard]] std::uint64_t Dropped() const noexcept { return _dropped.load(std::memory_order_relaxed); }
+
+		private:
+			struct Cell
+			{
+				std::atomic<std::size_t> seq{ 0 };
+				Record record;
+			};
+
+			alignas(64) std::atomic<std::size_t> _enqueue{ 0 };
+			alignas(64) std::size_t _dequeue{ 0 };
+			std::atomic<std::size_t> _consumed{ 0 };
+			alignas(64) std::atomic<std::uint64_t> _dropped{ 0 };
+			Cell _cells[kCapacity];
+		};
+
+		// spdlog sink front-end: formatting already happened in the logger, we only copy bytes.
+		class RingSink final : public spdlog::sinks::sink
+		{
+		public:
+			explicit RingSink(Ring& a_ring) :
+				_ring(a_ring)
+			{}
+
+			void log(const spdlog::details::log_msg& a_msg) override { _ring.Push(a_msg); }
+			void flush() override {}
+			void set_pattern(const std::string&) override {}
+			void set_formatter(std::unique_ptr<spdlog::formatter>) override {}
+
+		private:
+			Ring& _ring;
+		};
+
+		struct State
+		{
+			Ring ring;
+			std::shared_ptr<spdlog::sinks::rotating_file_sink_st> file;
+			std::array<std::shared_ptr<spdlog::logger>, static_cast<std::size_t>(Category::kTotal)> loggers;
+			std::array<std::atomic<spdlog::logger*>, static_cast<std::size_t>(Category::kTotal)> published{};
+			std::atomic<std::size_t> flushed{ 0 };  // ring position known to be on disk
+			std::once_flag started;
+		};
+
+		State& GetState()
+		{
+			// Leaked on purpose: the writer thread is detached and may outlive static destruction.
+			static auto* state = new State();
+			return *state;
+		}
+
+		void WriterLoop(State& a_state)
+		{
+			using namespace std::chrono_literals;
+			std::uint64_t reportedDrops = 0;
+			for (;;) {
+				if (const auto dropped = a_state.ring.Dropped(); dropped != reportedDrops) {
+					const auto text = fmt::format("log ring full, dropped {} line(s)", dropped - reportedDrops);
+					a_state.file->log(spdlog::details::log_msg{ "Log", spdlog::level::warn, text });
+					reportedDrops = dropped;
+				}
+
+				const auto n = a_state.ring.Drain([&](const Ring::Record& a_rec) {
+					spdlog::details::log_msg msg{
+						a_rec.time,
+						spdlog::source_loc{},
+						a_rec.loggerName,
+						a_rec.level,
+						spdlog::string_view_t{ a_rec.text, a_rec.length }
+					};
+					msg.thread_id = a_rec.threadId;
+					a_state.file->log(msg);
+				});
+
+				if (n > 0) {
+					a_state.file->flush();
+					a_state.flushed.store(a_state.ring.Consumed(), std::memory_order_release);
+				} else {
+					std::this_thread::sleep_for(5ms);
+				}
+			}
+		}
+
+		spdlog::level::level_enum ParseLevel(const std::string& a_text, spdlog::level::level_enum a_fallback)
+		{
+			const auto lvl = spdlog::level::from_str(a_text);
+			// from_str() maps unknown strings to "off"; only accept it when asked for explicitly.
+			if (lvl == spdlog::level::off && a_text != "off") {
+				return a_fallback;
+			}
+			return lvl;
+		}
+	}
+
+	namespace detail
+	{
+		spdlog::logger* Logger(Category a_category) noexcept
+		{
+			return GetState().published[static_cast<std::size_t>(a_category)].load(std::memory_order_acquire);
+		}
+	}
+
+	Settings ParseSettings(std::string_view a_configText)
+	{
+		Settings settings;
+
+		std::string text;
+		if (ConfigText::ExtractString(a_configText, "LogLevel", text)) {
+			settings.defaultLevel = ParseLevel(text, settings.defaultLevel);
+		}
+		settings.levels.fill(settings.defaultLevel);
+
+		// Player tag dump is a debugging aid; never on unless asked for.
+		settings.levels[static_cast<std::size_t>(Category::kAnimTag)] = spdlog::level::off;
+
+		for (std::size_t i = 0; i < kCategoryNames.size(); ++i) {
+			const auto key = std::string("LogLevel.") + std::string(kCategoryNames[i]);
+			if (ConfigText::ExtractString(a_configText, key, text)) {
+				settings.levels[i] = ParseLevel(text, settings.levels[i]);
+			}
+		}
+
+		int v = 0;
+		if (ConfigText::ExtractInt(a_configText, "LogMaxFileKB", v) && v > 0) {
+			settings.maxFileBytes = static_cast<std::size_t>(v) * 1024u;
+		}
+		if (ConfigText::ExtractInt(a_configText, "LogMaxFiles", v) && v > 0) {
+			settings.maxFiles = static_cast<std::size_t>(v);
+		}
+
+		return settings;
+	}
+
+	void Init(const std::filesystem::path& a_file, const Settings& a_settings)
+	{
+		auto& state = GetState();
+
+		std::call_once(state.started, [&]() {
+			state.file = std::make_shared<spdlog::sinks::rotating_file_sink_st>(
+				a_file.string(), a_settings.maxFileBytes, a_settings.maxFiles, true);
+			state.file->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%t] [%n] [%l] %v");
+
+			auto sink = std::make_shared<RingSink>(state.ring);
+
+			for (std::size_t i = 0; i < state.loggers.size(); ++i) {
+				auto logger = std::make_shared<spdlog::logger>(std::string(kCategoryNames[i]), sink);
+				logger->set_level(spdlog::level::trace);  // filtering happens in Enabled()
+				state.loggers[i] = logger;
+				state.published[i].store(logger.get(), std::memory_order_release);
+			}
+
+			// SKSE::log::* and anything else using the default logger share the ring.
+			auto global = std::make_shared<spdlog::logger>("global log", sink);
+			spdlog::set_default_logger(std::move(global));
+
+			std::thread(WriterLoop, std::ref(state)).detach();
+		});
+
+		for (std::size_t i = 0; i < a_settings.levels.size(); ++i) {
+			SetLevel(static_cast<Category>(i), a_settings.levels[i]);
+		}
+		spdlog::set_level(a_settings.levels[static_cast<std::size_t>(Category::kGeneral)]);
+	}
+
+	void SetLevel(Category a_category, spdlog::level::level_enum a_level) noexcept
+	{
+		detail::g_levels[static_cast<std::size_t>(a_category)].store(static_cast<std::uint8_t>(a_level), std::memory_order_relaxed);
+	}
+
+	std::uint64_t DroppedCount() noexcept
+	{
+		return GetState().ring.Dropped();
+	}
+
+	void Flush()
+	{
+		using namespace std::chrono_literals;
+
+		auto& state = GetState();
+		if (!state.file) {
+			return;
+		}
+		// Bounded wait: this may run from a crash handler while the writer thread is gone.
+		const auto target = state.ring.Produced();
+		for (int i = 0; i < 500 && state.flushed.load(std::memory_order_acquire) < target; ++i) {
+			std::this_thread::sleep_for(1ms);
+		}
+	}
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+namespace SF::Core::Log
+{
+	// Asynchronous, category-filtered logging.
+	//
+	//  - Every module logs through a category with its own runtime level (read from config).
+	//  - SF_LOG_* macros test the level with one relaxed load *before* evaluating any argument,
+	//    so a disabled category costs a compare and nothing else.
+	//  - Enabled lines are formatted on the calling thread, copied into a lock-free ring buffer
+	//    and written to a size-capped rotating file by a background thread.
+	//  - The default spdlog logger (SKSE::log::*) goes through the same ring.
+
+	enum class Category : std::uint8_t
+	{
+		kGeneral,
+		kLightAttack,
+		kAnimTag,  // every player animation tag (very chatty)
+		kJump,
+		kShield,
+		kDualWielding,
+		kLockpick,
+
+		kTotal
+	};
+
+	inline constexpr std::array<std::string_view, static_cast<std::size_t>(Category::kTotal)> kCategoryNames{
+		"General",
+		"LightAttack",
+		"AnimTag",
+		"Jump",
+		"Shield",
+		"DualWielding",
+		"Lockpick",
+	};
+
+	struct Settings
+	{
+		spdlog::level::level_enum defaultLevel{ spdlog::level::info };
+		std::array<spdlog::level::level_enum, static_cast<std::size_t>(Category::kTotal)> levels{};  // filled from defaultLevel unless overridden
+		std::size_t maxFileBytes{ 5u * 1024u * 1024u };
+		std::size_t maxFiles{ 3 };
+	};
+
+	namespace detail
+	{
+		inline std::array<std::atomic<std::uint8_t>, static_cast<std::size_t>(Category::kTotal)> g_levels{};
+
+		spdlog::logger* Logger(Category a_category) noexcept;
+	}
+
+	// Default settings + overrides from config text (see Plugin::InitLog for the keys).
+	[[nodiscard]] Settings ParseSettings(std::string_view a_configText);
+
+	// Opens the rotating file, starts the writer thread and installs the default logger.
+	// Safe to call once; later calls only apply the levels.
+	void Init(const std::filesystem::path& a_file, const Settings& a_settings);
+
+	void SetLevel(Category a_category, spdlog::level::level_enum a_level) noexcept;
+
+	[[nodiscard]] inline spdlog::level::level_enum Level(Category a_category) noexcept
+	{
+		return static_cast<spdlog::level::level_enum>(detail::g_levels[static_cast<std::size_t>(a_category)].load(std::memory_order_relaxed));
+	}
+
+	// Lines dropped because the ring was full (writer thread fell behind).
+	[[nodiscard]] std::uint64_t DroppedCount() noexcept;
+
+	// Blocks until everything queued so far is on disk (use sparingly, e.g. before a crash dump).
+	void Flush();
+
+	[[nodiscard]] inline bool Enabled(Category a_category, spdlog::level::level_enum a_level) noexcept
+	{
+		return static_cast<std::uint8_t>(a_level) >=
+		       detail::g_levels[static_cast<std::size_t>(a_category)].load(std::memory_order_relaxed);
+	}
+
+	template <class... Args>
+	inline void Write(Category a_category, spdlog::level::level_enum a_level, spdlog::format_string_t<Args...> a_fmt, Args&&... a_args)
+	{
+		if (auto* logger = detail::Logger(a_category)) {
+			logger->log(a_level, a_fmt, std::forward<Args>(a_args)...);
+		}
+	}
+}
+
+#define SF_LOG(a_category, a_level, ...)                                                        \
+	do {                                                                                        \
+		if (::SF::Core::Log::Enabled(::SF::Core::Log::Category::a_category, a_level)) {        \
+			::SF::Core::Log::Write(::SF::Core::Log::Category::a_category, a_level, __VA_ARGS__); \
+		}                                                                                       \
+	} while (false)
+
+#define SF_LOG_TRACE(a_category, ...) SF_LOG(a_category, ::spdlog::level::trace, __VA_ARGS__)
+#define SF_LOG_DEBUG(a_category, ...) SF_LOG(a_category, ::spdlog::level::debug, __VA_ARGS__)
+#define SF_LOG_INFO(a_category, ...) SF_LOG(a_category, ::spdlog::level::info, __VA_ARGS__)
+#define SF_LOG_WARN(a_category, ...) SF_LOG(a_category, ::spdlog::level::warn, __VA_ARGS__)
+#define SF_LOG_ERROR(a_category, ...) SF_LOG(a_category, ::spdlog::level::err, __VA_ARGS__)
+
+#define SF_LOG_ENABLED(a_category, a_level) ::SF::Core::Log::Enabled(::SF::Core::Log::Category::a_category, a_level)
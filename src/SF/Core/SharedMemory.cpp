@@ -0,0 +1,169 @@
+#include "SF/Core/SharedMemory.h"
+
+#include <cstdint>
+#include <string>
+
+#ifdef _WIN32
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace SF::Core
+{
+	struct SharedMemory::Impl
+	{
+#ifdef _WIN32
+		HANDLE file{ INVALID_HANDLE_VALUE };
+		HANDLE mapping{ nullptr };
+#else
+		int fd{ -1 };
+#endif
+
+		~Impl() { Reset(); }
+
+		void Reset() noexcept
+		{
+#ifdef _WIN32
+			if (mapping) {
+				::CloseHandle(mapping);
+				mapping = nullptr;
+			}
+			if (file != INVALID_HANDLE_VALUE) {
+				::CloseHandle(file);
+				file = INVALID_HANDLE_VALUE;
+			}
+#else
+			if (fd >= 0) {
+				::close(fd);
+				fd = -1;
+			}
+#endif
+		}
+	};
+
+	namespace
+	{
+#ifdef _WIN32
+		std::wstring LocalName(std::string_view a_name)
+		{
+			std::wstring out = L"Local\\";
+			out.append(a_name.begin(), a_name.end());  // ASCII names only
+			return out;
+		}
+#endif
+	}
+
+	SharedMemory::SharedMemory() :
+		_impl(std::make_unique<Impl>())
+	{}
+
+	SharedMemory::~SharedMemory()
+	{
+		Close();
+	}
+
+	void SharedMemory::Close() noexcept
+	{
+		if (_data) {
+#ifdef _WIN32
+			::UnmapViewOfFile(_data);
+#else
+			::munmap(_data, _size);
+#endif
+			_data = nullptr;
+			_size = 0;
+		}
+		_impl->Reset();
+	}
+
+	bool SharedMemory::CreateNamed([[maybe_unused]] std::string_view a_name, [[maybe_unused]] std::size_t a_bytes)
+	{
+		Close();
+#ifdef _WIN32
+		const auto size = static_cast<std::uint64_t>(a_bytes);
+		_impl->mapping = ::CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+			static_cast<DWORD>(size >> 32), static_cast<DWORD>(size), LocalName(a_name).c_str());
+		return _impl->mapping && Map(true, a_bytes);
+#else
+		return false;
+#endif
+	}
+
+	bool SharedMemory::OpenNamed([[maybe_unused]] std::string_view a_name, [[maybe_unused]] std::size_t a_bytes)
+	{
+		Close();
+#ifdef _WIN32
+		_impl->mapping = ::OpenFileMappingW(FILE_MAP_READ, FALSE, LocalName(a_name).c_str());
+		return _impl->mapping && Map(false, a_bytes);
+#else
+		return false;
+#endif
+	}
+
+	bool SharedMemory::CreateFileBacked(const std::filesystem::path& a_path, std::size_t a_bytes)
+	{
+		Close();
+#ifdef _WIN32
+		_impl->file = ::CreateFileW(a_path.c_str(), GENERIC_READ | GENERIC_WRITE,
+			FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (_impl->file == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+		const auto size = static_cast<std::uint64_t>(a_bytes);
+		_impl->mapping = ::CreateFileMappingW(_impl->file, nullptr, PAGE_READWRITE,
+			static_cast<DWORD>(size >> 32), static_cast<DWORD>(size), nullptr);
+		return _impl->mapping && Map(true, a_bytes);
+#else
+		// Not truncated: a reader may still have the old region mapped, and pages past a shrunk end
+		// fault. The size is set instead; the writer re-initializes the contents.
+		_impl->fd = ::open(a_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+		if (_impl->fd < 0 || ::ftruncate(_impl->fd, static_cast<off_t>(a_bytes)) != 0) {
+			Close();
+			return false;
+		}
+		return Map(true, a_bytes);
+#endif
+	}
+
+	bool SharedMemory::OpenFileBacked(const std::filesystem::path& a_path, std::size_t a_bytes)
+	{
+		Close();
+#ifdef _WIN32
+		_impl->file = ::CreateFileW(a_path.c_str(), GENERIC_READ,
+			FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (_impl->file == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+		_impl->mapping = ::CreateFileMappingW(_impl->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		return _impl->mapping && Map(false, a_bytes);
+#else
+		_impl->fd = ::open(a_path.c_str(), O_RDONLY | O_CLOEXEC);
+		struct stat st{};
+		if (_impl->fd < 0 || ::fstat(_impl->fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < a_bytes) {
+			Close();
+			return false;
+		}
+		return Map(false, a_bytes);
+#endif
+	}
+
+	bool SharedMemory::Map(bool a_writable, std::size_t a_bytes)
+	{
+#ifdef _WIN32
+		_data = ::MapViewOfFile(_impl->mapping, a_writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, a_bytes);
+#else
+		void* p = ::mmap(nullptr, a_bytes, a_writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, _impl->fd, 0);
+		_data = p == MAP_FAILED ? nullptr : p;
+#endif
+		if (!_data) {
+			Close();
+			return false;
+		}
+		_size = a_bytes;
+		return true;
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+namespace SF::Core
+{
+	// A block of memory mapped into this process and visible to others.
+	//
+	// Two kinds of backing:
+	//   named  Windows only: a pagefile-backed mapping ("Local\\<name>"), gone when the last
+	//          process closes it. This is what the plugin publishes telemetry into.
+	//   file   any platform: a regular file mapped shared (CreateFileMapping / mmap). Lets the
+	//          host tools and the viewer run on Linux.
+	// New memory is zero-filled; CreateFileBacked() on an existing file keeps its contents (a
+	// reader may have it mapped), so the writer initializes what it needs. Nothing here
+	// synchronizes access: the layout in the block does (Core/Telemetry.h).
+	class SharedMemory
+	{
+	public:
+		SharedMemory();
+		~SharedMemory();
+
+		SharedMemory(const SharedMemory&) = delete;
+		SharedMemory& operator=(const SharedMemory&) = delete;
+
+		// Creates (or opens an existing one of at least a_bytes) and maps it read-write.
+		bool CreateNamed(std::string_view a_name, std::size_t a_bytes);
+		bool CreateFileBacked(const std::filesystem::path& a_path, std::size_t a_bytes);
+
+		// Maps an existing block read-only; a_bytes is how much of it to map.
+		bool OpenNamed(std::string_view a_name, std::size_t a_bytes);
+		bool OpenFileBacked(const std::filesystem::path& a_path, std::size_t a_bytes);
+
+		void Close() noexcept;
+
+		[[nodiscard]] void* Data() const noexcept { return _data; }
+		[[nodiscard]] std::size_t Size() const noexcept { return _size; }
+		[[nodiscard]] bool IsOpen() const noexcept { return _data != nullptr; }
+
+		struct Impl;
+
+	private:
+		bool Map(bool a_writable, std::size_t a_bytes);
+
+		std::unique_ptr<Impl> _impl;  // OS handles
+		void* _data{ nullptr };
+		std::size_t _size{ 0 };
+	};
+}
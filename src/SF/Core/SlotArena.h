@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace SF::Core
+{
+	// Placeholder for a SlotArena without a cold column.
+	struct NoCold
+	{};
+
+	// Pool of fixed slots addressed by index, for per-actor state.
+	//
+	// Slots live in chunks of ChunkSlots that are never freed or moved: a freed slot goes on a
+	// free list and the next Allocate() reuses it, so once the arena has grown to the peak actor
+	// count nothing allocates any more, and a pointer into a slot stays valid until the slot is
+	// freed. Each slot has two columns in separate arrays: `Hot` (what every event touches,
+	// ideally one cache line) and `Cold` (debug and rarely-touched data), so walking or touching
+	// hot state never pulls cold bytes into the cache.
+	//
+	// Every slot carries a generation, odd while in use. A Handle remembers the generation it was
+	// allocated with; once the slot is freed (and maybe reused) the handle no longer resolves.
+	//
+	// Not synchronised: the owner (ActorStateStore's shards) locks around it.
+	template <class Hot, class Cold = NoCold, std::size_t ChunkSlots = 8>
+	class SlotArena
+	{
+		static_assert(ChunkSlots > 0 && (ChunkSlots & (ChunkSlots - 1)) == 0, "ChunkSlots must be a power of two");
+
+		static constexpr std::uint32_t kChunkShift = static_cast<std::uint32_t>(std::bit_width(ChunkSlots - 1));
+		static constexpr std::uint32_t kNone = ~0u;
+
+	public:
+		static constexpr bool kHasCold = !std::is_same_v<Cold, NoCold>;
+
+	private:
+		struct Chunk
+		{
+			alignas(64) std::array<Hot, ChunkSlots> hot{};
+			std::array<Cold, kHasCold ? ChunkSlots : 0> cold{};
+			std::array<std::uint32_t, ChunkSlots> key{};         // owner's id (FormID)
+			std::array<std::uint32_t, ChunkSlots> generation{};  // odd = in use
+			std::array<std::uint32_t, ChunkSlots> nextFree{};
+		};
+
+	public:
+		struct Handle
+		{
+			std::uint32_t slot{ kNone };
+			std::uint32_t generation{ 0 };  // 0 = null handle
+
+			[[nodiscard]] explicit operator bool() const noexcept { return generation != 0; }
+			[[nodiscard]] bool operator==(const Handle&) const noexcept = default;
+		};
+
+		// A value-initialised slot tagged with a_key.
+		[[nodiscard]] std::uint32_t Allocate(std::uint32_t a_key)
+		{
+			if (_free == kNone) {
+				Grow();
+			}
+			const auto slot = _free;
+			auto& chunk = ChunkOf(slot);
+			const auto i = slot & (ChunkSlots - 1);
+			_free = chunk.nextFree[i];
+
+			chunk.hot[i] = Hot{};
+			if constexpr (kHasCold) {
+				chunk.cold[i] = Cold{};
+			}
+			chunk.key[i] = a_key;
+			++chunk.generation[i];
+			++_live;
+			return slot;
+		}
+
+		void Free(std::uint32_t a_slot) noexcept
+		{
+			auto& chunk = ChunkOf(a_slot);
+			const auto i = a_slot & (ChunkSlots - 1);
+			++chunk.generation[i];
+			chunk.nextFree[i] = _free;
+			_free = a_slot;
+			--_live;
+		}
+
+		[[nodiscard]] Handle HandleOf(std::uint32_t a_slot) const noexcept
+		{
+			return { a_slot, ChunkOf(a_slot).generation[a_slot & (ChunkSlots - 1)] };
+		}
+
+		// The slot a_handle was issued for, if it is still the same allocation.
+		[[nodiscard]] bool Valid(Handle a_handle) const noexcept
+		{
+			return a_handle.generation & 1 &&
+			       (a_handle.slot >> kChunkShift) < _chunks.size() &&
+			       HandleOf(a_handle.slot).generation == a_handle.generation;
+		}
+
+		[[nodiscard]] Hot& HotAt(std::uint32_t a_slot) noexcept { return ChunkOf(a_slot).hot[a_slot & (ChunkSlots - 1)]; }
+		[[nodiscard]] Cold& ColdAt(std::uint32_t a_slot) noexcept { return ChunkOf(a_slot).cold[a_slot & (ChunkSlots - 1)]; }
+		[[nodiscard]] std::uint32_t KeyAt(std::uint32_t a_slot) const noexcept { return ChunkOf(a_slot).key[a_slot & (ChunkSlots - 1)]; }
+
+		// a_fn(slot) for every slot in use. Freeing the visited slot from a_fn is allowed.
+		template <class Fn>
+		void ForEachLive(Fn&& a_fn)
+		{
+			for (std::uint32_t c = 0; c < _chunks.size(); ++c) {
+				auto& chunk = *_chunks[c];
+				for (std::uint32_t i = 0; i < ChunkSlots; ++i) {
+					if (chunk.generation[i] & 1) {
+						a_fn((c << kChunkShift) | i);
+					}
+				}
+			}
+		}
+
+		[[nodiscard]] std::size_t Live() const noexcept { return _live; }
+		[[nodiscard]] std::size_t Capacity() const noexcept { return _chunks.size() * ChunkSlots; }
+		[[nodiscard]] std::size_t Bytes() const noexcept { return _chunks.size() * sizeof(Chunk) + _chunks.capacity() * sizeof(void*); }
+
+	private:
+		[[nodiscard]] Chunk& ChunkOf(std::uint32_t a_slot) noexcept { return *_chunks[a_slot >> kChunkShift]; }
+		[[nodiscard]] const Chunk& ChunkOf(std::uint32_t a_slot) const noexcept { return *_chunks[a_slot >> kChunkShift]; }
+
+		void Grow()
+		{
+			const auto base = static_cast<std::uint32_t>(_chunks.size() << kChunkShift);
+			auto& chunk = *_chunks.emplace_back(std::make_unique<Chunk>());
+			// Lowest slot first, so a fresh arena fills in index order.
+			for (std::uint32_t i = ChunkSlots; i-- > 0;) {
+				chunk.nextFree[i] = _free;
+				_free = base | i;
+			}
+		}
+
+		std::vector<std::unique_ptr<Chunk>> _chunks;
+		std::uint32_t _free{ kNone };
+		std::size_t _live{ 0 };
+	};
+}
@@ -0,0 +1,88 @@
+#include "SF/Core/Telemetry.h"
+
+#include <bit>
+#include <new>
+
+namespace SF::Core::Telemetry
+{
+	void Init(void* a_memory, std::uint32_t a_writerPid) noexcept
+	{
+		auto* region = new (a_memory) Region{};
+		region->header = { .magic = kMagic,
+			.version = kVersion,
+			.snapshotBytes = static_cast<std::uint32_t>(sizeof(Snapshot)),
+			.counters = static_cast<std::uint32_t>(kCounters),
+			.gauges = static_cast<std::uint32_t>(kGauges),
+			.probes = static_cast<std::uint32_t>(Latency::kProbes),
+			.recent = static_cast<std::uint32_t>(kRecent),
+			.writerPid = a_writerPid };
+		// Readers look at the header only after seeing a non-zero seq (acquire).
+		region->seq.store(0, std::memory_order_release);
+	}
+
+	void Publish(Region& a_region, const Snapshot& a_snapshot) noexcept
+	{
+		// Snapshot is trivially copyable (static_assert in the header) and exactly kWords words.
+		const auto words = std::bit_cast<std::array<std::uint64_t, Region::kWords>>(a_snapshot);
+
+		const auto seq = a_region.seq.load(std::memory_order_relaxed);
+		a_region.seq.store(seq + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		for (std::size_t i = 0; i < Region::kWords; ++i) {
+			a_region.words[i].store(words[i], std::memory_order_relaxed);
+		}
+
+		a_region.seq.store(seq + 2, std::memory_order_release);
+	}
+
+	ReadStatus Read(const Region& a_region, Snapshot& a_out, int a_attempts) noexcept
+	{
+		std::array<std::uint64_t, Region::kWords> words;
+		for (int attempt = 0; attempt < a_attempts; ++attempt) {
+			const auto before = a_region.seq.load(std::memory_order_acquire);
+			if (before == 0) {
+				return ReadStatus::kEmpty;
+			}
+
+			const auto& h = a_region.header;
+			if (h.magic != kMagic || h.version != kVersion || h.snapshotBytes != sizeof(Snapshot)) {
+				return ReadStatus::kMismatch;
+			}
+			if (before & 1) {
+				continue;  // publish in progress
+			}
+
+			for (std::size_t i = 0; i < Region::kWords; ++i) {
+				words[i] = a_region.words[i].load(std::memory_order_relaxed);
+			}
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			if (a_region.seq.load(std::memory_order_relaxed) == before) {
+				a_out = std::bit_cast<Snapshot>(words);
+				return ReadStatus::kOk;
+			}
+		}
+		return ReadStatus::kBusy;
+	}
+
+	void SampleCounters(Snapshot& a_out) noexcept
+	{
+		for (std::size_t i = 0; i < kCounters; ++i) {
+			a_out.counters[i] = detail::g_counters[i].load(std::memory_order_relaxed);
+		}
+	}
+
+	void SampleLatency(Snapshot& a_out) noexcept
+	{
+		const auto summaries = Latency::Collect();
+		for (std::size_t i = 0; i < Latency::kProbes; ++i) {
+			const auto& s = summaries[i];
+			a_out.latency[i] = { s.count,
+				static_cast<float>(s.p50Us),
+				static_cast<float>(s.p99Us),
+				static_cast<float>(s.p999Us),
+				static_cast<float>(s.maxUs) };
+		}
+	}
+}
@@ -0,0 +1,192 @@
+#pragma once
+
+#include "SF/Core/AnimTag.h"
+#include "SF/Core/FlightRecorder.h"
+#include "SF/Core/Latency.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace SF::Core::Telemetry
+{
+	// Live counters for an external viewer (tools/TelemetryView.cpp).
+	//
+	// Game threads only bump process-local atomic counters (Count(), one relaxed fetch_add). Once
+	// in a while the main thread gathers them, the gauges, the latency percentiles and the newest
+	// flight-recorder records into a Snapshot and Publish()es it into a Region: a fixed layout
+	// meant to live in shared memory (Core/SharedMemory.h). The region is a seqlock: the writer
+	// never waits for readers, readers copy and retry if a publish overlapped.
+
+	enum class Counter : std::uint8_t
+	{
+		kAnimEvents,        // every graph event the anim-event bus saw
+		kTagStart,          // ... classified as attackStart*
+		kTagSpend,          // ... weapon*Swing
+		kTagUnarmedSound,   // ... SoundPlay.WPNSwingUnarmed
+		kTagJump,           // ... JumpUp
+		kSpends,            // light-attack swings charged
+		kSkips,             // light-attack swings seen but not charged
+		kBlockedHits,       // blocked hits the shield policy handled
+		kBlockedAbsorbed,   // ... fully paid by stamina
+		kBlockedStaminaMilli,  // stamina absorbed by blocks, in 1/1000 points
+		kGuardBreaks,
+		kParries,
+		kJumps,
+
+		kTotal
+	};
+
+	inline constexpr std::size_t kCounters = static_cast<std::size_t>(Counter::kTotal);
+
+	inline constexpr std::array<std::string_view, kCounters> kCounterNames{
+		"anim events",
+		"  attackStart",
+		"  weaponSwing",
+		"  unarmed sound",
+		"  jumpUp",
+		"swings charged",
+		"swings skipped",
+		"blocked hits",
+		"  fully absorbed",
+		"  stamina absorbed",
+		"guard breaks",
+		"parries",
+		"jumps",
+	};
+
+	// Sampled by the publisher.
+	enum class Gauge : std::uint8_t
+	{
+		kAttachedActors,    // actors carrying the anim-event sink
+		kTrackedActors,     // light-attack state entries
+		kTrackedBytes,      // ... and their memory
+		kSequencesWaiting,  // suspended frame coroutines
+		kConfigVersion,
+
+		kTotal
+	};
+
+	inline constexpr std::size_t kGauges = static_cast<std::size_t>(Gauge::kTotal);
+
+	inline constexpr std::array<std::string_view, kGauges> kGaugeNames{
+		"attached actors",
+		"tracked actors",
+		"tracked bytes",
+		"sequences waiting",
+		"config version",
+	};
+
+	namespace detail
+	{
+		inline std::array<std::atomic<std::uint64_t>, kCounters> g_counters{};
+	}
+
+	inline void Count(Counter a_counter, std::uint64_t a_by = 1) noexcept
+	{
+		detail::g_counters[static_cast<std::size_t>(a_counter)].fetch_add(a_by, std::memory_order_relaxed);
+	}
+
+	// The tag-class counters for one classified graph event.
+	inline void CountTag(const AnimTag::Info& a_tag) noexcept
+	{
+		Count(Counter::kAnimEvents);
+		if (a_tag.Any(AnimTag::kFlagStart)) {
+			Count(Counter::kTagStart);
+		} else if (a_tag.Any(AnimTag::kFlagSpend)) {
+			Count(Counter::kTagSpend);
+		} else if (a_tag.Any(AnimTag::kFlagUnarmedSound)) {
+			Count(Counter::kTagUnarmedSound);
+		} else if (a_tag.Any(AnimTag::kFlagJump)) {
+			Count(Counter::kTagJump);
+		}
+	}
+
+	[[nodiscard]] inline std::uint64_t Get(Counter a_counter) noexcept
+	{
+		return detail::g_counters[static_cast<std::size_t>(a_counter)].load(std::memory_order_relaxed);
+	}
+
+	// --- Shared layout (version it when anything below changes) ---
+
+	inline constexpr std::uint32_t kMagic = 0x4C544653;  // "SFTL"
+	inline constexpr std::uint32_t kVersion = 1;
+	inline constexpr std::size_t kRecent = 32;
+
+	struct LatencyRow
+	{
+		std::uint64_t count{ 0 };
+		float p50Us{ 0.0f };
+		float p99Us{ 0.0f };
+		float p999Us{ 0.0f };
+		float maxUs{ 0.0f };
+	};
+
+	struct Snapshot
+	{
+		std::uint64_t publishes{ 0 };
+		std::uint64_t timeUs{ 0 };  // steady clock of the writer, for rates between snapshots
+		std::array<std::uint64_t, kCounters> counters{};
+		std::array<std::uint64_t, kGauges> gauges{};
+		std::array<LatencyRow, Latency::kProbes> latency{};
+		std::uint32_t recentCount{ 0 };
+		std::uint32_t reserved{ 0 };
+		std::array<FlightRecorder::Record, kRecent> recent{};  // oldest first
+	};
+	// Publish()/Read() move it through the region as raw words (std::bit_cast).
+	static_assert(std::is_trivially_copyable_v<Snapshot>, "Snapshot crosses the seqlock as raw words");
+	static_assert(sizeof(Snapshot) % sizeof(std::uint64_t) == 0);
+
+	struct Header
+	{
+		std::uint32_t magic{ 0 };
+		std::uint32_t version{ 0 };
+		std::uint32_t snapshotBytes{ 0 };
+		std::uint32_t counters{ 0 };
+		std::uint32_t gauges{ 0 };
+		std::uint32_t probes{ 0 };
+		std::uint32_t recent{ 0 };
+		std::uint32_t writerPid{ 0 };
+	};
+
+	// The snapshot is stored as relaxed atomic words, so a reader racing a publish reads stale or
+	// mixed words (and then retries) but never performs a data race.
+	struct Region
+	{
+		static constexpr std::size_t kWords = sizeof(Snapshot) / sizeof(std::uint64_t);
+
+		Header header;
+		std::atomic<std::uint64_t> seq;  // odd while a publish is in progress; 0 = nothing yet
+		std::array<std::atomic<std::uint64_t>, kWords> words;
+	};
+	static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "the region is shared between processes");
+
+	inline constexpr std::size_t kRegionBytes = sizeof(Region);
+
+	// Writer: once, before the first Publish(). Resets the whole region (a file-backed one may hold
+	// an older writer's data); readers see "nothing published" until then.
+	void Init(void* a_memory, std::uint32_t a_writerPid) noexcept;
+
+	// Writer: one thread only.
+	void Publish(Region& a_region, const Snapshot& a_snapshot) noexcept;
+
+	enum class ReadStatus : std::uint8_t
+	{
+		kOk,
+		kEmpty,     // no writer yet, or nothing published
+		kMismatch,  // different magic/version/layout: viewer and plugin builds disagree
+		kBusy,      // every attempt overlapped a publish
+	};
+
+	// Reader: any process, never blocks the writer.
+	[[nodiscard]] ReadStatus Read(const Region& a_region, Snapshot& a_out, int a_attempts = 64) noexcept;
+
+	// The process-local counters (publisher side).
+	void SampleCounters(Snapshot& a_out) noexcept;
+
+	// Latency::Collect() in the shared row format.
+	void SampleLatency(Snapshot& a_out) noexcept;
+}
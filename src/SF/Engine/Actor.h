@@ -0,0 +1,53 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+
+namespace SF::Engine
+{
+	// The slice of an actor that the gameplay logic (SF/Logic) is written against.
+	//
+	// The plugin implements it over RE::Actor (SF/Engine/SkyrimActor.h), host builds over an
+	// in-memory actor (SF/Engine/Mock/World.h). Logic is templated on the actor type rather than
+	// calling through virtuals, so the game build pays nothing for the indirection.
+
+	enum class WeaponKind : std::uint8_t
+	{
+		kNone,      // empty hand, spell, shield, torch: treated as unarmed
+		kUnarmed,   // the hand-to-hand WEAP form
+		kOneHand,   // sword, dagger, axe, mace
+		kTwoHand,   // greatsword, battleaxe/warhammer
+		kNonMelee,  // bow, crossbow, staff: never charged for swings
+	};
+
+	struct Weapon
+	{
+		WeaponKind kind{ WeaponKind::kNone };
+		std::uint32_t formID{ 0 };
+		float weight{ 0.0f };
+		float baseCost{ -1.0f };  // keyword override (WeaponCostTable); < 0: derive from weight
+
+		[[nodiscard]] constexpr bool IsWeapon() const noexcept { return kind != WeaponKind::kNone; }
+		[[nodiscard]] constexpr bool IsMelee() const noexcept { return kind == WeaponKind::kUnarmed || kind == WeaponKind::kOneHand || kind == WeaponKind::kTwoHand; }
+		[[nodiscard]] constexpr bool IsTwoHanded() const noexcept { return kind == WeaponKind::kTwoHand; }
+		[[nodiscard]] constexpr bool IsUnarmed() const noexcept { return kind == WeaponKind::kNone || kind == WeaponKind::kUnarmed; }
+	};
+
+	// Stamina writes mirror ActorValueOwner::RestoreActorValue:
+	//   ModStaminaDamage(delta)      kDamage layer: negative drains current stamina, positive undoes damage
+	//   DrainStaminaPermanent(n)     kPermanent layer: survives other mods normalizing kDamage
+	//   ModAttackDamageMult(delta)   kTemporary layer of AttackDamageMult
+	template <class A>
+	concept Actor = requires(A& a, const A& c, bool b, float f) {
+		{ c.FormID() } -> std::convertible_to<std::uint32_t>;
+		{ a.Equipped(b) } -> std::same_as<Weapon>;
+		{ a.Stamina() } -> std::convertible_to<float>;  // current, >= 0
+		{ a.PowerAttacking() } -> std::convertible_to<bool>;
+		{ a.CostMult(b, b) } -> std::convertible_to<float>;  // perk entry point (left hand?, unarmed?)
+		{ a.InMidair() } -> std::convertible_to<bool>;
+		{ a.AttackDamageMult() } -> std::convertible_to<float>;
+		a.ModStaminaDamage(f);
+		a.DrainStaminaPermanent(f);
+		a.ModAttackDamageMult(f);
+	};
+}
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+namespace SF::Engine::Input
+{
+	// Key codes as SKSE/Papyrus and SunderForge.json use them: one number per physical button.
+	//   0..255   keyboard (DirectInput scan codes)
+	//   256..265 mouse buttons (256 = left, 257 = right, 258 = middle, ...)
+	//   266..281 gamepad (XInput buttons in SKSE order, 280/281 = left/right trigger)
+	inline constexpr std::uint32_t kMouseOffset = 256;
+	inline constexpr std::uint32_t kGamepadOffset = 266;
+	inline constexpr std::uint32_t kMaxKeyCode = 512;
+	inline constexpr std::uint32_t kInvalidKey = 0;  // DIK 0 is unused
+
+	// Same values as RE::INPUT_DEVICE.
+	enum class Device : std::uint8_t
+	{
+		kKeyboard,
+		kMouse,
+		kGamepad,
+	};
+
+	[[nodiscard]] constexpr std::uint32_t KeyCode(Device a_device, std::uint32_t a_idCode) noexcept
+	{
+		switch (a_device) {
+		case Device::kKeyboard:
+			return a_idCode < kMouseOffset ? a_idCode : kInvalidKey;
+		case Device::kMouse:
+			return a_idCode < kGamepadOffset - kMouseOffset ? kMouseOffset + a_idCode : kInvalidKey;
+		case Device::kGamepad:
+			switch (a_idCode) {
+			case 0x0001: return kGamepadOffset + 0;   // dpad up
+			case 0x0002: return kGamepadOffset + 1;   // dpad down
+			case 0x0004: return kGamepadOffset + 2;   // dpad left
+			case 0x0008: return kGamepadOffset + 3;   // dpad right
+			case 0x0010: return kGamepadOffset + 4;   // start
+			case 0x0020: return kGamepadOffset + 5;   // back
+			case 0x0040: return kGamepadOffset + 6;   // left thumb
+			case 0x0080: return kGamepadOffset + 7;   // right thumb
+			case 0x0100: return kGamepadOffset + 8;   // left shoulder
+			case 0x0200: return kGamepadOffset + 9;   // right shoulder
+			case 0x1000: return kGamepadOffset + 10;  // A
+			case 0x2000: return kGamepadOffset + 11;  // B
+			case 0x4000: return kGamepadOffset + 12;  // X
+			case 0x8000: return kGamepadOffset + 13;  // Y
+			case 0x0009: return kGamepadOffset + 14;  // left trigger
+			case 0x000A: return kGamepadOffset + 15;  // right trigger
+			default: return kInvalidKey;
+			}
+		default:
+			return kInvalidKey;
+		}
+	}
+
+	enum class Trigger : std::uint8_t
+	{
+		kPress,    // down edge
+		kHold,     // once per press, when held for holdMs
+		kRelease,  // up edge, if it was held at least holdMs
+	};
+
+	struct Binding
+	{
+		std::uint8_t action{ 0 };
+		std::uint32_t key{ kInvalidKey };
+		std::uint32_t modifier{ kInvalidKey };  // chord: must already be down; kInvalidKey = none
+		Trigger trigger{ Trigger::kPress };
+		std::uint32_t holdMs{ 0 };
+		std::uint32_t debounceMs{ 0 };  // per binding: a repeat inside the window is dropped
+	};
+
+	// Flat key code -> binding table for one input sink.
+	//
+	// Dispatch() walks the frame's event chain once. Non-button events (mouse move, thumbstick,
+	// char) are dropped on their type before any lookup; a button costs one array index, then only
+	// the bindings on that key are looked at. Key state (down set, hold-fired, last fire time) is
+	// kept here, so callers do not need globals for edges or debounce.
+	//
+	// Not thread-safe: one instance per sink, and an input sink runs on one thread. Menu state is
+	// the caller's business: check it once per batch, and call ReleaseAll() for skipped batches
+	// so a key let go inside a menu does not stay down.
+	class Bindings
+	{
+	public:
+		static constexpr std::uint8_t kNone = 0xFF;
+
+		Bindings() { _first.fill(kNone); }
+
+		// Returns false for an invalid key or when the table is full.
+		bool Add(const Binding& a_binding)
+		{
+			if (a_binding.key == kInvalidKey || a_binding.key >= kMaxKeyCode || _slots.size() >= kNone ||
+				a_binding.modifier >= kMaxKeyCode) {
+				return false;
+			}
+
+			const auto idx = static_cast<std::uint8_t>(_slots.size());
+			_slots.push_back({ a_binding, _first[a_binding.key] });
+			_first[a_binding.key] = idx;
+			return true;
+		}
+
+		void Clear()
+		{
+			_first.fill(kNone);
+			_slots.clear();
+			_down.reset();
+		}
+
+		void ReleaseAll()
+		{
+			_down.reset();
+			for (auto& s : _slots) {
+				s.holdFired = false;
+			}
+		}
+
+		[[nodiscard]] bool Empty() const noexcept { return _slots.empty(); }
+		[[nodiscard]] bool IsDown(std::uint32_t a_key) const noexcept { return a_key < kMaxKeyCode && _down.test(a_key); }
+
+		// Works for RE::InputEvent and Mock::InputEvent alike:
+		//   e->next, e->GetDevice(), e->AsButtonEvent() (null for non-button events),
+		//   b->GetIDCode(), b->IsDown(), b->IsUp(), b->IsPressed(), b->HeldDuration() (seconds)
+		// a_onAction(action) runs for every binding that fires, in event order.
+		template <class Event, class Fn>
+		void Dispatch(Event* a_head, std::uint64_t a_nowMs, Fn&& a_onAction)
+		{
+			for (auto* e = a_head; e; e = e->next) {
+				auto* b = e->AsButtonEvent();
+				if (!b) {
+					continue;
+				}
+
+				const auto key = KeyCode(static_cast<Device>(e->GetDevice()), static_cast<std::uint32_t>(b->GetIDCode()));
+				if (key == kInvalidKey) {
+					continue;
+				}
+
+				const bool down = b->IsDown();
+				const bool up = b->IsUp();
+				if (down) {
+					_down.set(key);
+				} else if (up) {
+					_down.reset(key);
+				} else if (b->IsPressed()) {
+					_down.set(key);  // held: missed the edge (e.g. pressed inside a menu)
+				}
+
+				const auto heldMs = static_cast<std::uint32_t>(b->HeldDuration() * 1000.0f);
+				for (auto i = _first[key]; i != kNone; i = _slots[i].next) {
+					if (Fires(_slots[i], down, up, heldMs, a_nowMs)) {
+						a_onAction(_slots[i].binding.action);
+					}
+				}
+			}
+		}
+
+	private:
+		struct Slot
+		{
+			Binding binding;
+			std::uint8_t next{ kNone };  // next binding on the same key
+			bool holdFired{ false };
+			std::uint64_t lastFireMs{ 0 };
+			bool everFired{ false };
+		};
+
+		bool Fires(Slot& a_slot, bool a_down, bool a_up, std::uint32_t a_heldMs, std::uint64_t a_nowMs)
+		{
+			const auto& bind = a_slot.binding;
+
+			if (a_down) {
+				a_slot.holdFired = false;
+			}
+
+			bool fire = false;
+			switch (bind.trigger) {
+			case Trigger::kPress:
+				fire = a_down;
+				break;
+			case Trigger::kHold:
+				fire = !a_up && !a_slot.holdFired && a_heldMs >= bind.holdMs && (a_down || bind.holdMs > 0);
+				break;
+			case Trigger::kRelease:
+				fire = a_up && a_heldMs >= bind.holdMs;
+				break;
+			}
+
+			if (!fire || (bind.modifier != kInvalidKey && !_down.test(bind.modifier))) {
+				return false;
+			}
+
+			if (a_slot.everFired && a_nowMs - a_slot.lastFireMs < bind.debounceMs) {
+				return false;
+			}
+			a_slot.lastFireMs = a_nowMs;
+			a_slot.everFired = true;
+
+			// Only a hold that really fired is spent for this press: one turned down for the
+			// modifier or the debounce tries again on the next held event.
+			if (bind.trigger == Trigger::kHold) {
+				a_slot.holdFired = true;
+			}
+			return true;
+		}
+
+		std::array<std::uint8_t, kMaxKeyCode> _first{};
+		std::vector<Slot> _slots;
+		std::bitset<kMaxKeyCode> _down;
+	};
+}
@@ -0,0 +1,21 @@
+// Host builds only: instantiates every SF::Logic template against the mock actor, so the host
+// library type-checks (and sanitizer builds cover) the same code paths the plugin compiles
+// against Engine::SkyrimActor.
+
+#include "SF/Engine/Mock/World.h"
+#include "SF/Logic/BlockedHit.h"
+#include "SF/Logic/JumpCost.h"
+#include "SF/Logic/LightAttackTracker.h"
+#include "SF/Logic/Parry.h"
+
+namespace SF::Logic
+{
+	using MockActor = Engine::Mock::Actor;
+
+	template LightAttack::Outcome LightAttack::Tracker::OnEvent<MockActor>(MockActor&, const Core::AnimTag::Info&, Core::Clock::Ms);
+	template float BlockedHit::Apply<MockActor>(MockActor&, float, float);
+	template bool JumpCost::OnEvent<MockActor>(MockActor&, JumpCost::State&, const Core::AnimTag::Info&);
+	template void JumpCost::Spend<MockActor>(MockActor&);
+	template Parry::Result Parry::OnPress<MockActor>(MockActor&);
+	template void Parry::Drain<MockActor>(MockActor&);
+}
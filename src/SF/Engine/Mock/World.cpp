@@ -0,0 +1,71 @@
+#include "SF/Engine/Mock/World.h"
+
+#include <algorithm>
+
+namespace SF::Engine::Mock
+{
+	float Actor::Stamina() const noexcept
+	{
+		return std::max(0.0f, _staminaBase + _staminaPermanent + _staminaDamage);
+	}
+
+	void Actor::ModStaminaDamage(float a_delta) noexcept
+	{
+		_staminaDamage = std::min(0.0f, _staminaDamage + a_delta);
+	}
+
+	void Actor::DrainStaminaPermanent(float a_amount) noexcept
+	{
+		if (a_amount > 0.0f) {
+			_staminaPermanent -= a_amount;
+		}
+	}
+
+	void Actor::SetStamina(float a_value) noexcept
+	{
+		const float max = _staminaBase + _staminaPermanent;
+		if (a_value > max) {
+			_staminaBase += a_value - max;
+			_staminaDamage = 0.0f;
+		} else {
+			_staminaDamage = a_value - max;
+		}
+	}
+
+	Actor& World::Spawn(std::uint32_t a_formID, float a_stamina)
+	{
+		auto& slot = _actors[a_formID];
+		slot = std::make_unique<Actor>(a_formID, a_stamina);
+		return *slot;
+	}
+
+	Actor* World::Find(std::uint32_t a_formID) noexcept
+	{
+		const auto it = _actors.find(a_formID);
+		return it != _actors.end() ? it->second.get() : nullptr;
+	}
+
+	bool World::Despawn(std::uint32_t a_formID)
+	{
+		return _actors.erase(a_formID) != 0;
+	}
+
+	void World::Clear()
+	{
+		_actors.clear();
+		_tasks.clear();
+	}
+
+	std::size_t World::RunFrame(std::uint32_t a_frameMs)
+	{
+		_nowMs += a_frameMs;
+
+		// Tasks added while running belong to the next frame.
+		std::vector<Task> tasks;
+		tasks.swap(_tasks);
+		for (auto& task : tasks) {
+			task();
+		}
+		return tasks.size();
+	}
+}
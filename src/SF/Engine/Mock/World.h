@@ -0,0 +1,119 @@
+#pragma once
+
+#include "SF/Core/Clock.h"
+#include "SF/Engine/Actor.h"
+#include "SF/Engine/Input.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace SF::Engine::Mock
+{
+	// In-memory stand-in for the game, for host builds (tools, benchmarks, sanitizer runs).
+	//
+	// Actor values follow the engine's layering: current = base + permanent + damage, where the
+	// damage layer is never positive (restoring past zero damage is clamped, like the game does).
+
+	class Actor
+	{
+	public:
+		explicit Actor(std::uint32_t a_formID, float a_stamina = 100.0f) :
+			_formID(a_formID),
+			_staminaBase(a_stamina)
+		{}
+
+		// Engine::Actor
+		[[nodiscard]] std::uint32_t FormID() const noexcept { return _formID; }
+		[[nodiscard]] Weapon Equipped(bool a_left) const noexcept { return _hands[a_left ? 0 : 1]; }
+		[[nodiscard]] float Stamina() const noexcept;
+		[[nodiscard]] bool PowerAttacking() const noexcept { return _powerAttacking; }
+		[[nodiscard]] float CostMult(bool, bool) const noexcept { return _costMult; }
+		[[nodiscard]] bool InMidair() const noexcept { return _midair; }
+		[[nodiscard]] float AttackDamageMult() const noexcept { return 1.0f + _attackDamageMultTemp; }
+
+		void ModStaminaDamage(float a_delta) noexcept;
+		void DrainStaminaPermanent(float a_amount) noexcept;
+		void ModAttackDamageMult(float a_delta) noexcept { _attackDamageMultTemp += a_delta; }
+
+		// Scenario setup
+		void SetStamina(float a_value) noexcept;  // what the engine would report now
+		void Equip(bool a_left, const Weapon& a_weapon) noexcept { _hands[a_left ? 0 : 1] = a_weapon; }
+		void SetPowerAttacking(bool a_value) noexcept { _powerAttacking = a_value; }
+		void SetCostMult(float a_value) noexcept { _costMult = a_value; }
+		void SetMidair(bool a_value) noexcept { _midair = a_value; }
+
+		// Inspection
+		[[nodiscard]] float StaminaDamage() const noexcept { return _staminaDamage; }
+		[[nodiscard]] float StaminaPermanent() const noexcept { return _staminaPermanent; }
+
+	private:
+		std::uint32_t _formID;
+		float _staminaBase;
+		float _staminaPermanent{ 0.0f };
+		float _staminaDamage{ 0.0f };  // <= 0
+		float _attackDamageMultTemp{ 0.0f };
+		float _costMult{ 1.0f };
+		Weapon _hands[2]{};
+		bool _powerAttacking{ false };
+		bool _midair{ false };
+	};
+
+	static_assert(Engine::Actor<Actor>);
+
+	// RE::InputEvent/ButtonEvent in one struct; see Engine::Input::Bindings::Dispatch().
+	struct InputEvent
+	{
+		enum class Type : std::uint8_t
+		{
+			kButton,
+			kMouseMove,
+			kThumbstick,
+			kChar,
+		};
+
+		Type eventType{ Type::kButton };
+		InputEvent* next{ nullptr };
+		std::uint32_t idCode{ 0 };
+		float value{ 0.0f };
+		float heldDownSecs{ 0.0f };
+		Input::Device device{ Input::Device::kKeyboard };
+
+		[[nodiscard]] Input::Device GetDevice() const noexcept { return device; }
+		[[nodiscard]] const InputEvent* AsButtonEvent() const noexcept { return eventType == Type::kButton ? this : nullptr; }
+		[[nodiscard]] bool IsPressed() const noexcept { return value > 0.0f; }
+		[[nodiscard]] bool IsDown() const noexcept { return value != 0.0f && heldDownSecs == 0.0f; }
+		[[nodiscard]] bool IsUp() const noexcept { return value == 0.0f && heldDownSecs != 0.0f; }
+		[[nodiscard]] float HeldDuration() const noexcept { return heldDownSecs; }
+		[[nodiscard]] std::uint32_t GetIDCode() const noexcept { return idCode; }
+	};
+
+	class World
+	{
+	public:
+		using Task = std::function<void()>;
+
+		// Actor addresses are stable until Despawn()/Clear().
+		Actor& Spawn(std::uint32_t a_formID, float a_stamina = 100.0f);
+		[[nodiscard]] Actor* Find(std::uint32_t a_formID) noexcept;
+		bool Despawn(std::uint32_t a_formID);
+		void Clear();
+		[[nodiscard]] std::size_t Size() const noexcept { return _actors.size(); }
+
+		// SKSE::TaskInterface::AddTask: runs at the start of the next RunFrame().
+		void AddTask(Task a_task) { _tasks.push_back(std::move(a_task)); }
+
+		// Advances the clock and runs the tasks queued before this frame. Returns how many ran.
+		std::size_t RunFrame(std::uint32_t a_frameMs = 16);
+
+		[[nodiscard]] Core::Clock::Ms NowMs() const noexcept { return _nowMs; }
+		void SetNowMs(Core::Clock::Ms a_nowMs) noexcept { _nowMs = a_nowMs; }
+
+	private:
+		std::unordered_map<std::uint32_t, std::unique_ptr<Actor>> _actors;
+		std::vector<Task> _tasks;
+		Core::Clock::Ms _nowMs{ 0 };
+	};
+}
@@ -0,0 +1,251 @@
+#pragma once
+
+#include "SF/Core/AvReadCache.h"
+#include "SF/Core/Config.h"
+#include "SF/Engine/Actor.h"
+#include "SF/Engine/SkyrimWeapons.h"
+#include "SF/Logic/CostMultCache.h"
+#include "SF/Logic/WeaponCostTable.h"
+
+#include <RE/Skyrim.h>
+
+#include <algorithm>
+#include <array>
+
+namespace SF::Engine
+{
+	// Engine::Actor over RE::Actor. Plugin-only; cheap to construct per event.
+	// Equipped forms are looked up once and cached for the lifetime of the wrapper.
+	//
+	// AV writes go to Core::AvWriteQueue and reach the engine once per frame (FlushWrites(), from
+	// Events/FrameHook.cpp); "ActorValues.CoalesceWrites": 0 writes straight through instead.
+	// AV reads come from Core::AvReadCache: the engine is asked once per actor and frame (and again
+	// before a light-attack start or spend), and the result includes the writes still queued.
+	class SkyrimActor
+	{
+	public:
+		explicit SkyrimActor(RE::Actor* a_actor) :
+			_actor(a_actor),
+			_avo(a_actor ? a_actor->As<RE::ActorValueOwner>() : nullptr)
+		{}
+
+		[[nodiscard]] RE::Actor* Get() const noexcept { return _actor; }
+
+		[[nodiscard]] std::uint32_t FormID() const { return _actor ? _actor->GetFormID() : 0u; }
+
+		[[nodiscard]] Weapon Equipped(bool a_left) { return Describe(Form(a_left)); }
+
+		[[nodiscard]] float Stamina() const { return _avo ? Read(Core::AvRead::kStamina) : 0.0f; }
+		[[nodiscard]] float MaxStamina() const { return _avo ? Read(Core::AvRead::kMaxStamina) : 0.0f; }
+		[[nodiscard]] float Health() const { return _avo ? Read(Core::AvRead::kHealth) : 0.0f; }
+
+		// True power-attack detection (NPC-safe)
+		[[nodiscard]] bool PowerAttacking() const
+		{
+			if (!_actor) {
+				return false;
+			}
+
+			auto currentProcess = _actor->GetActorRuntimeData().currentProcess;
+			if (!currentProcess) {
+				return false;
+			}
+			auto highProcess = currentProcess->high;
+			if (!highProcess) {
+				return false;
+			}
+			auto attackData = highProcess->attackData;
+			if (!attackData) {
+				return false;
+			}
+
+			auto flags = attackData->data.flags;
+			return flags.any(RE::AttackData::AttackFlag::kPowerAttack) &&
+			       !flags.any(RE::AttackData::AttackFlag::kBashAttack);
+		}
+
+		// Convert "Mod Power Attack Stamina" entry point into a multiplier.
+		// IMPORTANT for this mod:
+		// - We use it as a *global stamina cost multiplier* (applies to both light & power)
+		// - Must NEVER zero-out cost (probe<=0 -> treat as 1.0)
+		[[nodiscard]] float CostMult(bool a_left, bool a_unarmed)
+		{
+			if (!_actor) {
+				return 1.0f;
+			}
+
+			// IMPORTANT: for unarmed we pass actual "Unarmed" WEAP form
+			RE::TESObjectWEAP* weap = a_unarmed ? nullptr : Form(a_left);
+			if (!weap) {
+				weap = SkyrimWeapons::Unarmed();
+			}
+
+			// The perk walk is the expensive part of a spend; cached per (actor, weapon).
+			return Logic::CostMultCache::GetSingleton().Get(FormID(), weap ? weap->GetFormID() : 0u, [&]() {
+				float probe = 100.0f;
+				RE::BGSEntryPoint::HandleEntryPoint(
+					RE::BGSEntryPoint::ENTRY_POINT::kModPowerAttackStamina,
+					_actor,
+					weap,
+					&probe);
+
+				if (probe <= 0.0f) {
+					return 1.0f;
+				}
+
+				const float mult = probe / 100.0f;
+				return std::clamp(mult, 0.05f, 10.0f);
+			});
+		}
+
+		[[nodiscard]] bool InMidair() const { return _actor && _actor->IsInMidair(); }
+
+		[[nodiscard]] float AttackDamageMult() const { return _avo ? Read(Core::AvRead::kAttackDamageMult) : 1.0f; }
+
+		// kDamage: положительное значение "лечит" (уменьшает damage),
+		// отрицательное значение "ранит" (увеличивает damage) => уменьшает текущую стамину.
+		void ModStaminaDamage(float a_delta) { Write(Core::AvSlot::kStaminaDamage, a_delta); }
+
+		void DrainStaminaPermanent(float a_amount)
+		{
+			if (a_amount > 0.0f) {
+				Write(Core::AvSlot::kStaminaPermanent, -a_amount);
+			}
+		}
+
+		void ModAttackDamageMult(float a_delta) { Write(Core::AvSlot::kAttackDamageMultTemporary, a_delta); }
+
+		// Main thread: one RestoreActorValue per (actor, value, layer) that changed this frame.
+		static std::size_t FlushWrites()
+		{
+			return Core::AvWriteQueue::GetSingleton().Flush([](std::uint32_t a_id, Core::AvSlot a_slot, float a_delta) {
+				if (auto* actor = RE::TESForm::LookupByID<RE::Actor>(a_id)) {
+					Apply(actor->As<RE::ActorValueOwner>(), a_slot, a_delta);
+				}
+			});
+		}
+
+		// The RE form behind Equipped() (nullptr for empty hands, spells, shields).
+		[[nodiscard]] RE::TESObjectWEAP* Form(bool a_left)
+		{
+			auto& slot = _weap[a_left ? 0 : 1];
+			if (!slot.looked) {
+				auto* obj = _actor ? _actor->GetEquippedObject(a_left) : nullptr;
+				slot.form = obj ? obj->As<RE::TESObjectWEAP>() : nullptr;
+				slot.looked = true;
+			}
+			return slot.form;
+		}
+
+		// One table load for every form that existed at kDataLoaded; forms created at runtime
+		// (e.g. tempered/enchanted copies) fall back to Classify().
+		[[nodiscard]] static Weapon Describe(const RE::TESObjectWEAP* a_weap)
+		{
+			if (!a_weap) {
+				return {};
+			}
+			if (const auto* e = Logic::WeaponCost::Table::GetSingleton().Find(a_weap->GetFormID())) {
+				return e->ToWeapon();
+			}
+			return Classify(a_weap);
+		}
+
+		// Straight from the form (virtual calls); used to build the cost table.
+		[[nodiscard]] static Weapon Classify(const RE::TESObjectWEAP* a_weap)
+		{
+			if (!a_weap) {
+				return {};
+			}
+
+			Weapon out;
+			out.formID = a_weap->GetFormID();
+			out.weight = std::max(0.0f, a_weap->GetWeight());
+
+			switch (a_weap->GetWeaponType()) {
+			case RE::WEAPON_TYPE::kHandToHandMelee:
+				out.kind = WeaponKind::kUnarmed;
+				break;
+			case RE::WEAPON_TYPE::kOneHandSword:
+			case RE::WEAPON_TYPE::kOneHandDagger:
+			case RE::WEAPON_TYPE::kOneHandAxe:
+			case RE::WEAPON_TYPE::kOneHandMace:
+				out.kind = WeaponKind::kOneHand;
+				break;
+			case RE::WEAPON_TYPE::kTwoHandSword:
+			case RE::WEAPON_TYPE::kTwoHandAxe:
+				out.kind = WeaponKind::kTwoHand;
+				break;
+			default:
+				out.kind = WeaponKind::kNonMelee;
+				break;
+			}
+			return out;
+		}
+
+	private:
+		struct WeaponSlot
+		{
+			RE::TESObjectWEAP* form{ nullptr };
+			bool looked{ false };
+		};
+
+		[[nodiscard]] float Read(Core::AvRead a_read) const
+		{
+			return Core::AvReadCache::GetSingleton().Get(FormID(), a_read, [this](Core::AvReadCache::EngineValues& a_out) {
+				Fill(a_out);
+			});
+		}
+
+		// The virtual calls the cache saves: once per actor and frame.
+		void Fill(Core::AvReadCache::EngineValues& a_out) const
+		{
+			const auto set = [&](Core::AvRead a_read, float a_value) { a_out.value[static_cast<std::size_t>(a_read)] = a_value; };
+
+			set(Core::AvRead::kStamina, _avo->GetActorValue(RE::ActorValue::kStamina));
+			set(Core::AvRead::kMaxStamina, _avo->GetPermanentActorValue(RE::ActorValue::kStamina) +
+			                                  _actor->GetActorValueModifier(RE::ACTOR_VALUE_MODIFIER::kTemporary, RE::ActorValue::kStamina));
+			set(Core::AvRead::kHealth, _avo->GetActorValue(RE::ActorValue::kHealth));
+			set(Core::AvRead::kAttackDamageMult, _avo->GetActorValue(RE::ActorValue::kAttackDamageMult));
+			a_out.staminaDamage = _actor->GetActorValueModifier(RE::ACTOR_VALUE_MODIFIER::kDamage, RE::ActorValue::kStamina);
+		}
+
+		static void Apply(RE::ActorValueOwner* a_avo, Core::AvSlot a_slot, float a_delta)
+		{
+			if (!a_avo) {
+				return;
+			}
+			switch (a_slot) {
+			case Core::AvSlot::kStaminaDamage:
+				a_avo->RestoreActorValue(RE::ACTOR_VALUE_MODIFIER::kDamage, RE::ActorValue::kStamina, a_delta);
+				break;
+			case Core::AvSlot::kStaminaPermanent:
+				a_avo->RestoreActorValue(RE::ACTOR_VALUE_MODIFIER::kPermanent, RE::ActorValue::kStamina, a_delta);
+				break;
+			case Core::AvSlot::kAttackDamageMultTemporary:
+				a_avo->RestoreActorValue(RE::ACTOR_VALUE_MODIFIER::kTemporary, RE::ActorValue::kAttackDamageMult, a_delta);
+				break;
+			default:
+				break;
+			}
+		}
+
+		void Write(Core::AvSlot a_slot, float a_delta)
+		{
+			if (!_avo || a_delta == 0.0f) {
+				return;
+			}
+			if (Core::Config::Get().actorValues.coalesceWrites) {
+				Core::AvReadCache::GetSingleton().Write(FormID(), a_slot, a_delta);
+			} else {
+				Apply(_avo, a_slot, a_delta);
+				Core::AvReadCache::GetSingleton().Invalidate(FormID());
+			}
+		}
+
+		RE::Actor* _actor;
+		RE::ActorValueOwner* _avo;
+		std::array<WeaponSlot, 2> _weap{};
+	};
+
+	static_assert(Actor<SkyrimActor>);
+}
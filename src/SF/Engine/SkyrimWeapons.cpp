@@ -0,0 +1,82 @@
+#include "SF/Engine/SkyrimWeapons.h"
+
+#include "SF/Core/Config.h"
+#include "SF/Core/Log.h"
+#include "SF/Engine/SkyrimActor.h"
+#include "SF/Logic/WeaponCostTable.h"
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace SF::Engine::SkyrimWeapons
+{
+	namespace
+	{
+		constexpr RE::FormID kUnarmedFormID = 0x000001F4;
+
+		std::atomic<RE::TESObjectWEAP*> g_unarmed{ nullptr };
+	}
+
+	RE::TESObjectWEAP* Unarmed()
+	{
+		if (auto* weap = g_unarmed.load(std::memory_order_acquire)) {
+			return weap;
+		}
+		auto* weap = RE::TESForm::LookupByID<RE::TESObjectWEAP>(kUnarmedFormID);
+		g_unarmed.store(weap, std::memory_order_release);
+		return weap;
+	}
+
+	void BuildCostTable()
+	{
+		namespace WC = Logic::WeaponCost;
+
+		g_unarmed.store(RE::TESForm::LookupByID<RE::TESObjectWEAP>(kUnarmedFormID), std::memory_order_release);
+
+		auto* data = RE::TESDataHandler::GetSingleton();
+		if (!data) {
+			SF_LOG_WARN(kLightAttack, "[WeaponCost] no TESDataHandler, cost table left empty");
+			return;
+		}
+
+		// Keyword overrides: resolve editor IDs once, keep config order (first match wins).
+		// Editing them needs a restart; the weight formula itself is read live.
+		std::vector<std::pair<const RE::BGSKeyword*, float>> overrides;
+		for (const auto& o : WC::ParseOverrides(Core::Config::Get().lightAttack.weaponCostOverrides)) {
+			if (const auto* kw = RE::TESForm::LookupByEditorID<RE::BGSKeyword>(o.keyword)) {
+				overrides.emplace_back(kw, o.baseCost);
+			} else {
+				SF_LOG_WARN(kLightAttack, "[WeaponCost] unknown keyword '{}' in WeaponCostOverrides", o.keyword);
+			}
+		}
+
+		const auto& forms = data->GetFormArray<RE::TESObjectWEAP>();
+
+		std::vector<Weapon> weapons;
+		std::vector<const RE::TESObjectWEAP*> sources;
+		weapons.reserve(forms.size());
+		sources.reserve(forms.size());
+		for (const auto* weap : forms) {
+			if (!weap) {
+				continue;
+			}
+			weapons.push_back(SkyrimActor::Classify(weap));
+			sources.push_back(weap);
+		}
+
+		auto& table = WC::Table::GetSingleton();
+		table.Build(weapons, [&](std::size_t a_index, const Weapon&) {
+			const auto* weap = sources[a_index];
+			for (const auto& [kw, cost] : overrides) {
+				if (weap->HasKeyword(kw)) {
+					return cost;
+				}
+			}
+			return -1.0f;
+		});
+
+		SF_LOG_INFO(kLightAttack, "[WeaponCost] {} weapon(s) in cost table, {} keyword override(s) from {} rule(s)",
+			table.Size(), table.Overridden(), overrides.size());
+	}
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <RE/Skyrim.h>
+
+namespace SF::Engine::SkyrimWeapons
+{
+	// Walks every TESObjectWEAP once (kDataLoaded, before the sinks are installed) and fills
+	// Logic::WeaponCost::Table, resolving "WeaponCostOverrides" keywords from SunderForge.json.
+	void BuildCostTable();
+
+	// Skyrim.esm "Unarmed" (0x1F4), looked up once by BuildCostTable().
+	[[nodiscard]] RE::TESObjectWEAP* Unarmed();
+}
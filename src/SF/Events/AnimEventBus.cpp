@@ -0,0 +1,410 @@
+#include "SF/Events/AnimEventBus.h"
+
+#include "SF/Core/AnimTagDict.h"
+#include "SF/Core/Config.h"
+#include "SF/Core/FrameScheduler.h"
+#include "SF/Core/Latency.h"
+#include "SF/Core/Log.h"
+#include "SF/Core/Telemetry.h"
+
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
+namespace SF::Events
+{
+	namespace
+	{
+		namespace Tag = Core::AnimTag;
+
+		// Append-only: a slot is written before the count that publishes it, so the animation
+		// threads read the table without a lock.
+		struct Slot
+		{
+			AnimEventBus::Subscriber sub;
+			std::atomic<std::uint64_t> delivered{ 0 };
+		};
+
+		std::array<Slot, AnimEventBus::kMaxSubscribers> g_slots;
+		std::atomic<std::size_t> g_count{ 0 };
+		std::atomic<std::uint8_t> g_tagUnion{ 0 };  // every subscriber's mask
+
+		std::atomic<std::uint64_t> g_events{ 0 };
+		std::atomic<std::uint64_t> g_fullEvents{ 0 };     // past the reject, full tier
+		std::atomic<std::uint64_t> g_reducedEvents{ 0 };  // past the reject, reduced tier
+
+		// The player and anyone fighting near them.
+		bool FullPath(RE::Actor* a_actor, bool a_player)
+		{
+			if (a_player) {
+				return true;
+			}
+			auto* pc = RE::PlayerCharacter::GetSingleton();
+			if (!pc) {
+				return true;
+			}
+			const float radius = Core::Config::Get().animEvents.fullPathRadius;
+			return a_actor->GetPosition().GetSquaredDistance(pc->GetPosition()) <= radius * radius;
+		}
+
+		// Behavior project of the actor's active graph ("DefaultMale", "WerewolfBeastProject", ...).
+		// Only asked for tags an AnimTagDict file scoped to a project.
+		std::string_view ProjectOf(RE::Actor* a_actor)
+		{
+			RE::BSTSmartPointer<RE::BSAnimationGraphManager> manager;
+			if (!a_actor->GetAnimationGraphManager(manager) || !manager || manager->activeGraph >= manager->graphs.size()) {
+				return {};
+			}
+			const auto& graph = manager->graphs[manager->activeGraph];
+			const char* name = graph ? graph->projectName.c_str() : nullptr;
+			return name ? std::string_view{ name } : std::string_view{};
+		}
+
+		class Sink final : public RE::BSTEventSink<RE::BSAnimationGraphEvent>
+		{
+		public:
+			RE::BSEventNotifyControl ProcessEvent(
+				const RE::BSAnimationGraphEvent* a_event,
+				RE::BSTEventSource<RE::BSAnimationGraphEvent>*) override
+			{
+				if (!a_event || a_event->tag.empty()) {
+					return RE::BSEventNotifyControl::kContinue;
+				}
+				SF_LATENCY_SCOPE(kAnimEventBus);
+				g_events.fetch_add(1, std::memory_order_relaxed);
+
+				const std::string_view tag{ a_event->tag.c_str() ? a_event->tag.c_str() : "" };
+				const auto& dict = Core::AnimTagDict::Get();
+				auto info = dict.Classify(tag);
+				Core::Telemetry::CountTag(info);
+				const auto n = g_count.load(std::memory_order_acquire);
+
+				// Fast reject: the vast majority of graph tags (footsteps, sounds, idles) are nobody's.
+				if (!info.Any(g_tagUnion.load(std::memory_order_relaxed)) && !AnyWantsAll(n)) {
+					return RE::BSEventNotifyControl::kContinue;
+				}
+
+				auto* holder = a_event->holder;
+				auto* actor = holder ? const_cast<RE::Actor*>(holder->As<RE::Actor>()) : nullptr;
+				if (!actor) {
+					return RE::BSEventNotifyControl::kContinue;
+				}
+
+				// Project-scoped tag (an animation pack's dictionary): its role in this actor's graph.
+				if (info.Any(Tag::kFlagScoped)) {
+					info = dict.ForProject(tag, ProjectOf(actor));
+				}
+
+				const AnimEventBus::Event ev{ actor, tag, info, actor->IsPlayerRef() };
+				const bool full = FullPath(actor, ev.player);
+				(full ? g_fullEvents : g_reducedEvents).fetch_add(1, std::memory_order_relaxed);
+
+				for (std::size_t i = 0; i < n; ++i) {
+					auto& slot = g_slots[i];
+					if (slot.sub.playerOnly && !ev.player) {
+						continue;
+					}
+					if (!info.Any(slot.sub.tags) && !(full && slot.sub.wantsAll && slot.sub.wantsAll())) {
+						continue;
+					}
+					slot.delivered.fetch_add(1, std::memory_order_relaxed);
+					slot.sub.onEvent(ev);
+				}
+				return RE::BSEventNotifyControl::kContinue;
+			}
+
+		private:
+			static bool AnyWantsAll(std::size_t a_count)
+			{
+				for (std::size_t i = 0; i < a_count; ++i) {
+					if (g_slots[i].sub.wantsAll && g_slots[i].sub.wantsAll()) {
+						return true;
+					}
+				}
+				return false;
+			}
+		};
+
+		Sink g_sink;
+
+		// Which actors carry g_sink, and on which graph. Combat/load/unload/reset run on the main
+		// thread; the lock is for LogStats() from the input thread.
+		struct Attachment
+		{
+			RE::BSAnimationGraphManager* graph{ nullptr };  // identity only: never dereferenced
+			std::uint32_t attaches{ 0 };  // over the actor's lifetime in this world
+			std::uint32_t sinks{ 0 };     // g_sink registrations on the graph, counted at the last Attach()
+			std::uint32_t combat{ 0 };    // bumped by every combat event: a pending detach checks it
+		};
+
+		std::mutex g_lock;
+		std::unordered_map<RE::FormID, Attachment> g_attached;
+		std::atomic<std::size_t> g_attachedNow{ 0 };
+		std::uint64_t g_attachCalls{ 0 };
+		std::uint64_t g_skipped{ 0 };     // already on this graph
+		std::uint64_t g_reattached{ 0 };  // graph rebuilt under a loaded actor
+		std::uint64_t g_detached{ 0 };
+		std::uint64_t g_combatStarts{ 0 };
+		std::uint64_t g_combatEnds{ 0 };
+
+		// g_sink's registrations across the manager's graphs (AddAnimationGraphEventSink puts it
+		// on the first one). Main thread.
+		std::uint32_t SinkCount(RE::BSAnimationGraphManager& a_manager)
+		{
+			std::uint32_t n = 0;
+			for (auto& graph : a_manager.graphs) {
+				auto* source = graph ? graph->GetEventSource<RE::BSAnimationGraphEvent>() : nullptr;
+				if (!source) {
+					continue;
+				}
+				RE::BSSpinLockGuard locker{ source->lock };
+				n += static_cast<std::uint32_t>(std::count(source->sinks.begin(), source->sinks.end(), std::addressof(g_sink)));
+			}
+			return n;
+		}
+
+		void Attach(RE::Actor* a_actor, std::string_view a_why)
+		{
+			RE::BSTSmartPointer<RE::BSAnimationGraphManager> manager;
+			if (!a_actor->GetAnimationGraphManager(manager) || !manager) {
+				return;  // no 3D yet: the load event will come
+			}
+
+			// The manager's address alone does not identify a graph: a rebuilt one can be allocated
+			// where the old one was. Skip only if this graph really carries the sink.
+			const auto id = a_actor->GetFormID();
+			const auto sinks = SinkCount(*manager);
+			std::uint32_t attaches = 0;
+			{
+				std::scoped_lock _{ g_lock };
+				auto& att = g_attached[id];
+				if (att.graph == manager.get() && sinks > 0) {
+					att.sinks = sinks;
+					++g_skipped;
+					return;
+				}
+				if (att.graph) {
+					++g_reattached;
+				}
+				att.graph = manager.get();
+				attaches = ++att.attaches;
+				++g_attachCalls;
+				g_attachedNow.store(g_attached.size(), std::memory_order_relaxed);
+			}
+
+			a_actor->AddAnimationGraphEventSink(std::addressof(g_sink));
+
+			const auto after = SinkCount(*manager);
+			{
+				std::scoped_lock _{ g_lock };
+				if (const auto it = g_attached.find(id); it != g_attached.end()) {
+					it->second.sinks = after;
+				}
+			}
+			if (after != 1) {
+				SF_LOG_WARN(kGeneral, "[AnimEventBus] {:08X}: {} registration(s) of the sink on its graph after attaching", id, after);
+			}
+			SF_LOG_DEBUG(kGeneral, "[AnimEventBus] {:08X} attached ({}, attach #{}); {} actor(s) attached",
+				id, a_why, attaches, g_attachedNow.load(std::memory_order_relaxed));
+		}
+
+		void Detach(RE::FormID a_id, std::string_view a_why)
+		{
+			{
+				std::scoped_lock _{ g_lock };
+				if (g_attached.erase(a_id) == 0) {
+					return;
+				}
+				++g_detached;
+				g_attachedNow.store(g_attached.size(), std::memory_order_relaxed);
+			}
+
+			if (auto* actor = RE::TESForm::LookupByID<RE::Actor>(a_id)) {
+				actor->RemoveAnimationGraphEventSink(std::addressof(g_sink));
+			}
+
+			const auto n = g_count.load(std::memory_order_acquire);
+			for (std::size_t i = 0; i < n; ++i) {
+				if (const auto onDetach = g_slots[i].sub.onDetach) {
+					onDetach(a_id);
+				}
+			}
+
+			SF_LOG_DEBUG(kGeneral, "[AnimEventBus] {:08X} detached ({}); {} actor(s) attached",
+				a_id, a_why, g_attachedNow.load(std::memory_order_relaxed));
+		}
+
+		// Bumps the actor's combat counter and returns it (0: not attached).
+		std::uint32_t NoteCombat(RE::FormID a_id, bool a_started)
+		{
+			std::scoped_lock _{ g_lock };
+			++(a_started ? g_combatStarts : g_combatEnds);
+			const auto it = g_attached.find(a_id);
+			return it != g_attached.end() ? ++it->second.combat : 0;
+		}
+
+		// Unless the actor fought again in the meantime (any combat event bumps the counter).
+		Core::Frame::Task DetachAfterCombat(RE::FormID a_id, std::uint32_t a_combat, std::chrono::milliseconds a_delay)
+		{
+			co_await Core::Frame::Delay(a_delay);
+
+			{
+				std::scoped_lock _{ g_lock };
+				const auto it = g_attached.find(a_id);
+				if (it == g_attached.end() || it->second.combat != a_combat) {
+					co_return;
+				}
+			}
+			if (auto* actor = RE::TESForm::LookupByID<RE::Actor>(a_id); actor && actor->IsInCombat()) {
+				co_return;  // the next combat-end event schedules again
+			}
+			Detach(a_id, "combat over");
+		}
+
+		class CombatSink final : public RE::BSTEventSink<RE::TESCombatEvent>
+		{
+		public:
+			RE::BSEventNotifyControl ProcessEvent(
+				const RE::TESCombatEvent* a_event,
+				RE::BSTEventSource<RE::TESCombatEvent>*) override
+			{
+				auto* refr = a_event ? a_event->actor.get() : nullptr;
+				auto* actor = refr ? refr->As<RE::Actor>() : nullptr;
+				if (!actor || actor->IsPlayerRef()) {
+					return RE::BSEventNotifyControl::kContinue;  // the player is always attached
+				}
+
+				const auto id = actor->GetFormID();
+				if (a_event->newState.get() != RE::ACTOR_COMBAT_STATE::kNone) {
+					Attach(actor, "combat");
+					NoteCombat(id, true);  // cancels a pending detach
+					return RE::BSEventNotifyControl::kContinue;
+				}
+
+				if (const auto combat = NoteCombat(id, false)) {
+					const std::chrono::milliseconds delay{ Core::Config::Get().animEvents.combatDetachDelayMs };
+					Core::Frame::Scheduler::GetSingleton().Post(DetachAfterCombat(id, combat, delay));
+				}
+				return RE::BSEventNotifyControl::kContinue;
+			}
+		};
+
+		CombatSink g_combatSink;
+
+		class ActorLoadedSink final : public RE::BSTEventSink<RE::TESObjectLoadedEvent>
+		{
+		public:
+			RE::BSEventNotifyControl ProcessEvent(
+				const RE::TESObjectLoadedEvent* a_event,
+				RE::BSTEventSource<RE::TESObjectLoadedEvent>*) override
+			{
+				if (!a_event) {
+					return RE::BSEventNotifyControl::kContinue;
+				}
+
+				if (!a_event->loaded) {
+					Detach(a_event->formID, "unloaded");
+					return RE::BSEventNotifyControl::kContinue;
+				}
+
+				// New 3D means a new graph: re-attach the player and anyone still fighting.
+				auto* refr = RE::TESForm::LookupByID<RE::TESObjectREFR>(a_event->formID);
+				auto* actor = refr ? refr->As<RE::Actor>() : nullptr;
+				if (actor && (actor->IsPlayerRef() || actor->IsInCombat())) {
+					Attach(actor, "loaded");
+				}
+				return RE::BSEventNotifyControl::kContinue;
+			}
+		};
+
+		ActorLoadedSink g_loadedSink;
+	}
+
+	void AnimEventBus::Install()
+	{
+		static std::once_flag once;
+		std::call_once(once, []() {
+			auto* sourceHolder = RE::ScriptEventSourceHolder::GetSingleton();
+			if (!sourceHolder) {
+				SF_LOG_WARN(kGeneral, "[AnimEventBus] ScriptEventSourceHolder is null");
+				return;
+			}
+			sourceHolder->AddEventSink(std::addressof(g_loadedSink));
+			sourceHolder->AddEventSink(std::addressof(g_combatSink));
+			AttachPlayer();
+
+			SF_LOG_INFO(kGeneral, "[AnimEventBus] Installed ({} subscriber(s); player + combat actors)", g_count.load(std::memory_order_acquire));
+		});
+	}
+
+	bool AnimEventBus::Subscribe(const Subscriber& a_subscriber)
+	{
+		static std::mutex lock;
+		std::scoped_lock _{ lock };
+
+		const auto n = g_count.load(std::memory_order_relaxed);
+		if (n == kMaxSubscribers || !a_subscriber.onEvent) {
+			SF_LOG_ERROR(kGeneral, "[AnimEventBus] cannot subscribe '{}'", a_subscriber.name);
+			return false;
+		}
+
+		g_slots[n].sub = a_subscriber;
+		g_tagUnion.fetch_or(a_subscriber.tags, std::memory_order_relaxed);
+		g_count.store(n + 1, std::memory_order_release);
+		return true;
+	}
+
+	void AnimEventBus::AttachPlayer()
+	{
+		if (auto* pc = RE::PlayerCharacter::GetSingleton()) {
+			Attach(pc, "player");
+		}
+	}
+
+	void AnimEventBus::Reset(std::string_view a_reason)
+	{
+		LogStats(a_reason);
+
+		// Pending combat detaches go with the rest of the scheduler (FrameHook::Reset).
+		std::scoped_lock _{ g_lock };
+		g_attached.clear();
+		g_attachedNow.store(0, std::memory_order_relaxed);
+	}
+
+	std::size_t AnimEventBus::Attached() noexcept
+	{
+		return g_attachedNow.load(std::memory_order_relaxed);
+	}
+
+	void AnimEventBus::LogStats(std::string_view a_reason)
+	{
+		{
+			std::scoped_lock _{ g_lock };
+			SF_LOG_INFO(kGeneral, "[AnimEventBus] {} actor(s) attached ({}); attached={} skipped={} reattached={} detached={} combat start/end={}/{}",
+				g_attached.size(), a_reason, g_attachCalls, g_skipped, g_reattached, g_detached, g_combatStarts, g_combatEnds);
+
+			if (SF_LOG_ENABLED(kGeneral, spdlog::level::debug)) {
+				for (const auto& [id, att] : g_attached) {
+					SF_LOG_DEBUG(kGeneral, "[AnimEventBus]   {:08X}: {} sink(s) on its graph, attached {}x", id, att.sinks, att.attaches);
+				}
+			}
+		}
+
+		SF_LOG_INFO(kGeneral, "[AnimEventBus]   events={} full={} reduced={}",
+			g_events.load(std::memory_order_relaxed),
+			g_fullEvents.load(std::memory_order_relaxed),
+			g_reducedEvents.load(std::memory_order_relaxed));
+
+		const auto n = g_count.load(std::memory_order_acquire);
+		for (std::size_t i = 0; i < n; ++i) {
+			SF_LOG_INFO(kGeneral, "[AnimEventBus]   '{}' <- {} event(s)", g_slots[i].sub.name,
+				g_slots[i].delivered.load(std::memory_order_relaxed));
+		}
+	}
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "SF/Core/AnimTag.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace RE
+{
+	class Actor;
+}
+
+namespace SF::Events
+{
+	// The plugin's one BSAnimationGraphEvent sink.
+	//
+	// Who carries it: the player, always, and NPCs while they fight. An NPC is attached when a
+	// TESCombatEvent puts it into combat and detached "AnimEvents.CombatDetachDelayMs" after it
+	// leaves combat (or when it unloads), so merchants, guards and ambient NPCs never pay for
+	// their idles. Registration is once per actor graph: repeated events skip while the graph
+	// still carries the sink, a rebuilt graph (3D reload) is attached again.
+	//
+	// Every event is classified once (Core::AnimTagDict: the built-in tags plus the animation
+	// packs' dictionaries) and handed only to the modules subscribed to that tag class, so a
+	// footstep costs one Classify(), a mask test and the wantsAll() predicates, however many
+	// modules listen. Tiers:
+	//   full     the player and combat actors within "AnimEvents.FullPathRadius" of the player
+	//   reduced  combat actors farther away: only their subscribed tag classes, wantsAll() ignored
+	//
+	// Modules subscribe from their Install() (kDataLoaded, main thread), before or after
+	// AnimEventBus::Install(). Handlers run on the animation threads.
+	class AnimEventBus
+	{
+	public:
+		struct Event
+		{
+			RE::Actor* actor{ nullptr };
+			std::string_view tag;
+			Core::AnimTag::Info info;
+			bool player{ false };
+		};
+
+		struct Subscriber
+		{
+			const char* name{ "" };
+			std::uint8_t tags{ 0 };  // Core::AnimTag::Flag mask
+			bool playerOnly{ false };
+			void (*onEvent)(const Event&){ nullptr };
+			bool (*wantsAll)(){ nullptr };  // optional: while true, full-path actors get every tag (known or not)
+			void (*onDetach)(std::uint32_t a_formID){ nullptr };  // optional: no more events for this actor
+		};
+
+		static constexpr std::size_t kMaxSubscribers = 8;
+
+		static void Install();
+
+		// Returns false when the table is full.
+		static bool Subscribe(const Subscriber& a_subscriber);
+
+		// Attaches to the player's current graph if it is not attached yet (install, post-load).
+		static void AttachPlayer();
+
+		// Forgets every attachment (new game / load game): the graphs belong to the old world.
+		static void Reset(std::string_view a_reason);
+
+		// Actors carrying the sink right now (player included).
+		[[nodiscard]] static std::size_t Attached() noexcept;
+
+		// Attachments, tiers and per-subscriber delivery counts, to the log.
+		static void LogStats(std::string_view a_reason);
+	};
+}
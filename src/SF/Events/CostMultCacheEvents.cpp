@@ -0,0 +1,125 @@
+#include "SF/Events/CostMultCacheEvents.h"
+
+#include "SF/Core/Log.h"
+#include "SF/Logic/CostMultCache.h"
+
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+
+#include <mutex>
+
+namespace SF::Events
+{
+	namespace
+	{
+		inline Logic::CostMultCache& Cache()
+		{
+			return Logic::CostMultCache::GetSingleton();
+		}
+
+		// Actor::AddPerk / Actor::RemovePerk (vtable 0xFB / 0xFC). NPC perks change through
+		// these too, so no event source covers them; hooked separately per vtable because
+		// PlayerCharacter overrides both.
+		template <std::size_t VTableID>
+		struct PerkHooks
+		{
+			static void Install(REL::VariantID a_vtable)
+			{
+				REL::Relocation<std::uintptr_t> vtbl{ a_vtable };
+				_AddPerk = vtbl.write_vfunc(0xFB, AddPerk);
+				_RemovePerk = vtbl.write_vfunc(0xFC, RemovePerk);
+			}
+
+			static void AddPerk(RE::Actor* a_actor, RE::BGSPerk* a_perk, std::uint32_t a_rank)
+			{
+				_AddPerk(a_actor, a_perk, a_rank);
+				if (a_actor) {
+					Cache().Invalidate(a_actor->GetFormID());
+				}
+			}
+
+			static void RemovePerk(RE::Actor* a_actor, RE::BGSPerk* a_perk)
+			{
+				_RemovePerk(a_actor, a_perk);
+				if (a_actor) {
+					Cache().Invalidate(a_actor->GetFormID());
+				}
+			}
+
+			static inline REL::Relocation<decltype(AddPerk)> _AddPerk;
+			static inline REL::Relocation<decltype(RemovePerk)> _RemovePerk;
+		};
+
+		class EquipSink final : public RE::BSTEventSink<RE::TESEquipEvent>
+		{
+		public:
+			static EquipSink* GetSingleton()
+			{
+				static EquipSink instance;
+				return std::addressof(instance);
+			}
+
+			RE::BSEventNotifyControl ProcessEvent(
+				const RE::TESEquipEvent* a_event,
+				RE::BSTEventSource<RE::TESEquipEvent>*) override
+			{
+				// Any item: perk conditions may test shields, armor or spells, not just weapons.
+				if (a_event && a_event->actor) {
+					Cache().Invalidate(a_event->actor->GetFormID());
+				}
+				return RE::BSEventNotifyControl::kContinue;
+			}
+		};
+
+		class LevelSink final : public RE::BSTEventSink<RE::LevelIncrease::Event>
+		{
+		public:
+			static LevelSink* GetSingleton()
+			{
+				static LevelSink instance;
+				return std::addressof(instance);
+			}
+
+			RE::BSEventNotifyControl ProcessEvent(
+				const RE::LevelIncrease::Event* a_event,
+				RE::BSTEventSource<RE::LevelIncrease::Event>*) override
+			{
+				if (a_event && a_event->player) {
+					Cache().Invalidate(a_event->player->GetFormID());
+				}
+				return RE::BSEventNotifyControl::kContinue;
+			}
+		};
+	}
+
+	void CostMultCacheEvents::Install()
+	{
+		static std::once_flag once;
+		std::call_once(once, []() {
+			// Enabled/TTL come from the config snapshot (Plugin::LoadConfig); the hooks stay in
+			// place either way so a reload can turn the cache back on.
+			PerkHooks<0>::Install(RE::VTABLE_Character[0]);
+			PerkHooks<1>::Install(RE::VTABLE_PlayerCharacter[0]);
+
+			if (auto* holder = RE::ScriptEventSourceHolder::GetSingleton()) {
+				holder->AddEventSink(EquipSink::GetSingleton());
+			}
+			if (auto* source = RE::LevelIncrease::GetEventSource()) {
+				source->AddEventSink(LevelSink::GetSingleton());
+			}
+
+			SF_LOG_INFO(kLightAttack, "[PerkMultCache] Installed (enabled={}, ttl={}ms)", Cache().Enabled(), Cache().TtlMs());
+		});
+	}
+
+	void CostMultCacheEvents::Reset(std::string_view a_reason)
+	{
+		const auto c = Cache().GetCounters();
+		const auto lookups = c.hits + c.misses;
+		const auto n = Cache().InvalidateAll();
+		SF_LOG_INFO(kLightAttack, "[PerkMultCache] cleared {} actor(s) ({}); hits={} misses={} (ttl {}) hitRate={:.1f}% invalidations={}",
+			n, a_reason, c.hits, c.misses, c.expired,
+			lookups ? 100.0 * static_cast<double>(c.hits) / static_cast<double>(lookups) : 0.0,
+			c.invalidations);
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string_view>
+
+namespace SF::Events
+{
+	// Keeps Logic::CostMultCache honest: drops an actor's cached perk multipliers when one of
+	// its perks is added/removed, its equipment changes or the player levels up.
+	//   "PerkMultCache": 1          0 = always evaluate the entry point
+	//   "PerkMultCacheTTLMs": 500   0 = keep until invalidated (no condition-driven perks)
+	// (Core::Config keys, applied by Plugin::LoadConfig.)
+	class CostMultCacheEvents
+	{
+	public:
+		static void Install();
+
+		// Logs the hit/miss counters and empties the cache (new game / load game).
+		static void Reset(std::string_view a_reason);
+	};
+}
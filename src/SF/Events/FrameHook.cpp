@@ -0,0 +1,84 @@
+#include "SF/Events/FrameHook.h"
+
+#include "SF/Core/AvReadCache.h"
+#include "SF/Core/AvWriteQueue.h"
+#include "SF/Core/Clock.h"
+#include "SF/Core/Config.h"
+#include "SF/Core/FrameScheduler.h"
+#include "SF/Core/Latency.h"
+#include "SF/Core/Log.h"
+#include "SF/Engine/SkyrimActor.h"
+#include "SF/Events/LatencyReport.h"
+#include "SF/Events/TelemetryExport.h"
+
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+
+#include <mutex>
+
+namespace SF::Events
+{
+	namespace
+	{
+		struct MainUpdate
+		{
+			static void Install()
+			{
+				// Main::Update -> the per-frame call inside it (the usual "on frame" hook site).
+				REL::Relocation<std::uintptr_t> target{ REL::RelocationID(35565, 36564), REL::Relocate(0x748, 0xC26) };
+
+				// The trampoline is allocated once for every hook (Plugin::Init).
+				_Update = SKSE::GetTrampoline().write_call<5>(target.address(), Update);
+			}
+
+			static void Update(RE::Main* a_this, float a_delta)
+			{
+				_Update(a_this, a_delta);
+				Core::Clock::NextFrame();
+				Core::Config::CollectRetired();
+				{
+					SF_LATENCY_SCOPE(kFrameUpdate);
+					Core::Frame::Scheduler::GetSingleton().Tick();
+
+					// After the sequences: their writes land in the same frame.
+					Engine::SkyrimActor::FlushWrites();
+					Core::AvReadCache::GetSingleton().NextFrame();
+				}
+				LatencyReport::OnFrame();
+				TelemetryExport::OnFrame();
+			}
+
+			static inline REL::Relocation<decltype(Update)> _Update;
+		};
+	}
+
+	void FrameHook::Install()
+	{
+		static std::once_flag once;
+		std::call_once(once, []() {
+			MainUpdate::Install();
+			SF_LOG_INFO(kGeneral, "[FrameHook] Installed (coroutine frames up to {} bytes pooled)", Core::Frame::detail::kPooledFrameBytes);
+		});
+	}
+
+	void FrameHook::Reset(std::string_view a_reason)
+	{
+		auto& scheduler = Core::Frame::Scheduler::GetSingleton();
+		const auto n = scheduler.CancelAll();
+		const auto stats = scheduler.GetStats();
+		SF_LOG_INFO(kGeneral, "[FrameHook] {} pending sequence(s) dropped ({}); resumed={} pool={}/{} heap={}",
+			n, a_reason, stats.resumed, stats.poolFree, stats.poolFrames, stats.heapFrames);
+
+		// Writes queued by the state resets that ran just before still belong to this world.
+		const auto writes = Engine::SkyrimActor::FlushWrites();
+		const auto av = Core::AvWriteQueue::GetSingleton().GetCounters();
+		SF_LOG_INFO(kGeneral, "[FrameHook] AV writes: {} flushed now; {} queued -> {} applied over {} frames",
+			writes, av.queued, av.applied, av.flushes);
+
+		auto& reads = Core::AvReadCache::GetSingleton();
+		reads.Clear();
+		const auto rc = reads.GetCounters();
+		SF_LOG_INFO(kGeneral, "[FrameHook] AV reads: {} cached, {} from the engine, {} verify mismatch(es)",
+			rc.hits, rc.fills, rc.mismatches);
+	}
+}
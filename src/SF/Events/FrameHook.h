@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string_view>
+
+namespace SF::Events
+{
+	// Drives Core::Frame::Scheduler::GetSingleton() from the main loop: one Tick() per frame,
+	// right after Main::Update's per-frame call, on the main thread. Core::Clock starts the new
+	// frame first, so everything after it reads that frame's time. The queued AV writes
+	// (Core/AvWriteQueue.h) are applied right after it, then the AV read cache
+	// (Core/AvReadCache.h) moves to the next frame. The periodic latency report
+	// (LatencyReport.h) and the telemetry export (TelemetryExport.h) are timed from here too.
+	class FrameHook
+	{
+	public:
+		static void Install();
+
+		// Drops every pending sequence (new game / load game): their actors are about to go away.
+		// Queued AV writes are applied, not dropped; cached AV reads are dropped.
+		static void Reset(std::string_view a_reason);
+	};
+}
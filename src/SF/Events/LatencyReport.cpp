@@ -0,0 +1,55 @@
+#include "SF/Events/LatencyReport.h"
+
+#include "SF/Core/Clock.h"
+#include "SF/Core/Config.h"
+#include "SF/Core/Latency.h"
+#include "SF/Core/Log.h"
+
+#include <cstdint>
+
+namespace SF::Events
+{
+	namespace
+	{
+		Core::Clock::Ms g_nextReportMs = 0;  // main thread only; 0 = timer not armed
+	}
+
+	void LatencyReport::Report(std::string_view a_reason)
+	{
+		if (!SF_LATENCY) {
+			SF_LOG_INFO(kGeneral, "[Latency] not compiled in (SF_LATENCY_PROBES=OFF)");
+			return;
+		}
+
+		const auto summaries = Core::Latency::Collect();
+		SF_LOG_INFO(kGeneral, "[Latency] report ({}): {} thread(s), {:.0f} ticks/us{}",
+			a_reason, Core::Latency::Threads(), Core::Latency::TicksPerUs(),
+			Core::Latency::Enabled() ? "" : ", recording off");
+
+		for (std::size_t i = 0; i < Core::Latency::kProbes; ++i) {
+			const auto& s = summaries[i];
+			if (s.count == 0) {
+				continue;
+			}
+			SF_LOG_INFO(kGeneral, "[Latency] {:<18} n={:<9} mean={:.2f}us p50={:.2f}us p99={:.2f}us p99.9={:.2f}us max={:.2f}us",
+				Core::Latency::kProbeNames[i], s.count, s.meanUs, s.p50Us, s.p99Us, s.p999Us, s.maxUs);
+		}
+	}
+
+	void LatencyReport::OnFrame()
+	{
+		const auto intervalSec = Core::Config::Get().latency.reportIntervalSec;
+		if (intervalSec == 0) {
+			g_nextReportMs = 0;
+			return;
+		}
+
+		const auto now = Core::Clock::FrameMs();
+		if (g_nextReportMs == 0) {
+			g_nextReportMs = now + intervalSec * 1000ull;
+		} else if (now >= g_nextReportMs) {
+			Report("timer");
+			g_nextReportMs = now + intervalSec * 1000ull;
+		}
+	}
+}
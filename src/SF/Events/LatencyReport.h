@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string_view>
+
+namespace SF::Events
+{
+	// Writes the hook/sink latency histograms (Core/Latency.h) to the log, one line per probe
+	// that has recorded anything: call count, mean, p50/p99/p99.9 and max in microseconds.
+	//   - on demand: the trace dump key (TraceDump.h)
+	//   - on a timer: "Latency.ReportIntervalSec" (0 = off)
+	// Figures are cumulative since start-up.
+	class LatencyReport
+	{
+	public:
+		static void Report(std::string_view a_reason);
+
+		// Main thread, once per frame (FrameHook.cpp): runs the timer.
+		static void OnFrame();
+	};
+}
@@ -1,5 +1,7 @@
 #include "SF/Events/LockpickBlocker.h"
 
+#include "SF/Core/Latency.h"
+
 #include <RE/Skyrim.h>
 #include <RE/L/LockpickingMenu.h>
 #include <RE/M/MenuOpenCloseEvent.h>
@@ -15,6 +17,8 @@ namespace SF::Events
 			const RE::MenuOpenCloseEvent* a_event,
 			RE::BSTEventSource<RE::MenuOpenCloseEvent>*) override
 		{
+			SF_LATENCY_SCOPE(kLockpickMenu);
+
 			if (!a_event) {
 				return RE::BSEventNotifyControl::kContinue;
 			}
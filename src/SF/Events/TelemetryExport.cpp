@@ -0,0 +1,90 @@
+#include "SF/Events/TelemetryExport.h"
+
+#include "SF/Combat/LightAttackStaminaCost.h"
+#include "SF/Core/Clock.h"
+#include "SF/Core/Config.h"
+#include "SF/Core/FrameScheduler.h"
+#include "SF/Core/Log.h"
+#include "SF/Core/SharedMemory.h"
+#include "SF/Core/Telemetry.h"
+#include "SF/Events/AnimEventBus.h"
+
+#include <chrono>
+#include <cstdint>
+
+#include <windows.h>
+
+namespace SF::Events
+{
+	namespace
+	{
+		namespace TM = Core::Telemetry;
+
+		// Main thread only.
+		Core::SharedMemory g_memory;
+		bool g_failed = false;  // creation failed once: don't retry every frame
+		Core::Clock::Ms g_nextPublishMs = 0;
+		TM::Snapshot g_snapshot;  // reused: no allocation per publish
+
+		TM::Region* Region()
+		{
+			if (g_memory.IsOpen()) {
+				return static_cast<TM::Region*>(g_memory.Data());
+			}
+			if (g_failed) {
+				return nullptr;
+			}
+
+			if (!g_memory.CreateNamed(TelemetryExport::kRegionName, TM::kRegionBytes)) {
+				g_failed = true;
+				SF_LOG_WARN(kGeneral, "[Telemetry] could not create shared memory '{}' (error {})",
+					TelemetryExport::kRegionName, ::GetLastError());
+				return nullptr;
+			}
+			TM::Init(g_memory.Data(), static_cast<std::uint32_t>(::GetCurrentProcessId()));
+			SF_LOG_INFO(kGeneral, "[Telemetry] publishing to '{}' ({} bytes, layout v{})",
+				TelemetryExport::kRegionName, TM::kRegionBytes, TM::kVersion);
+			return static_cast<TM::Region*>(g_memory.Data());
+		}
+
+		void Publish(TM::Region& a_region)
+		{
+			auto& s = g_snapshot;
+			s.publishes++;
+			s.timeUs = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count());
+
+			TM::SampleCounters(s);
+
+			const auto state = Combat::LightAttackStaminaCost::StateStats();
+			s.gauges[static_cast<std::size_t>(TM::Gauge::kAttachedActors)] = AnimEventBus::Attached();
+			s.gauges[static_cast<std::size_t>(TM::Gauge::kTrackedActors)] = state.entries;
+			s.gauges[static_cast<std::size_t>(TM::Gauge::kTrackedBytes)] = state.bytes;
+			s.gauges[static_cast<std::size_t>(TM::Gauge::kSequencesWaiting)] = Core::Frame::Scheduler::GetSingleton().GetStats().waiting;
+			s.gauges[static_cast<std::size_t>(TM::Gauge::kConfigVersion)] = Core::Config::Version();
+
+			TM::SampleLatency(s);
+			s.recentCount = static_cast<std::uint32_t>(Core::FlightRecorder::Latest(s.recent));
+
+			TM::Publish(a_region, s);
+		}
+	}
+
+	void TelemetryExport::OnFrame()
+	{
+		const auto intervalMs = Core::Config::Get().telemetry.publishMs;
+		if (intervalMs == 0) {
+			return;
+		}
+
+		const auto now = Core::Clock::FrameMs();
+		if (now < g_nextPublishMs) {
+			return;
+		}
+		g_nextPublishMs = now + intervalMs;
+
+		if (auto* region = Region()) {
+			Publish(*region);
+		}
+	}
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+namespace SF::Events
+{
+	// Publishes Core::Telemetry snapshots into the named shared-memory region
+	// "Sunderandforged.Telemetry" every "Telemetry.PublishMs" (0 = off), for
+	// tools/TelemetryView.cpp to watch while the game runs. The region is created on the first
+	// publish. Reading it never involves the game: the seqlock makes a reader retry, not wait.
+	class TelemetryExport
+	{
+	public:
+		static constexpr const char* kRegionName = "Sunderandforged.Telemetry";
+
+		// Main thread, once per frame (FrameHook.cpp).
+		static void OnFrame();
+	};
+}
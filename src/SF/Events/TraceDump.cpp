@@ -0,0 +1,105 @@
+#include "SF/Events/TraceDump.h"
+
+#include "SF/Core/Clock.h"
+#include "SF/Core/Config.h"
+#include "SF/Core/FlightRecorder.h"
+#include "SF/Core/Log.h"
+#include "SF/Engine/Input.h"
+#include "SF/Events/AnimEventBus.h"
+#include "SF/Events/LatencyReport.h"
+
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+
+namespace SF::Events
+{
+	namespace
+	{
+		// Built once at install: the crash handler must not allocate.
+		std::filesystem::path g_dumpPath;
+		std::filesystem::path g_crashPath;
+
+		LPTOP_LEVEL_EXCEPTION_FILTER g_prevFilter = nullptr;
+
+		LONG WINAPI OnUnhandledException(EXCEPTION_POINTERS* a_info)
+		{
+			static std::atomic<bool> once{ false };
+			if (!once.exchange(true)) {
+				Core::FlightRecorder::SetEnabled(false);  // freeze the rings while we write them
+				Core::FlightRecorder::Dump(g_crashPath);
+			}
+			return g_prevFilter ? g_prevFilter(a_info) : EXCEPTION_CONTINUE_SEARCH;
+		}
+
+		class InputSink final : public RE::BSTEventSink<RE::InputEvent*>
+		{
+		public:
+			RE::BSEventNotifyControl ProcessEvent(
+				RE::InputEvent* const* a_events,
+				RE::BSTEventSource<RE::InputEvent*>*) override
+			{
+				if (!a_events) {
+					return RE::BSEventNotifyControl::kContinue;
+				}
+
+				// Dump key 0 adds no binding: the walk then stops at the type check of each event.
+				if (const auto& cfg = Core::Config::Get(); cfg.version != _boundVersion) {
+					_bindings.Clear();
+					_bindings.Add({ .key = static_cast<std::uint32_t>(cfg.trace.dumpKey), .debounceMs = 1000 });
+					_boundVersion = cfg.version;
+				}
+				if (_bindings.Empty()) {
+					return RE::BSEventNotifyControl::kContinue;
+				}
+
+				_bindings.Dispatch(*a_events, Core::Clock::FrameMs(), [](std::uint8_t) { DumpNow(); });
+				return RE::BSEventNotifyControl::kContinue;
+			}
+
+		private:
+			static void DumpNow()
+			{
+				const auto n = Core::FlightRecorder::Count();
+				if (Core::FlightRecorder::Dump(g_dumpPath)) {
+					SF_LOG_INFO(kGeneral, "[TraceDump] {} record(s) -> {}", n, g_dumpPath.string());
+				} else {
+					SF_LOG_WARN(kGeneral, "[TraceDump] failed to write {}", g_dumpPath.string());
+				}
+				AnimEventBus::LogStats("trace dump");
+				LatencyReport::Report("trace dump");
+			}
+
+			Engine::Input::Bindings _bindings;
+			std::uint64_t _boundVersion{ ~0ull };  // Config version the binding was built from; none yet
+		};
+
+		InputSink g_sink;
+	}
+
+	void TraceDump::Install()
+	{
+		static std::once_flag once;
+		std::call_once(once, []() {
+			auto dir = SKSE::log::log_directory();
+			if (!dir) {
+				SF_LOG_WARN(kGeneral, "[TraceDump] no log directory, dumps disabled");
+				return;
+			}
+			g_dumpPath = *dir / "Sunderandforged.sftr";
+			g_crashPath = *dir / "Sunderandforged_crash.sftr";
+
+			g_prevFilter = ::SetUnhandledExceptionFilter(OnUnhandledException);
+
+			if (auto* mgr = RE::BSInputDeviceManager::GetSingleton()) {
+				mgr->AddEventSink(&g_sink);
+			}
+
+			SF_LOG_INFO(kGeneral, "[TraceDump] Installed (recording={}, dumpKey={:#x})",
+				Core::FlightRecorder::Enabled(), Core::Config::Get().trace.dumpKey);
+		});
+	}
+}
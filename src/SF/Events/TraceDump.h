@@ -0,0 +1,15 @@
+#pragma once
+
+namespace SF::Events
+{
+	// Dumps the flight recorder (SF/Core/FlightRecorder.h) next to the log:
+	//   - on demand: "TraceDumpKey" (default F10) -> Sunderandforged.sftr
+	//   - on crash:  unhandled exception         -> Sunderandforged_crash.sftr
+	// The key also logs the anim-event bus stats and the hook latency report (LatencyReport.h).
+	// "FlightRecorder": 0 in SunderForge.json turns recording off (applied by Plugin::LoadConfig).
+	class TraceDump
+	{
+	public:
+		static void Install();
+	};
+}
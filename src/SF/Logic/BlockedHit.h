@@ -0,0 +1,176 @@
+#pragma once
+
+#include "SF/Core/Config.h"
+#include "SF/Core/FlightRecorder.h"
+#include "SF/Core/Telemetry.h"
+#include "SF/Engine/Actor.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace SF::Logic::BlockedHit
+{
+	// ShieldOfStaminaLite: a blocked hit is paid with stamina first, the rest goes to health.
+
+	struct Split
+	{
+		float staminaDamage{ 0.0f };  // taken from the target's stamina
+		float healthDamage{ 0.0f };   // left in HitData::totalDamage
+	};
+
+	// a_incoming: HitData::totalDamage, a_stamina: target's current stamina,
+	// a_mult: stamina per point of blocked damage.
+	[[nodiscard]] constexpr Split Resolve(float a_incoming, float a_stamina, float a_mult) noexcept
+	{
+		const float staminaDamage = a_incoming * a_mult;
+
+		if (a_stamina <= 0.0f) {
+			// Стамины нет — пускай урон идёт в здоровье как обычно
+			return { 0.0f, a_incoming };
+		}
+
+		if (a_stamina < staminaDamage) {
+			// Стамины не хватает: часть урона поглощается стаминой, остаток — в здоровье.
+			// Сколько "базового" урона можно оплатить текущей стаминой:
+			const float blockedBaseDamage = a_stamina / a_mult;
+			return { a_stamina, a_incoming - blockedBaseDamage };
+		}
+
+		// Стамины хватает: здоровье НЕ трогаем вообще
+		return { staminaDamage, 0.0f };
+	}
+
+	// Writes the split to the target and records it. Returns the damage left for health.
+	template <Engine::Actor A>
+	float Commit(A& a_target, float a_incoming, float a_stamina, const Split& a_split)
+	{
+		if (a_split.staminaDamage > 0.0f) {
+			a_target.ModStaminaDamage(-a_split.staminaDamage);
+		}
+
+		Core::FlightRecorder::Add({ .actor = a_target.FormID(),
+			.kind = Core::FlightRecorder::Kind::kBlockedHit,
+			.cost = a_split.staminaDamage,
+			.baseCost = a_incoming,
+			.startStamina = a_split.healthDamage,
+			.staminaBefore = a_stamina,
+			.staminaAfter = std::max(0.0f, a_stamina - a_split.staminaDamage) });
+
+		namespace TM = Core::Telemetry;
+		TM::Count(TM::Counter::kBlockedHits);
+		if (a_split.healthDamage <= 0.0f) {
+			TM::Count(TM::Counter::kBlockedAbsorbed);
+		}
+		TM::Count(TM::Counter::kBlockedStaminaMilli, static_cast<std::uint64_t>(a_split.staminaDamage * 1000.0f));
+
+		return a_split.healthDamage;
+	}
+
+	// Applies the split to the target and records it. Returns the damage left for health.
+	template <Engine::Actor A>
+	float Apply(A& a_target, float a_incoming, float a_mult)
+	{
+		const float stamina = a_target.Stamina();
+		return Commit(a_target, a_incoming, stamina, Resolve(a_incoming, stamina, a_mult));
+	}
+
+	// --- Policies ---
+	//
+	// The configurable part of the stamina multiplier, one bit per factor group. The plugin
+	// instantiates ApplyPolicy<F> for every combination and picks one when the config is
+	// published (Features()), so a hit only evaluates the groups that are actually configured.
+
+	enum Feature : std::uint8_t
+	{
+		kSides = 1 << 0,        // Shield.PlayerMult / Shield.NPCMult
+		kBlockType = 1 << 1,    // Shield.ShieldBlockMult / Shield.WeaponBlockMult
+		kWeaponClass = 1 << 2,  // Shield.UnarmedMult / OneHandMult / TwoHandMult / RangedMult
+		kGuardBreak = 1 << 3,   // Shield.GuardBreakThreshold
+
+		kFeatureCount = 16
+	};
+
+	using ShieldConfig = Core::Config::Snapshot::Shield;
+
+	[[nodiscard]] constexpr std::uint8_t Features(const ShieldConfig& a_cfg) noexcept
+	{
+		std::uint8_t f = 0;
+		if (a_cfg.playerMult != 1.0f || a_cfg.npcMult != 1.0f) {
+			f |= kSides;
+		}
+		if (a_cfg.shieldBlockMult != 1.0f || a_cfg.weaponBlockMult != 1.0f) {
+			f |= kBlockType;
+		}
+		if (a_cfg.unarmedMult != 1.0f || a_cfg.oneHandMult != 1.0f || a_cfg.twoHandMult != 1.0f || a_cfg.rangedMult != 1.0f) {
+			f |= kWeaponClass;
+		}
+		if (a_cfg.guardBreakThreshold > 0.0f) {
+			f |= kGuardBreak;
+		}
+		return f;
+	}
+
+	// What the hit looks like. The hook fills only the fields its policy reads.
+	struct Hit
+	{
+		float incoming{ 0.0f };  // HitData::totalDamage
+		bool defenderIsPlayer{ false };
+		bool weaponBlock{ false };  // blocked with a weapon rather than a shield
+		Engine::WeaponKind attackerWeapon{ Engine::WeaponKind::kNone };
+	};
+
+	struct Outcome
+	{
+		float healthDamage{ 0.0f };
+		bool guardBreak{ false };  // stagger the defender
+	};
+
+	template <std::uint8_t F>
+	[[nodiscard]] constexpr float Mult(const ShieldConfig& a_cfg, const Hit& a_hit) noexcept
+	{
+		float mult = a_cfg.staminaDamageMult;
+		if constexpr ((F & kSides) != 0) {
+			mult *= a_hit.defenderIsPlayer ? a_cfg.playerMult : a_cfg.npcMult;
+		}
+		if constexpr ((F & kBlockType) != 0) {
+			mult *= a_hit.weaponBlock ? a_cfg.weaponBlockMult : a_cfg.shieldBlockMult;
+		}
+		if constexpr ((F & kWeaponClass) != 0) {
+			switch (a_hit.attackerWeapon) {
+			case Engine::WeaponKind::kOneHand:
+				mult *= a_cfg.oneHandMult;
+				break;
+			case Engine::WeaponKind::kTwoHand:
+				mult *= a_cfg.twoHandMult;
+				break;
+			case Engine::WeaponKind::kNonMelee:
+				mult *= a_cfg.rangedMult;
+				break;
+			default:
+				mult *= a_cfg.unarmedMult;
+				break;
+			}
+		}
+		return mult;
+	}
+
+	template <std::uint8_t F, Engine::Actor A>
+	Outcome ApplyPolicy(A& a_target, const Hit& a_hit, const ShieldConfig& a_cfg)
+	{
+		const float mult = Mult<F>(a_cfg, a_hit);
+		const float stamina = a_target.Stamina();
+		const auto split = Resolve(a_hit.incoming, stamina, mult);
+
+		Outcome out{ Commit(a_target, a_hit.incoming, stamina, split) };
+		if constexpr ((F & kGuardBreak) != 0) {
+			// The guard gives out: stamina could not pay the whole hit and the hit was heavy enough.
+			out.guardBreak = split.healthDamage > 0.0f && a_hit.incoming * mult >= a_cfg.guardBreakThreshold;
+			if (out.guardBreak) {
+				Core::Telemetry::Count(Core::Telemetry::Counter::kGuardBreaks);
+			}
+		}
+		return out;
+	}
+
+	static_assert(Features(ShieldConfig{}) == 0, "default config must select the plain policy");
+}
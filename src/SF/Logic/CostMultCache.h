@@ -0,0 +1,151 @@
+#pragma once
+
+#include "SF/Core/ActorStateStore.h"
+#include "SF/Core/Clock.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace SF::Logic
+{
+	// Per (actor, weapon) cache of the kModPowerAttackStamina entry-point multiplier.
+	//
+	// BGSEntryPoint::HandleEntryPoint walks the actor's whole perk list and evaluates every
+	// condition on each call. The result only changes when perks, equipment or level change
+	// (the plugin invalidates on those, see Events/CostMultCacheEvents.h) or when a perk
+	// condition reads live state (sneaking, health, ...), which the optional TTL covers.
+	class CostMultCache
+	{
+	public:
+		struct Counters
+		{
+			std::uint64_t hits{ 0 };
+			std::uint64_t misses{ 0 };
+			std::uint64_t expired{ 0 };        // misses caused by the TTL
+			std::uint64_t invalidations{ 0 };  // Invalidate()/InvalidateAll() calls
+		};
+
+		[[nodiscard]] static CostMultCache& GetSingleton()
+		{
+			static CostMultCache singleton;
+			return singleton;
+		}
+
+		// Disabled: Get() always computes (the counters still count misses).
+		void SetEnabled(bool a_enabled) noexcept { _enabled.store(a_enabled, std::memory_order_relaxed); }
+		[[nodiscard]] bool Enabled() const noexcept { return _enabled.load(std::memory_order_relaxed); }
+
+		// 0 = entries live until invalidated.
+		void SetTtlMs(std::uint32_t a_ttlMs) noexcept { _ttlMs.store(a_ttlMs, std::memory_order_relaxed); }
+		[[nodiscard]] std::uint32_t TtlMs() const noexcept { return _ttlMs.load(std::memory_order_relaxed); }
+
+		// a_compute() runs outside the shard lock on a miss. A value computed while an
+		// invalidation happened is returned but not stored.
+		template <class Compute>
+		float Get(std::uint32_t a_actor, std::uint32_t a_weapon, Compute&& a_compute)
+		{
+			if (!Enabled()) {
+				_misses.fetch_add(1, std::memory_order_relaxed);
+				return a_compute();
+			}
+
+			const std::uint32_t ttl = TtlMs();
+			const Core::Clock::Ms now = ttl ? Core::Clock::FrameMs() : 0;
+
+			if (auto st = _store.Find(a_actor)) {
+				for (const auto& slot : st->slots) {
+					if (!slot.valid || slot.weapon != a_weapon) {
+						continue;
+					}
+					if (ttl && now - slot.storedMs >= ttl) {
+						_expired.fetch_add(1, std::memory_order_relaxed);
+						break;
+					}
+					_hits.fetch_add(1, std::memory_order_relaxed);
+					return slot.mult;
+				}
+			}
+
+			_misses.fetch_add(1, std::memory_order_relaxed);
+
+			const auto generation = _generation.load(std::memory_order_acquire);
+			const float mult = a_compute();
+
+			auto st = _store.Acquire(a_actor);
+			if (_generation.load(std::memory_order_acquire) == generation) {
+				Store(*st, a_weapon, mult, now);
+			}
+			return mult;
+		}
+
+		// Perk added/removed, equipment changed, level up, unload, death.
+		void Invalidate(std::uint32_t a_actor)
+		{
+			_generation.fetch_add(1, std::memory_order_acq_rel);
+			_invalidations.fetch_add(1, std::memory_order_relaxed);
+			_store.Erase(a_actor, [](std::uint32_t, Entry&) {});
+		}
+
+		// New game / load game / config change.
+		std::size_t InvalidateAll()
+		{
+			_generation.fetch_add(1, std::memory_order_acq_rel);
+			_invalidations.fetch_add(1, std::memory_order_relaxed);
+			return _store.Clear([](std::uint32_t, Entry&) {});
+		}
+
+		[[nodiscard]] Counters GetCounters() const noexcept
+		{
+			return { _hits.load(std::memory_order_relaxed),
+				_misses.load(std::memory_order_relaxed),
+				_expired.load(std::memory_order_relaxed),
+				_invalidations.load(std::memory_order_relaxed) };
+		}
+
+		[[nodiscard]] std::size_t Size() { return _store.Size(); }
+
+	private:
+		struct Slot
+		{
+			std::uint32_t weapon{ 0 };
+			Core::Clock::Ms storedMs{ 0 };
+			float mult{ 1.0f };
+			bool valid{ false };
+		};
+
+		// Left hand, right hand and the Unarmed form cover what an actor swings between changes.
+		struct Entry
+		{
+			std::array<Slot, 3> slots{};
+			std::uint8_t next{ 0 };
+		};
+
+		static void Store(Entry& a_entry, std::uint32_t a_weapon, float a_mult, Core::Clock::Ms a_nowMs)
+		{
+			Slot* target = nullptr;
+			for (auto& slot : a_entry.slots) {
+				if (slot.valid && slot.weapon == a_weapon) {
+					target = &slot;
+					break;
+				}
+			}
+			if (!target) {
+				target = &a_entry.slots[a_entry.next];
+				a_entry.next = static_cast<std::uint8_t>((a_entry.next + 1) % a_entry.slots.size());
+			}
+			*target = { a_weapon, a_nowMs, a_mult, true };
+		}
+
+		Core::ActorStateStore<Entry> _store;
+
+		std::atomic<bool> _enabled{ true };
+		std::atomic<std::uint32_t> _ttlMs{ 0 };
+		std::atomic<std::uint64_t> _generation{ 0 };
+
+		std::atomic<std::uint64_t> _hits{ 0 };
+		std::atomic<std::uint64_t> _misses{ 0 };
+		std::atomic<std::uint64_t> _expired{ 0 };
+		std::atomic<std::uint64_t> _invalidations{ 0 };
+	};
+}
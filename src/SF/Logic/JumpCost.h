@@ -0,0 +1,43 @@
+#pragma once
+
+#include "SF/Core/AnimTag.h"
+#include "SF/Core/Config.h"
+#include "SF/Core/Telemetry.h"
+#include "SF/Engine/Actor.h"
+
+namespace SF::Logic::JumpCost
+{
+	// JumpStaminaCost: JumpUp costs stamina once per airtime ("Jump.StaminaCost").
+
+	struct State
+	{
+		bool spentThisAir{ false };  // уже списали за текущий “полет”
+	};
+
+	// Per animation event of the jumping actor. True: charge now (see Spend()).
+	template <Engine::Actor A>
+	[[nodiscard]] bool OnEvent(A& a_actor, State& a_state, const Core::AnimTag::Info& a_tag)
+	{
+		// если игрок на земле — разрешаем следующее списание
+		if (!a_actor.InMidair()) {
+			a_state.spentThisAir = false;
+		}
+
+		// интересует строго JumpUp; уже списали за этот прыжок — игнор
+		if (!a_tag.IsJump() || a_state.spentThisAir) {
+			return false;
+		}
+
+		a_state.spentThisAir = true;
+		return true;
+	}
+
+	// Списываем "текущую" стамину через damage-modifier (то же, что обычный расход/урон пула).
+	// The plugin runs this on the main thread.
+	template <Engine::Actor A>
+	void Spend(A& a_actor)
+	{
+		a_actor.ModStaminaDamage(-Core::Config::Get().jump.staminaCost);
+		Core::Telemetry::Count(Core::Telemetry::Counter::kJumps);
+	}
+}
@@ -0,0 +1,459 @@
+#pragma once
+
+#include "SF/Core/AnimTag.h"
+#include "SF/Core/Clock.h"
+#include "SF/Core/Config.h"
+#include "SF/Engine/Actor.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace SF::Logic::LightAttack
+{
+	// Engine-independent part of LightAttackStaminaCost: hand resolution, per-hand attack sessions
+	// and the cost/startStamina decision for one animation event.
+	//
+	// Nothing here touches the game. Process() reads the world through an `Env` and returns an
+	// Outcome; Tracker (LightAttackTracker.h) applies it. Any Engine::Actor is a valid Env.
+	//
+	// Env must provide:
+	//   Weapon Equipped(bool a_left)                     what is in that hand
+	//   float  Stamina()                                 current stamina, >= 0
+	//   bool   PowerAttacking()                          the current attack is a power attack
+	//   float  CostMult(bool a_left, bool a_unarmed)     perk entry-point multiplier for that weapon
+	// Only what the decision needs is asked for (e.g. CostMult only on a real spend).
+
+	// Tweakables: Core::Config "LightAttack.*" (defaults in Core/Config.h). Process() loads the
+	// snapshot once per event and hands it down; the helpers default to the current one.
+	using Tunables = Core::Config::Snapshot::LightAttack;
+
+	using Engine::Weapon;
+	using Engine::WeaponKind;
+
+	struct HandSession
+	{
+		Core::Clock::Ms startMs{ 0 };
+
+		// IMPORTANT: snapshot stamina at attack start.
+		// We'll enforce final stamina at spend time to cancel any vanilla drain (esp. power attacks).
+		float startStamina{ 0.0f };
+
+		bool active{ false };
+		bool spent{ false };
+	};
+
+	// Everything an event reads or writes, in one cache line (the Tracker's store keeps one per
+	// actor in a 64-byte aligned array). Wider fields first: no padding inside.
+	struct SessionState
+	{
+		// sessions are indexed by "logical hand": for 2H we map both hands to the same index at runtime.
+		std::array<HandSession, 2> session{};
+
+		// 0 = left, 1 = right
+		std::array<Core::Clock::Ms, 2> lastExplicitHandMs{ 0u, 0u };
+
+		// weaponSwing decoding: remember recent unarmed swing sound
+		Core::Clock::Ms lastUnarmedSoundMs{ 0 };
+		bool lastUnarmedHandIsLeft{ false };
+		bool lastUnarmedHandValid{ false };
+
+		// Tracker: an AttackDamageMult penalty is pending (its details are cold, see ActorCold).
+		bool dmgScaleApplied{ false };
+	};
+	static_assert(sizeof(SessionState) <= 64, "SessionState is the per-event cache line");
+
+	enum class Action : std::uint8_t
+	{
+		kNone,          // not a stamina tag
+		kPairingHint,   // unarmed swing sound: remembered for the next weaponSwing
+		kStart,         // session opened (or kept, if still fresh)
+		kSpend,         // charge: set stamina to staminaAfter
+		kSkip,          // swing not charged, see reason
+	};
+
+	enum class SkipReason : std::uint8_t
+	{
+		kNone,
+		kDuplicate,  // session already spent
+		kNotMelee,
+		kZeroBaseCost,
+		kZeroFinalCost,
+	};
+
+	struct Outcome
+	{
+		Action action{ Action::kNone };
+		SkipReason reason{ SkipReason::kNone };
+		bool left{ false };             // resolved hand
+		std::uint8_t session{ 1 };      // logical session slot (2H -> 1)
+		bool ambiguous{ false };
+		bool treatAsUnarmed{ false };
+		bool power{ false };
+		bool twoHanded{ false };
+		bool insufficient{ false };     // startStamina could not cover the cost
+		bool penaltyExpired{ false };   // set by Tracker: a pending damage penalty timed out on this event
+		std::uint32_t weapon{ 0 };      // FormID of the weapon the session is for (0: unarmed / not melee)
+
+		float baseCost{ 0.0f };
+		float entryMult{ 1.0f };
+		float finalCost{ 0.0f };
+		float startStamina{ 0.0f };     // session snapshot (kStart: after refresh)
+		float staminaBefore{ 0.0f };    // current stamina when the event arrived
+		float staminaAfter{ 0.0f };     // kSpend: enforced target = max(0, startStamina - finalCost)
+		float paid{ 0.0f };
+		float ratio{ 1.0f };            // paid / finalCost -> AttackDamageMult scale
+
+		// A swing that got past the duplicate check replaces any previous damage penalty.
+		[[nodiscard]] constexpr bool ClearsDamageScale() const noexcept
+		{
+			return action == Action::kSpend || (action == Action::kSkip && reason != SkipReason::kDuplicate);
+		}
+
+		[[nodiscard]] constexpr bool ScalesDamage() const noexcept
+		{
+			return action == Action::kSpend && ratio + 1e-6f < 1.0f;
+		}
+	};
+
+	inline void NoteExplicitHandIfAny(const Core::AnimTag::Info& a_tag, SessionState& a_st, Core::Clock::Ms a_nowMs)
+	{
+		if (a_tag.HasLeft()) {
+			a_st.lastExplicitHandMs[0] = a_nowMs;
+		} else if (a_tag.HasRight()) {
+			a_st.lastExplicitHandMs[1] = a_nowMs;
+		}
+	}
+
+	// For 2H weapons, both hands must share the same session index to prevent double spend.
+	[[nodiscard]] inline std::size_t MapHandToSessionIndex(const Weapon& a_weap, std::size_t a_resolvedHandIdx)
+	{
+		if (a_weap.IsTwoHanded()) {
+			return 1u;  // stable single slot for 2H
+		}
+		return a_resolvedHandIdx;
+	}
+
+	inline void RestartSession(HandSession& a_s, Core::Clock::Ms a_nowMs, float a_startStamina)
+	{
+		a_s.active = true;
+		a_s.spent = false;
+		a_s.startMs = a_nowMs;
+		a_s.startStamina = std::max(0.0f, a_startStamina);
+	}
+
+	inline void BeginOrRefreshSession(SessionState& a_st, std::size_t a_sessionIdx, Core::Clock::Ms a_nowMs, float a_startStamina,
+		const Tunables& a_cfg = Core::Config::Get().lightAttack)
+	{
+		auto& s = a_st.session[a_sessionIdx];
+
+		// If an active unspent session is still fresh, keep it (don't overwrite the snapshot).
+		if (s.active && !s.spent && (a_nowMs - s.startMs) <= a_cfg.sessionTimeoutMs) {
+			return;
+		}
+
+		RestartSession(s, a_nowMs, a_startStamina);
+	}
+
+	[[nodiscard]] inline bool CanSpendInSession(SessionState& a_st, std::size_t a_sessionIdx, Core::Clock::Ms a_nowMs, float a_curStamina,
+		const Tunables& a_cfg = Core::Config::Get().lightAttack)
+	{
+		auto& s = a_st.session[a_sessionIdx];
+
+		if (!s.active) {
+			// Some graphs may not emit attackStart; allow implicit session.
+			RestartSession(s, a_nowMs, a_curStamina);
+			return true;
+		}
+
+		if (a_nowMs - s.startMs > a_cfg.sessionTimeoutMs) {
+			// stale session -> restart snapshot
+			RestartSession(s, a_nowMs, a_curStamina);
+			return true;
+		}
+
+		return !s.spent;
+	}
+
+	inline void MarkSessionSpent(SessionState& a_st, std::size_t a_sessionIdx)
+	{
+		auto& s = a_st.session[a_sessionIdx];
+		s.spent = true;
+		s.active = false;
+	}
+
+	[[nodiscard]] inline float GetSessionStartStamina(const SessionState& a_st, std::size_t a_sessionIdx)
+	{
+		return std::max(0.0f, a_st.session[a_sessionIdx].startStamina);
+	}
+
+	// Unarmed: Base. Weapon: Base + weight * WeightMult.
+	// Weapons with a keyword override (WeaponCostTable) carry their cost already.
+	[[nodiscard]] inline float BaseCost(const Weapon& a_weap, const Tunables& a_cfg = Core::Config::Get().lightAttack)
+	{
+		if (a_weap.baseCost >= 0.0f) {
+			return a_weap.baseCost;
+		}
+		const float cost = a_weap.IsUnarmed() ? a_cfg.baseUnarmed : (a_cfg.baseWeapon + std::max(0.0f, a_weap.weight) * a_cfg.weaponWeightMult);
+		return std::max(0.0f, cost);
+	}
+
+	// What the next swing with that hand would cost now: the base cost, perk multiplier and power
+	// multiplier Process() would charge at spend time (Papyrus API). 0 for bows, crossbows, staves.
+	template <class Env>
+	[[nodiscard]] float NextCost(Env& a_env, bool a_left, bool a_power, const Tunables& a_cfg = Core::Config::Get().lightAttack)
+	{
+		const Weapon weap = a_env.Equipped(a_left);
+		if (weap.IsWeapon() && !weap.IsMelee()) {
+			return 0.0f;
+		}
+
+		const float base = BaseCost(weap, a_cfg);
+		if (base <= 0.0f) {
+			return 0.0f;
+		}
+
+		float cost = base * a_env.CostMult(a_left, false);
+		if (a_power) {
+			cost *= a_cfg.powerAttackMult;
+		}
+		return std::max(0.0f, cost);
+	}
+
+	enum class Phase : std::uint8_t
+	{
+		kNone,   // no attack in progress with that hand (or it timed out)
+		kOpen,   // started, not charged yet
+		kSpent,  // charged; a further swing in the same session is a duplicate
+	};
+
+	// The session a swing with that hand would use (2H weapons share slot 1).
+	[[nodiscard]] inline std::size_t SessionIndexFor(const Weapon& a_weap, bool a_left)
+	{
+		return MapHandToSessionIndex(a_weap.IsMelee() ? a_weap : Weapon{}, a_left ? 0u : 1u);
+	}
+
+	[[nodiscard]] inline Phase PhaseOf(const HandSession& a_s, Core::Clock::Ms a_nowMs, const Tunables& a_cfg = Core::Config::Get().lightAttack)
+	{
+		if (a_nowMs - a_s.startMs > a_cfg.sessionTimeoutMs) {
+			return Phase::kNone;
+		}
+		if (a_s.spent) {
+			return Phase::kSpent;
+		}
+		return a_s.active ? Phase::kOpen : Phase::kNone;
+	}
+
+	// Hand resolution is table-driven: the classified tag carries a HandRule (built-in tags and
+	// AnimTagDict files alike), the rule names a short program, and the first step of it that
+	// decides wins. Supporting a new tag never touches this code, only its role in the dictionary.
+	//
+	// Built-in programs:
+	//   explicit Left/Right tags (attackStartLeft, weaponLeftSwing, ...)   that hand
+	//   SoundPlay.WPNSwingUnarmed   empty hand -> recent explicit hand -> RIGHT (remembered for pairing)
+	//   weaponSwing                 paired unarmed sound -> recent explicit hand -> RIGHT
+	//   anything else               stable default RIGHT (prevents "left weapon makes right punch expensive")
+	enum class HandStep : std::uint8_t
+	{
+		kEnd,
+		kLeft,
+		kRight,
+		kPairedUnarmed,   // unarmed swing sound within unarmedPairWindowMs: its hand, as unarmed
+		kEmptyHand,       // exactly one hand holds a melee weapon: the other one
+		kRecentExplicit,  // explicit hand tag within explicitHandWindowMs: the more recent hand
+		kDefaultRight,
+	};
+
+	using HandProgram = std::array<HandStep, 3>;
+
+	inline constexpr std::array<HandProgram, static_cast<std::size_t>(Core::AnimTag::HandRule::kTotal)> kHandPrograms{ {
+		/* kDefaultRight */ { HandStep::kDefaultRight },
+		/* kLeft         */ { HandStep::kLeft },
+		/* kRight        */ { HandStep::kRight },
+		/* kSwing        */ { HandStep::kPairedUnarmed, HandStep::kRecentExplicit, HandStep::kDefaultRight },
+		/* kUnarmedSound */ { HandStep::kEmptyHand, HandStep::kRecentExplicit, HandStep::kDefaultRight },
+	} };
+
+	static_assert([] {
+		for (const auto& program : kHandPrograms) {
+			const auto last = std::find(program.begin(), program.end(), HandStep::kEnd);
+			if (last == program.begin() || (*(last - 1) != HandStep::kLeft && *(last - 1) != HandStep::kRight && *(last - 1) != HandStep::kDefaultRight)) {
+				return false;
+			}
+		}
+		return true;
+	}(), "every hand program must end in a step that always decides");
+
+	// One step; false = undecided, go on with the next one.
+	template <class Env>
+	[[nodiscard]] bool RunHandStep(HandStep a_step, Env& a_env, const SessionState& a_st, Core::Clock::Ms a_nowMs, const Tunables& a_cfg,
+		bool& a_outLeft, bool& a_outTreatAsUnarmed)
+	{
+		switch (a_step) {
+		case HandStep::kLeft:
+			a_outLeft = true;
+			return true;
+		case HandStep::kRight:
+		case HandStep::kDefaultRight:
+			a_outLeft = false;
+			return true;
+		case HandStep::kPairedUnarmed:
+			if (a_st.lastUnarmedHandValid && (a_nowMs - a_st.lastUnarmedSoundMs) <= a_cfg.unarmedPairWindowMs) {
+				a_outTreatAsUnarmed = true;
+				a_outLeft = a_st.lastUnarmedHandIsLeft;
+				return true;
+			}
+			return false;
+		case HandStep::kEmptyHand:
+			{
+				const auto weapL = a_env.Equipped(true);
+				const auto weapR = a_env.Equipped(false);
+				const bool leftHasWeapon = weapL.IsMelee() && !weapL.IsUnarmed();
+				const bool rightHasWeapon = weapR.IsMelee() && !weapR.IsUnarmed();
+				if (leftHasWeapon == rightHasWeapon) {
+					return false;
+				}
+				a_outLeft = rightHasWeapon;  // the unarmed hand is the empty one
+				return true;
+			}
+		case HandStep::kRecentExplicit:
+			{
+				const auto dtL = a_nowMs - a_st.lastExplicitHandMs[0];
+				const auto dtR = a_nowMs - a_st.lastExplicitHandMs[1];
+				if (dtL <= a_cfg.explicitHandWindowMs || dtR <= a_cfg.explicitHandWindowMs) {
+					a_outLeft = (dtL <= dtR);
+					return true;
+				}
+				return false;
+			}
+		case HandStep::kEnd:
+			break;
+		}
+		return false;
+	}
+
+	// Resolve hand & unarmed hint for this event (true = left). A pairing tag (unarmed swing
+	// sound) is always unarmed and remembers its hand for the next ambiguous spend.
+	template <class Env>
+	[[nodiscard]] bool ResolveHandForTag(Env& a_env, const Core::AnimTag::Info& a_tag, SessionState& a_st, Core::Clock::Ms a_nowMs, bool& a_outAmbiguous, bool& a_outTreatAsUnarmed,
+		const Tunables& a_cfg = Core::Config::Get().lightAttack)
+	{
+		a_outAmbiguous = a_tag.HandAmbiguous();
+		a_outTreatAsUnarmed = a_tag.IsUnarmedSound();
+
+		bool left = false;
+		for (const auto step : kHandPrograms[static_cast<std::size_t>(a_tag.hand)]) {
+			if (RunHandStep(step, a_env, a_st, a_nowMs, a_cfg, left, a_outTreatAsUnarmed)) {
+				break;
+			}
+		}
+
+		if (a_tag.IsUnarmedSound()) {
+			a_st.lastUnarmedSoundMs = a_nowMs;
+			a_st.lastUnarmedHandIsLeft = left;
+			a_st.lastUnarmedHandValid = true;
+		}
+		return left;
+	}
+
+	// One animation event for one actor. a_st must be exclusively held by the caller.
+	template <class Env>
+	[[nodiscard]] Outcome Process(Env& a_env, const Core::AnimTag::Info& a_tag, SessionState& a_st, Core::Clock::Ms a_nowMs,
+		const Tunables& a_cfg = Core::Config::Get().lightAttack)
+	{
+		Outcome out;
+
+		NoteExplicitHandIfAny(a_tag, a_st, a_nowMs);
+
+		if (!a_tag.Any(Core::AnimTag::kFlagStaminaMask)) {
+			return out;
+		}
+
+		// Pairing tag only
+		if (a_tag.IsUnarmedSound()) {
+			out.action = Action::kPairingHint;
+			out.left = ResolveHandForTag(a_env, a_tag, a_st, a_nowMs, out.ambiguous, out.treatAsUnarmed, a_cfg);
+			return out;
+		}
+
+		out.left = ResolveHandForTag(a_env, a_tag, a_st, a_nowMs, out.ambiguous, out.treatAsUnarmed, a_cfg);
+		const std::size_t resolvedHandIdx = out.left ? 0u : 1u;
+
+		// Determine weapon for this hand (needed for 2H session mapping, snapshot and cost).
+		// If decoded as unarmed -> no weapon.
+		const Weapon weap = out.treatAsUnarmed ? Weapon{} : a_env.Equipped(out.left);
+
+		// If not melee, we keep "no weapon" for session mapping too (but we'll skip spend later).
+		const Weapon curWeapForSession = weap.IsMelee() ? weap : Weapon{};
+		out.twoHanded = curWeapForSession.IsTwoHanded();
+		out.weapon = curWeapForSession.formID;
+
+		// Map to logical session index (2H => single slot)
+		const std::size_t sessionIdx = MapHandToSessionIndex(curWeapForSession, resolvedHandIdx);
+		out.session = static_cast<std::uint8_t>(sessionIdx);
+
+		out.staminaBefore = a_env.Stamina();
+
+		if (a_tag.IsStart()) {
+			BeginOrRefreshSession(a_st, sessionIdx, a_nowMs, out.staminaBefore, a_cfg);
+			out.action = Action::kStart;
+			out.startStamina = GetSessionStartStamina(a_st, sessionIdx);
+			return out;
+		}
+
+		// Spend
+		if (!CanSpendInSession(a_st, sessionIdx, a_nowMs, out.staminaBefore, a_cfg)) {
+			out.action = Action::kSkip;
+			out.reason = SkipReason::kDuplicate;
+			return out;
+		}
+
+		out.action = Action::kSkip;
+		out.startStamina = GetSessionStartStamina(a_st, sessionIdx);
+
+		if (weap.IsWeapon() && !weap.IsMelee()) {
+			out.reason = SkipReason::kNotMelee;
+			MarkSessionSpent(a_st, sessionIdx);
+			return out;
+		}
+
+		out.baseCost = BaseCost(weap, a_cfg);
+		if (out.baseCost <= 0.0f) {
+			out.reason = SkipReason::kZeroBaseCost;
+			MarkSessionSpent(a_st, sessionIdx);
+			return out;
+		}
+
+		out.power = a_env.PowerAttacking();
+
+		// multiplier applies to BOTH light and power
+		out.entryMult = a_env.CostMult(out.left, out.treatAsUnarmed);
+
+		float finalCost = out.baseCost * out.entryMult;
+		if (out.power) {
+			finalCost *= a_cfg.powerAttackMult;
+		}
+		out.finalCost = std::max(0.0f, finalCost);
+
+		if (out.finalCost <= 0.0f) {
+			out.reason = SkipReason::kZeroFinalCost;
+			MarkSessionSpent(a_st, sessionIdx);
+			return out;
+		}
+
+		// IMPORTANT FIX:
+		// We do NOT "drain additionally" from current stamina (which can include vanilla power-drain already).
+		// Instead we enforce the final stamina based on snapshot at attack start:
+		//   desired = startStamina - finalCost
+		// This cancels any extra vanilla drain and prevents >x2 for 2H power attacks.
+		out.action = Action::kSpend;
+		out.paid = std::min(out.startStamina, out.finalCost);
+		out.ratio = (out.finalCost > 1e-6f) ? std::clamp(out.paid / out.finalCost, 0.0f, 1.0f) : 0.0f;
+		out.staminaAfter = std::max(0.0f, out.startStamina - out.finalCost);
+		out.insufficient = (out.startStamina + 1e-4f < out.finalCost);
+
+		MarkSessionSpent(a_st, sessionIdx);
+		return out;
+	}
+}
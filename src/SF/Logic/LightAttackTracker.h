@@ -0,0 +1,237 @@
+#pragma once
+
+#include "SF/Core/ActorStateStore.h"
+#include "SF/Core/AnimTag.h"
+#include "SF/Core/Config.h"
+#include "SF/Core/FlightRecorder.h"
+#include "SF/Core/Telemetry.h"
+#include "SF/Engine/Actor.h"
+#include "SF/Logic/LightAttackSession.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace SF::Logic::LightAttack
+{
+	// Everything LightAttackStaminaCost's anim-event handler does per event, minus the engine
+	// plumbing: fast reject, per-actor state, the Process() decision, the stamina write, the
+	// AttackDamageMult penalty and the trace.
+	// The plugin feeds it RE::Actor wrappers, host tools and benchmarks feed it mock actors.
+
+	// Per-actor state is split in two columns of the store's arena: SessionState (hot, one cache
+	// line, every event) and ActorCold (touched only while a damage penalty is pending).
+	//
+	// We implement scaling by temporarily adjusting AttackDamageMult; SessionState::dmgScaleApplied
+	// says whether the rest needs looking at.
+	struct ActorCold
+	{
+		Core::Clock::Ms dmgScaleUntilMs{ 0 };
+		float dmgScaleDelta{ 0.0f };
+	};
+
+	// One actor's state as Peek() copies it out.
+	struct ActorState : SessionState, ActorCold
+	{};
+
+	class Tracker
+	{
+	public:
+		using Store = Core::ActorStateStore<SessionState, ActorCold>;
+
+		// Tags that are not ours are dropped before the state lock, unless a damage penalty may be
+		// waiting to expire somewhere.
+		[[nodiscard]] bool WantsEvent(const Core::AnimTag::Info& a_tag) const noexcept
+		{
+			return a_tag.Any(Core::AnimTag::kFlagStaminaMask) ||
+			       _activeDamageScales.load(std::memory_order_relaxed) != 0;
+		}
+
+		template <Engine::Actor A>
+		Outcome OnEvent(A& a_actor, const Core::AnimTag::Info& a_tag, Core::Clock::Ms a_nowMs)
+		{
+			const std::uint32_t id = a_actor.FormID();
+
+			// One lookup per event; the shard stays locked until `st` goes out of scope.
+			auto st = _state.Acquire(id);
+
+			bool expired = false;
+			if (st->dmgScaleApplied && a_nowMs > st.cold().dmgScaleUntilMs) {
+				ClearDamageScale(&a_actor, *st, st.cold());
+				expired = true;
+			}
+
+			// One snapshot for the whole event.
+			const auto& cfg = Core::Config::Get().lightAttack;
+
+			auto out = Process(a_actor, a_tag, *st, a_nowMs, cfg);
+			out.penaltyExpired = expired;
+			if (out.action == Action::kNone) {
+				return out;
+			}
+
+			// Each new spend defines its own scaling; clear previous immediately.
+			if (out.ClearsDamageScale()) {
+				ClearDamageScale(&a_actor, *st, st.cold());
+			}
+
+			if (out.action == Action::kSpend) {
+				// Adjust current stamina to desired (may restore if vanilla already drained).
+				const float delta = out.staminaAfter - out.staminaBefore;
+				if (std::abs(delta) > 1e-6f) {
+					a_actor.ModStaminaDamage(delta);
+				}
+			}
+
+			Trace(id, a_tag.id, out);
+			if (out.action == Action::kSpend) {
+				Core::Telemetry::Count(Core::Telemetry::Counter::kSpends);
+			} else if (out.action == Action::kSkip) {
+				Core::Telemetry::Count(Core::Telemetry::Counter::kSkips);
+			}
+
+			// Apply damage scaling if partial pay
+			if (out.ScalesDamage()) {
+				ApplyDamageScale(a_actor, *st, st.cold(), out.ratio, a_nowMs + cfg.damagePenaltyWindowMs);
+			}
+
+			return out;
+		}
+
+		// Drop one actor's state (unload/death). a_lookup(id) returns std::optional<actor>;
+		// a pending AttackDamageMult penalty is undone on the actor if it still exists.
+		template <class Lookup>
+		bool Evict(std::uint32_t a_id, Lookup&& a_lookup)
+		{
+			return _state.Erase(a_id, [&](std::uint32_t id, SessionState& st, ActorCold& cold) {
+				UndoDamageScale(id, st, cold, a_lookup);
+			});
+		}
+
+		// Drop everything (new game / before a save is loaded).
+		template <class Lookup>
+		std::size_t Clear(Lookup&& a_lookup)
+		{
+			return _state.Clear([&](std::uint32_t id, SessionState& st, ActorCold& cold) {
+				UndoDamageScale(id, st, cold, a_lookup);
+			});
+		}
+
+		// Copy of one actor's sessions and penalty, if it has state (Papyrus API). Takes the shard
+		// lock briefly; never creates an entry.
+		[[nodiscard]] std::optional<ActorState> Peek(std::uint32_t a_id)
+		{
+			if (auto st = _state.Find(a_id)) {
+				return ActorState{ *st, st.cold() };
+			}
+			return std::nullopt;
+		}
+
+		[[nodiscard]] Store::Stats GetStats() { return _state.GetStats(); }
+
+		[[nodiscard]] std::uint32_t ActiveDamageScales() const noexcept { return _activeDamageScales.load(std::memory_order_relaxed); }
+
+	private:
+		template <class Lookup>
+		void UndoDamageScale(std::uint32_t a_id, SessionState& a_st, ActorCold& a_cold, Lookup& a_lookup)
+		{
+			if (!a_st.dmgScaleApplied) {
+				return;
+			}
+			// The actor may already be gone; ClearDamageScale still resets the bookkeeping.
+			auto actor = a_lookup(a_id);
+			ClearDamageScale(actor ? std::addressof(*actor) : nullptr, a_st, a_cold);
+		}
+
+		template <class A>
+		void ClearDamageScale(A* a_actor, SessionState& a_st, ActorCold& a_cold)
+		{
+			if (!a_st.dmgScaleApplied) {
+				return;
+			}
+
+			if (a_actor && std::abs(a_cold.dmgScaleDelta) > 1e-6f) {
+				a_actor->ModAttackDamageMult(-a_cold.dmgScaleDelta);
+			}
+
+			a_st.dmgScaleApplied = false;
+			a_cold.dmgScaleUntilMs = 0;
+			a_cold.dmgScaleDelta = 0.0f;
+			_activeDamageScales.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		template <class A>
+		void ApplyDamageScale(A& a_actor, SessionState& a_st, ActorCold& a_cold, float a_scale01, Core::Clock::Ms a_untilMs)
+		{
+			a_scale01 = std::clamp(a_scale01, 0.0f, 1.0f);
+
+			if (a_st.dmgScaleApplied) {
+				ClearDamageScale(&a_actor, a_st, a_cold);
+			}
+
+			const float cur = a_actor.AttackDamageMult();
+			const float target = cur * a_scale01;
+			const float delta = target - cur;
+
+			if (std::abs(delta) > 1e-6f) {
+				a_actor.ModAttackDamageMult(delta);
+				a_st.dmgScaleApplied = true;
+				a_cold.dmgScaleUntilMs = a_untilMs;
+				a_cold.dmgScaleDelta = delta;
+				_activeDamageScales.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		static void Trace(std::uint32_t a_id, Core::AnimTag::Id a_tag, const Outcome& a_out)
+		{
+			namespace FR = Core::FlightRecorder;
+			static_assert(static_cast<int>(FR::SkipReason::kZeroFinalCost) == static_cast<int>(SkipReason::kZeroFinalCost),
+				"FlightRecorder::SkipReason mirrors LightAttack::SkipReason");
+
+			FR::Kind kind;
+			switch (a_out.action) {
+			case Action::kPairingHint:
+				kind = FR::Kind::kUnarmedSound;
+				break;
+			case Action::kStart:
+				kind = FR::Kind::kStart;
+				break;
+			case Action::kSpend:
+				kind = FR::Kind::kSpend;
+				break;
+			case Action::kSkip:
+				kind = FR::Kind::kSkip;
+				break;
+			default:
+				return;
+			}
+
+			FR::Add({ .actor = a_id,
+				.kind = kind,
+				.tag = a_tag,
+				.hand = a_out.left ? FR::kHandLeft : FR::kHandRight,
+				.session = a_out.action == Action::kPairingHint ? FR::kHandNone : a_out.session,
+				.flags = static_cast<std::uint8_t>(
+					(a_out.power ? FR::kFlagPower : 0) |
+					(a_out.twoHanded ? FR::kFlagTwoHanded : 0) |
+					(a_out.ambiguous ? FR::kFlagAmbiguous : 0) |
+					(a_out.treatAsUnarmed ? FR::kFlagUnarmed : 0) |
+					(a_out.insufficient ? FR::kFlagInsufficient : 0)),
+				.reason = static_cast<FR::SkipReason>(a_out.reason),
+				.cost = a_out.finalCost,
+				.baseCost = a_out.baseCost,
+				.startStamina = a_out.startStamina,
+				.staminaBefore = a_out.staminaBefore,
+				.staminaAfter = a_out.staminaAfter });
+		}
+
+		Store _state;
+
+		// Number of actors with a pending AttackDamageMult penalty.
+		// While it's zero, tags we don't care about can be dropped before taking the state lock.
+		std::atomic<std::uint32_t> _activeDamageScales{ 0 };
+	};
+}
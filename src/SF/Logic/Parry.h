@@ -0,0 +1,39 @@
+#pragma once
+
+#include "SF/Core/Config.h"
+#include "SF/Core/Telemetry.h"
+#include "SF/Engine/Actor.h"
+
+#include <cstdint>
+
+namespace SF::Logic::Parry
+{
+	// DualWielding parry key: affordability and the drain itself. Cost: "Parry.StaminaCost".
+	// Key repeat (анти-дребезг) is dropped by the key binding ("Parry.DebounceMs").
+
+	enum class Result : std::uint8_t
+	{
+		kParry,  // interrupt the attack, drain, play the visual
+		kTooTired,
+	};
+
+	template <Engine::Actor A>
+	[[nodiscard]] Result OnPress(A& a_actor)
+	{
+		const auto& cfg = Core::Config::Get().dualWielding;
+
+		if (a_actor.Stamina() + 1e-3f < cfg.parryStaminaCost) {
+			return Result::kTooTired;
+		}
+		return Result::kParry;
+	}
+
+	// ВАЖНО: kDamage слой легко “перетирается/нормализуется” чужими системами
+	// (LightAttackStaminaCost), поэтому тут kPermanent (это реально уменьшает стамину).
+	template <Engine::Actor A>
+	void Drain(A& a_actor)
+	{
+		a_actor.DrainStaminaPermanent(Core::Config::Get().dualWielding.parryStaminaCost);
+		Core::Telemetry::Count(Core::Telemetry::Counter::kParries);
+	}
+}
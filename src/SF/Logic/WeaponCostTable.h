@@ -0,0 +1,195 @@
+#pragma once
+
+#include "SF/Engine/Actor.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace SF::Logic::WeaponCost
+{
+	// Per-weapon class, weight and keyword cost override, resolved once when data loads (walk of
+	// every TESObjectWEAP, see Engine/SkyrimWeapons.cpp) instead of per swing through
+	// GetWeaponType()/GetWeight()/keyword checks. The weight formula itself stays live
+	// (LightAttack::BaseCost) so "LightAttack.*" config reloads apply without a rebuild.
+	//
+	// Built on one thread before any sink is registered and never modified afterwards, so
+	// lookups take no lock.
+
+	enum Class : std::uint8_t
+	{
+		kClassMelee = 1 << 0,
+		kClassTwoHanded = 1 << 1,
+		kClassUnarmed = 1 << 2,
+		kClassOverride = 1 << 3,  // baseCost comes from a keyword override
+	};
+
+	[[nodiscard]] constexpr std::uint8_t ClassOf(Engine::WeaponKind a_kind) noexcept
+	{
+		using Engine::WeaponKind;
+		switch (a_kind) {
+		case WeaponKind::kUnarmed:
+			return kClassMelee | kClassUnarmed;
+		case WeaponKind::kOneHand:
+			return kClassMelee;
+		case WeaponKind::kTwoHand:
+			return kClassMelee | kClassTwoHanded;
+		default:
+			return 0;
+		}
+	}
+
+	struct Entry
+	{
+		std::uint32_t formID{ 0 };  // 0 = empty slot
+		Engine::WeaponKind kind{ Engine::WeaponKind::kNone };
+		std::uint8_t classBits{ 0 };
+		float weight{ 0.0f };
+		float baseCost{ -1.0f };  // keyword override, < 0: none
+
+		[[nodiscard]] Engine::Weapon ToWeapon() const noexcept { return { kind, formID, weight, baseCost }; }
+	};
+
+	// "WeaponCostOverrides": "WeapTypeDagger=4, WeapMaterialDaedric=14"
+	// Keyword editor IDs with an absolute base cost; the first keyword a weapon has wins.
+	struct Override
+	{
+		std::string keyword;
+		float baseCost{ 0.0f };
+	};
+
+	[[nodiscard]] inline std::vector<Override> ParseOverrides(std::string_view a_text)
+	{
+		const auto trim = [](std::string_view s) {
+			while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) {
+				s.remove_prefix(1);
+			}
+			while (!s.empty() && (s.back() == ' ' || s.back() == '\t')) {
+				s.remove_suffix(1);
+			}
+			return s;
+		};
+
+		std::vector<Override> out;
+		while (!a_text.empty()) {
+			const auto comma = a_text.find_first_of(",;");
+			const auto item = trim(a_text.substr(0, comma));
+			a_text = comma == std::string_view::npos ? std::string_view{} : a_text.substr(comma + 1);
+
+			const auto eq = item.find('=');
+			if (eq == std::string_view::npos) {
+				continue;
+			}
+
+			const auto key = trim(item.substr(0, eq));
+			const std::string value{ trim(item.substr(eq + 1)) };
+			char* end = nullptr;
+			const float cost = std::strtof(value.c_str(), &end);
+			if (key.empty() || end == value.c_str() || cost < 0.0f) {
+				continue;
+			}
+			out.push_back({ std::string{ key }, cost });
+		}
+		return out;
+	}
+
+	// Open-addressed FormID -> Entry map in one flat array (linear probing, load factor <= 0.5).
+	class Table
+	{
+	public:
+		[[nodiscard]] static Table& GetSingleton()
+		{
+			static Table singleton;
+			return singleton;
+		}
+
+		// a_override(index, weapon) returns an override cost (>= 0) or a negative value for none.
+		template <class OverrideFn>
+		void Build(const std::vector<Engine::Weapon>& a_weapons, OverrideFn&& a_override)
+		{
+			const std::size_t capacity = std::bit_ceil(std::max<std::size_t>(16, a_weapons.size() * 2));
+			_slots.assign(capacity, Entry{});
+			_mask = static_cast<std::uint32_t>(capacity - 1);
+			_shift = static_cast<std::uint32_t>(32 - std::countr_zero(capacity));
+			_size = 0;
+			_overridden = 0;
+
+			for (std::size_t i = 0; i < a_weapons.size(); ++i) {
+				const auto& weap = a_weapons[i];
+				if (weap.formID == 0) {
+					continue;
+				}
+
+				Entry e;
+				e.formID = weap.formID;
+				e.kind = weap.kind;
+				e.classBits = ClassOf(weap.kind);
+				e.weight = std::max(0.0f, weap.weight);
+				if (const float cost = a_override(i, weap); cost >= 0.0f) {
+					e.baseCost = cost;
+					e.classBits |= kClassOverride;
+					++_overridden;
+				}
+
+				Insert(e);
+			}
+		}
+
+		void Build(const std::vector<Engine::Weapon>& a_weapons)
+		{
+			Build(a_weapons, [](std::size_t, const Engine::Weapon&) { return -1.0f; });
+		}
+
+		[[nodiscard]] const Entry* Find(std::uint32_t a_formID) const noexcept
+		{
+			if (_slots.empty() || a_formID == 0) {
+				return nullptr;
+			}
+			for (std::uint32_t i = Slot(a_formID);; i = (i + 1) & _mask) {
+				const auto& e = _slots[i];
+				if (e.formID == a_formID) {
+					return &e;
+				}
+				if (e.formID == 0) {
+					return nullptr;
+				}
+			}
+		}
+
+		[[nodiscard]] std::size_t Size() const noexcept { return _size; }
+		[[nodiscard]] std::size_t Overridden() const noexcept { return _overridden; }
+
+	private:
+		[[nodiscard]] std::uint32_t Slot(std::uint32_t a_formID) const noexcept
+		{
+			// Fibonacci hashing: FormIDs share their high (load order) byte.
+			return (a_formID * 0x9E3779B1u) >> _shift;
+		}
+
+		void Insert(const Entry& a_entry)
+		{
+			for (std::uint32_t i = Slot(a_entry.formID);; i = (i + 1) & _mask) {
+				auto& e = _slots[i];
+				if (e.formID == a_entry.formID) {
+					e = a_entry;  // duplicate form: last one wins
+					return;
+				}
+				if (e.formID == 0) {
+					e = a_entry;
+					++_size;
+					return;
+				}
+			}
+		}
+
+		std::vector<Entry> _slots;
+		std::uint32_t _mask{ 0 };
+		std::uint32_t _shift{ 32 };
+		std::size_t _size{ 0 };
+		std::size_t _overridden{ 0 };
+	};
+}
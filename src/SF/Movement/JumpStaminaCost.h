@@ -0,0 +1,11 @@
+#pragma once
+
+namespace SF::Movement
+{
+	// Spends a flat amount of stamina when the player jumps (JumpUp tag, once per airtime).
+	class JumpStaminaCost
+	{
+	public:
+		static void Install();
+	};
+}
@@ -0,0 +1,185 @@
+#include "SF/Papyrus/StaminaApi.h"
+
+#include "SF/Combat/LightAttackStaminaCost.h"
+#include "SF/Core/Clock.h"
+#include "SF/Core/Config.h"
+#include "SF/Core/Log.h"
+#include "SF/Engine/SkyrimActor.h"
+#include "SF/Logic/LightAttackSession.h"
+#include "SF/Logic/Parry.h"
+
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+
+#include <cstdint>
+#include <mutex>
+
+namespace SF::Papyrus
+{
+	namespace
+	{
+		namespace LA = Logic::LightAttack;
+
+		constexpr std::string_view kClass = "SunderForge";
+		constexpr std::int32_t kApiVersion = 1;
+
+		std::int32_t GetApiVersion(RE::StaticFunctionTag*)
+		{
+			return kApiVersion;
+		}
+
+		// --- Light attacks ---
+
+		float GetNextAttackCost(RE::StaticFunctionTag*, RE::Actor* a_actor, bool a_leftHand, bool a_powerAttack)
+		{
+			if (!a_actor) {
+				return 0.0f;
+			}
+			Engine::SkyrimActor a{ a_actor };
+			return LA::NextCost(a, a_leftHand, a_powerAttack);
+		}
+
+		// The session a swing with that hand would use right now, as LA::Phase (0 none, 1 open, 2 spent).
+		std::int32_t GetAttackSessionState(RE::StaticFunctionTag*, RE::Actor* a_actor, bool a_leftHand)
+		{
+			if (!a_actor) {
+				return 0;
+			}
+			const auto st = Combat::LightAttackStaminaCost::PeekState(a_actor->GetFormID());
+			if (!st) {
+				return 0;
+			}
+			Engine::SkyrimActor a{ a_actor };
+			const auto idx = LA::SessionIndexFor(a.Equipped(a_leftHand), a_leftHand);
+			return static_cast<std::int32_t>(LA::PhaseOf(st->session[idx], Core::Clock::FrameMs()));
+		}
+
+		// Stamina snapshot the open (or last) session of that hand charges against; -1 without one.
+		float GetAttackSessionStamina(RE::StaticFunctionTag*, RE::Actor* a_actor, bool a_leftHand)
+		{
+			if (!a_actor) {
+				return -1.0f;
+			}
+			const auto st = Combat::LightAttackStaminaCost::PeekState(a_actor->GetFormID());
+			if (!st) {
+				return -1.0f;
+			}
+			Engine::SkyrimActor a{ a_actor };
+			const auto& s = st->session[LA::SessionIndexFor(a.Equipped(a_leftHand), a_leftHand)];
+			if (LA::PhaseOf(s, Core::Clock::FrameMs()) == LA::Phase::kNone) {
+				return -1.0f;
+			}
+			return s.startStamina;
+		}
+
+		// AttackDamageMult taken away by an underpaid swing (<= 0), 0 when no penalty is pending.
+		float GetDamagePenalty(RE::StaticFunctionTag*, RE::Actor* a_actor)
+		{
+			if (!a_actor) {
+				return 0.0f;
+			}
+			const auto st = Combat::LightAttackStaminaCost::PeekState(a_actor->GetFormID());
+			return st && st->dmgScaleApplied ? st->dmgScaleDelta : 0.0f;
+		}
+
+		// Milliseconds until the penalty is lifted (on the actor's next animation event after that).
+		std::int32_t GetDamagePenaltyRemainingMs(RE::StaticFunctionTag*, RE::Actor* a_actor)
+		{
+			if (!a_actor) {
+				return 0;
+			}
+			const auto st = Combat::LightAttackStaminaCost::PeekState(a_actor->GetFormID());
+			if (!st || !st->dmgScaleApplied) {
+				return 0;
+			}
+			const auto now = Core::Clock::FrameMs();
+			return st->dmgScaleUntilMs > now ? static_cast<std::int32_t>(st->dmgScaleUntilMs - now) : 0;
+		}
+
+		// --- Parry / jump ---
+
+		float GetParryCost(RE::StaticFunctionTag*)
+		{
+			return Core::Config::Get().dualWielding.parryStaminaCost;
+		}
+
+		bool CanParry(RE::StaticFunctionTag*, RE::Actor* a_actor)
+		{
+			if (!a_actor) {
+				return false;
+			}
+			Engine::SkyrimActor a{ a_actor };
+			return Logic::Parry::OnPress(a) == Logic::Parry::Result::kParry;
+		}
+
+		float GetJumpCost(RE::StaticFunctionTag*)
+		{
+			return Core::Config::Get().jump.staminaCost;
+		}
+
+		// --- Stamina ---
+
+		// Current stamina including the plugin's writes not applied yet this frame.
+		float GetStamina(RE::StaticFunctionTag*, RE::Actor* a_actor)
+		{
+			if (!a_actor) {
+				return 0.0f;
+			}
+			Engine::SkyrimActor a{ a_actor };
+			return a.Stamina();
+		}
+
+		// Charges (a_amount > 0) or refunds (< 0) stamina through the kDamage layer. Main thread:
+		// with "ActorValues.CoalesceWrites" the write joins the frame's coalesced AV writes (several
+		// charges in one frame reach the engine as one), without it it is applied right away.
+		// Returns the stamina the script should now assume.
+		float ChargeStamina(RE::StaticFunctionTag*, RE::Actor* a_actor, float a_amount)
+		{
+			if (!a_actor) {
+				return 0.0f;
+			}
+			Engine::SkyrimActor a{ a_actor };
+			if (a_amount != 0.0f) {
+				a.ModStaminaDamage(-a_amount);
+			}
+			return a.Stamina();
+		}
+
+		bool Register(RE::BSScript::IVirtualMachine* a_vm)
+		{
+			if (!a_vm) {
+				return false;
+			}
+
+			// Tasklet-callable: no hop to the main thread (see StaminaApi.h). Engine writes and
+			// perk entry-point evaluation stay on the main thread.
+			constexpr bool kAnyThread = true;
+			constexpr bool kMainThread = false;
+			a_vm->RegisterFunction("GetApiVersion", kClass, GetApiVersion, kAnyThread);
+			a_vm->RegisterFunction("GetNextAttackCost", kClass, GetNextAttackCost, kMainThread);
+			a_vm->RegisterFunction("GetAttackSessionState", kClass, GetAttackSessionState, kAnyThread);
+			a_vm->RegisterFunction("GetAttackSessionStamina", kClass, GetAttackSessionStamina, kAnyThread);
+			a_vm->RegisterFunction("GetDamagePenalty", kClass, GetDamagePenalty, kAnyThread);
+			a_vm->RegisterFunction("GetDamagePenaltyRemainingMs", kClass, GetDamagePenaltyRemainingMs, kAnyThread);
+			a_vm->RegisterFunction("GetParryCost", kClass, GetParryCost, kAnyThread);
+			a_vm->RegisterFunction("CanParry", kClass, CanParry, kMainThread);
+			a_vm->RegisterFunction("GetJumpCost", kClass, GetJumpCost, kAnyThread);
+			a_vm->RegisterFunction("GetStamina", kClass, GetStamina, kAnyThread);
+			a_vm->RegisterFunction("ChargeStamina", kClass, ChargeStamina, kMainThread);
+
+			SF_LOG_INFO(kGeneral, "[Papyrus] {} native functions registered (API v{})", kClass, kApiVersion);
+			return true;
+		}
+	}
+
+	void StaminaApi::Install()
+	{
+		static std::once_flag once;
+		std::call_once(once, []() {
+			auto* papyrus = SKSE::GetPapyrusInterface();
+			if (!papyrus || !papyrus->Register(Register)) {
+				SF_LOG_WARN(kGeneral, "[Papyrus] could not register the {} natives", kClass);
+			}
+		});
+	}
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+namespace SF::Papyrus
+{
+	// Native functions for scripts, class "SunderForge" (Source/Scripts/SunderForge.psc).
+	//
+	// The queries read the plugin's own state: AV reads come from the per-frame cache
+	// (Core/AvReadCache.h), sessions and penalties from the LightAttack tracker, costs from the
+	// current config snapshot. Those are registered as callable from script tasklets: a script
+	// gets an answer in one native call instead of polling GetActorValue / graph variables and
+	// waiting for a frame each time.
+	//
+	// Main thread only: ChargeStamina (an AV write; with "ActorValues.CoalesceWrites" off it goes
+	// straight to the engine), GetNextAttackCost (a CostMultCache miss walks the perk entry
+	// points) and CanParry (the Parry::OnPress decision the input sink makes on that thread).
+	class StaminaApi
+	{
+	public:
+		// Registers with the SKSE Papyrus interface. Call after SKSE::Init.
+		static void Install();
+	};
+}
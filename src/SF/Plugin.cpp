@@ -1,20 +1,53 @@
 #include "SF/Plugin.h"
 
+#include "SF/Events/AnimEventBus.h"
+#include "SF/Events/CostMultCacheEvents.h"
+#include "SF/Events/FrameHook.h"
 #include "SF/Events/LockpickBlocker.h"
+#include "SF/Events/TraceDump.h"
 #include "SF/Combat/ShieldOfStaminaLite.h"
 #include "SF/Combat/LightAttackStaminaCost.h"
 #include "SF/Combat/DualWielding.h"
 #include "SF/Movement/JumpStaminaCost.h"
+#include "SF/Core/AnimTagDict.h"
+#include "SF/Core/AvReadCache.h"
+#include "SF/Core/Config.h"
+#include "SF/Core/ConfigText.h"
+#include "SF/Core/FileWatcher.h"
+#include "SF/Core/FlightRecorder.h"
+#include "SF/Core/Latency.h"
+#include "SF/Core/Log.h"
+#include "SF/Engine/SkyrimWeapons.h"
+#include "SF/Logic/CostMultCache.h"
+#include "SF/Papyrus/StaminaApi.h"
 
 #include <SKSE/SKSE.h>
-#include <spdlog/sinks/basic_file_sink.h>
 
+#include <array>
+#include <cstddef>
 #include <filesystem>
+#include <string_view>
+
+#include <windows.h>
 
 namespace SF
 {
 	namespace
 	{
+		constexpr const char* kConfigRelPath = "Data/SKSE/Plugins/SunderForge.json";
+
+		// write_call<5> takes 14 bytes. Hooks: Main::Update (FrameHook), the blocked-hit call
+		// (ShieldOfStaminaLite). Room to spare for a few more.
+		constexpr std::size_t kTrampolineBytes = 1 << 7;
+
+		// Log settings come from SunderForge.json:
+		//   "LogLevel": "info",                 default for every category
+		//   "LogLevel.<Category>": "debug",     per category (General, LightAttack, AnimTag, Jump, ...)
+		//   "LogMaxFileKB": 5120, "LogMaxFiles": 3
+		// Everything else is the Core::Config schema (Core/Config.cpp lists every key).
+		// Levels follow every reload (ApplyLogSettings); the file limits are fixed at start-up.
+		Core::Log::Settings g_logSettings;  // what the log file was opened with
+
 		void InitLog()
 		{
 			auto path = SKSE::log::log_directory();
@@ -24,38 +57,194 @@ namespace SF
 
 			*path /= "Sunderandforged.log";
 
-			auto sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(
-				path->string(), true);
+			g_logSettings = Core::Log::ParseSettings(Core::ConfigText::ReadAllText(Plugin::GetConfigPath()));
+			Core::Log::Init(*path, g_logSettings);
+		}
+
+		// Reload: levels apply right away, the rotation limits only when the file is opened.
+		void ApplyLogSettings(std::string_view a_configText)
+		{
+			const auto settings = Core::Log::ParseSettings(a_configText);
+
+			for (std::size_t i = 0; i < settings.levels.size(); ++i) {
+				const auto category = static_cast<Core::Log::Category>(i);
+				const auto before = Core::Log::Level(category);
+				if (before == settings.levels[i]) {
+					continue;
+				}
+				Core::Log::SetLevel(category, settings.levels[i]);
+				if (category == Core::Log::Category::kGeneral) {
+					spdlog::set_level(settings.levels[i]);
+				}
+				SF_LOG_INFO(kGeneral, "[Config] LogLevel.{}: {} -> {}", Core::Log::kCategoryNames[i],
+					spdlog::level::to_string_view(before), spdlog::level::to_string_view(settings.levels[i]));
+			}
 
-			auto logger = std::make_shared<spdlog::logger>(
-				"global log", std::move(sink));
+			if (settings.maxFileBytes != g_logSettings.maxFileBytes || settings.maxFiles != g_logSettings.maxFiles) {
+				SF_LOG_WARN(kGeneral, "[Config] LogMaxFileKB/LogMaxFiles changed; the log file keeps {} KB x {} until the game restarts",
+					g_logSettings.maxFileBytes / 1024u, g_logSettings.maxFiles);
+			}
+		}
 
-			spdlog::set_default_logger(std::move(logger));
-			spdlog::set_level(spdlog::level::trace);
-			spdlog::flush_on(spdlog::level::trace);
+		// "ActorValues.VerifyReadCache": every cached AV read that no longer matches the engine.
+		void LogReadCacheMismatch(const Core::AvReadCache::Mismatch& a_mismatch)
+		{
+			static constexpr std::array<std::string_view, Core::AvReadCache::kReads> kNames{
+				"Stamina", "MaxStamina", "Health", "AttackDamageMult"
+			};
+			SF_LOG_WARN(kGeneral, "[AvReadCache] {:08X} {}: cached {:.2f}, engine {:.2f}",
+				a_mismatch.actor, kNames[static_cast<std::size_t>(a_mismatch.read)], a_mismatch.cached, a_mismatch.live);
+		}
+
+		// Animation packs' tag dictionaries (Core/AnimTagDict.h), next to SunderForge.json. Read
+		// once, before any sink classifies.
+		void LoadAnimTags()
+		{
+			const auto dir = Plugin::GetConfigPath().parent_path() / "SunderForge" / "AnimTags";
+			auto result = Core::AnimTagDict::Load(dir);
+
+			for (const auto& e : result.errors) {
+				SF_LOG_ERROR(kGeneral, "[AnimTags] {}", e);
+			}
+			for (const auto& w : result.warnings) {
+				SF_LOG_WARN(kGeneral, "[AnimTags] {}", w);
+			}
+
+			const auto& dict = *result.dictionary;
+			SF_LOG_INFO(kGeneral, "[AnimTags] {} file(s), {} rule(s): {} tags ({} project-scoped, {} project(s)), longest probe {}",
+				result.files, result.rules, dict.Size(), dict.Scoped(), dict.Projects().size(), dict.MaxProbe());
+
+			Core::AnimTagDict::Publish(std::move(result.dictionary));
+		}
+
+		// Edits to SunderForge.json apply in game. The watcher thread does the reparse and the
+		// publish, so nothing on the input/animation threads touches the filesystem.
+		void StartConfigWatcher()
+		{
+			// Leaked on purpose: joining a thread from DllMain/static destruction can deadlock.
+			static auto* watcher = new Core::FileWatcher();
+			if (!watcher->Start(Plugin::GetConfigPath(), [] { Plugin::LoadConfig("changed on disk"); })) {
+				return;
+			}
+			SF_LOG_INFO(kGeneral, "[Config] watching {} ({})", Plugin::GetConfigPath().filename().string(), watcher->Backend());
 		}
 	}
 
+	std::filesystem::path Plugin::GetConfigPath()
+	{
+		wchar_t path[MAX_PATH]{};
+		const DWORD len = GetModuleFileNameW(nullptr, path, MAX_PATH);
+		const auto runtimeDir = len ? std::filesystem::path(path).parent_path() : std::filesystem::current_path();
+		return runtimeDir / kConfigRelPath;
+	}
+
+	void Plugin::LoadConfig(std::string_view a_reason)
+	{
+		const auto path = GetConfigPath();
+		const auto text = Core::ConfigText::ReadAllText(path);
+		auto result = Core::Config::Parse(text);
+
+		for (const auto& e : result.errors) {
+			SF_LOG_ERROR(kGeneral, "[Config] {}: {}", path.filename().string(), e);
+		}
+		for (const auto& w : result.warnings) {
+			SF_LOG_WARN(kGeneral, "[Config] {}: {}", path.filename().string(), w);
+		}
+
+		if (result.malformed) {
+			SF_LOG_ERROR(kGeneral, "[Config] {} is not valid JSON, keeping config v{} ({})",
+				path.filename().string(), Core::Config::Version(), a_reason);
+			return;
+		}
+
+		ApplyLogSettings(text);
+
+		const auto& cfg = *result.snapshot;
+		Core::FlightRecorder::SetEnabled(cfg.trace.flightRecorder);
+		Core::Latency::SetEnabled(cfg.latency.enabled);
+		Logic::CostMultCache::GetSingleton().SetEnabled(cfg.perkMultCache.enabled);
+		Logic::CostMultCache::GetSingleton().SetTtlMs(cfg.perkMultCache.ttlMs);
+		Core::AvReadCache::GetSingleton().SetEnabled(cfg.actorValues.readCache);
+		Core::AvReadCache::GetSingleton().SetVerify(cfg.actorValues.verifyReadCache ? &LogReadCacheMismatch : nullptr);
+
+		const auto version = Core::Config::Publish(std::move(result.snapshot));
+
+		// Cached multipliers may depend on tunables that just changed.
+		Logic::CostMultCache::GetSingleton().InvalidateAll();
+		Combat::ShieldOfStaminaLite::Configure();
+
+		SF_LOG_INFO(kGeneral, "[Config] v{} published ({}): {} error(s), {} warning(s)",
+			version, a_reason, result.errors.size(), result.warnings.size());
+	}
+
 	void Plugin::Init(const SKSE::LoadInterface* skse)
 	{
 		// 🔴 ВАЖНО: логгер должен быть инициализирован ДО SKSE::Init
 		InitLog();
 
+		LoadConfig("startup");
+		StartConfigWatcher();
+		LoadAnimTags();
+
 		SKSE::Init(skse);
 
+		// One trampoline for every call hook, allocated before any of them is written: a second
+		// AllocTrampoline() would replace the block earlier thunks live in.
+		SKSE::AllocTrampoline(kTrampolineBytes);
+
 		SKSE::log::warn("Sunderandforged: Plugin Init OK");
 
+		// Script-side queries (SunderForge.psc); the VM binds them when it starts.
+		Papyrus::StaminaApi::Install();
+
 		// Всё, что нужно делать после загрузки данных
 		if (auto* msg = SKSE::GetMessagingInterface()) {
 			msg->RegisterListener([](SKSE::MessagingInterface::Message* m) {
-				if (m && m->type == SKSE::MessagingInterface::kDataLoaded) {
+				if (!m) {
+					return;
+				}
+
+				switch (m->type) {
+				case SKSE::MessagingInterface::kDataLoaded:
 					SKSE::log::warn("Sunderandforged: DataLoaded");
 
+					// Before the sinks: they read the table without locking.
+					Engine::SkyrimWeapons::BuildCostTable();
+
+					// Main-thread coroutine sequences (parry, jump spend) resume from here.
+					Events::FrameHook::Install();
+
 					Events::LockpickBlocker::Install();
+					Events::TraceDump::Install();
+					Events::CostMultCacheEvents::Install();
 					Combat::ShieldOfStaminaLite::Install();
 					Combat::LightAttackStaminaCost::Install();
 					Combat::DualWielding::Install();
 					Movement::JumpStaminaCost::Install();
+
+					// After the modules above subscribed: the player's graph is attached right away.
+					Events::AnimEventBus::Install();
+					break;
+
+				// Per-actor state belongs to the world that is being thrown away.
+				case SKSE::MessagingInterface::kPreLoadGame:
+					Combat::LightAttackStaminaCost::ResetState("pre-load game");
+					Events::CostMultCacheEvents::Reset("pre-load game");
+					Events::FrameHook::Reset("pre-load game");
+					Events::AnimEventBus::Reset("pre-load game");
+					break;
+				case SKSE::MessagingInterface::kPostLoadGame:
+					Events::AnimEventBus::AttachPlayer();
+					break;
+				case SKSE::MessagingInterface::kNewGame:
+					Combat::LightAttackStaminaCost::ResetState("new game");
+					Events::CostMultCacheEvents::Reset("new game");
+					Events::FrameHook::Reset("new game");
+					Events::AnimEventBus::Reset("new game");
+					break;
+
+				default:
+					break;
 				}
 			});
 		}
@@ -2,11 +2,22 @@
 
 #include <SKSE/SKSE.h>
 
+#include <filesystem>
+#include <string_view>
+
 namespace SF
 {
 	class Plugin
 	{
 	public:
 		static void Init(const SKSE::LoadInterface* skse);
+
+		// <game>/Data/SKSE/Plugins/SunderForge.json
+		[[nodiscard]] static std::filesystem::path GetConfigPath();
+
+		// Parses SunderForge.json in one pass and publishes it as the current Core::Config
+		// snapshot; settings that live outside the snapshot (recorder, perk cache) are pushed too.
+		// Called at startup and from the config watcher thread on every save.
+		static void LoadConfig(std::string_view a_reason);
 	};
 }
@@ -0,0 +1,66 @@
+// Core::Config publishing: versions, and replaced snapshots freed kRetireFrames frames later
+// (frames from a Core::Clock::Fake, as FrameHook would run them).
+
+#include "Test.h"
+
+#include "SF/Core/Clock.h"
+#include "SF/Core/Config.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace
+{
+	namespace Clock = SF::Core::Clock;
+	namespace Config = SF::Core::Config;
+
+	std::unique_ptr<Config::Snapshot> Parsed(const char* a_text)
+	{
+		auto result = Config::Parse(a_text);
+		SF_CHECK(!result.malformed);
+		SF_CHECK(result.errors.empty());
+		return std::move(result.snapshot);
+	}
+}
+
+SF_TEST(PublishAndRetire)
+{
+	Clock::Fake clock;
+	clock.Step();
+
+	SF_CHECK(Config::Get().version == 0);  // built-in defaults
+
+	const auto v1 = Config::Publish(Parsed(R"({ "LightAttack.SessionTimeoutMs": 900 })"));
+	SF_CHECK(v1 == Config::Version());
+	SF_CHECK(Config::Get().version == v1);
+	SF_CHECK(Config::Get().lightAttack.sessionTimeoutMs == 900);
+
+	// Three saves in one frame: two snapshots retired, none old enough yet.
+	(void)Config::Publish(Parsed(R"({ "LightAttack.SessionTimeoutMs": 901 })"));
+	const auto v3 = Config::Publish(Parsed(R"({ "LightAttack.SessionTimeoutMs": 902 })"));
+	SF_CHECK(v3 == v1 + 2);
+	SF_CHECK(Config::Get().version == v3);
+	SF_CHECK(Config::Get().lightAttack.sessionTimeoutMs == 902);
+	SF_CHECK(Config::CollectRetired() == 0);
+
+	for (std::uint64_t i = 1; i < Config::kRetireFrames; ++i) {
+		clock.Step();
+	}
+	SF_CHECK(Config::CollectRetired() == 0);
+
+	clock.Step();
+	SF_CHECK(Config::CollectRetired() == 2);
+	SF_CHECK(Config::CollectRetired() == 0);
+
+	// The current snapshot is never retired.
+	SF_CHECK(Config::Get().version == v3);
+	SF_CHECK(Config::Get().lightAttack.sessionTimeoutMs == 902);
+
+	// A later publish collects on its own once the grace period has passed.
+	(void)Config::Publish(Parsed("{}"));
+	for (std::uint64_t i = 0; i < Config::kRetireFrames; ++i) {
+		clock.Step();
+	}
+	(void)Config::Publish(Parsed("{}"));
+	SF_CHECK(Config::CollectRetired() == 0);
+}
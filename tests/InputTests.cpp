@@ -0,0 +1,94 @@
+// Engine::Input::Bindings on mock button events: edges, chords, holds and debounce.
+
+#include "Test.h"
+
+#include "SF/Engine/Input.h"
+#include "SF/Engine/Mock/World.h"
+
+#include <cstdint>
+
+namespace
+{
+	namespace Input = SF::Engine::Input;
+	using SF::Engine::Mock::InputEvent;
+
+	constexpr std::uint32_t kKey = 0x10;    // Q
+	constexpr std::uint32_t kShift = 0x2A;  // left shift
+	constexpr std::uint8_t kAction = 7;
+
+	// One button event per call, as the engine reports it: down (value 1, held 0), held
+	// (value 1, held > 0), up (value 0, held > 0).
+	struct Keyboard
+	{
+		int Send(std::uint32_t a_key, float a_value, float a_heldSecs, std::uint64_t a_nowMs)
+		{
+			InputEvent e{ .idCode = a_key, .value = a_value, .heldDownSecs = a_heldSecs };
+			int fired = 0;
+			bindings.Dispatch(&e, a_nowMs, [&](std::uint8_t a_action) {
+				SF_CHECK(a_action == kAction);
+				++fired;
+			});
+			return fired;
+		}
+
+		Input::Bindings bindings;
+	};
+}
+
+SF_TEST(PressAndDebounce)
+{
+	Keyboard kb;
+	SF_CHECK(kb.bindings.Add({ .action = kAction, .key = kKey, .debounceMs = 120 }));
+
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.0f, 1000) == 1);
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.05f, 1050) == 0);  // held: no edge
+	SF_CHECK(kb.Send(kKey, 0.0f, 0.06f, 1060) == 0);
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.0f, 1100) == 0);   // inside the debounce window
+	SF_CHECK(kb.Send(kKey, 0.0f, 0.01f, 1110) == 0);
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.0f, 1120) == 1);
+}
+
+SF_TEST(HoldWithLateModifier)
+{
+	// Shift+Q held 300 ms; shift goes down only after the hold threshold has passed.
+	Keyboard kb;
+	SF_CHECK(kb.bindings.Add({ .action = kAction, .key = kKey, .modifier = kShift, .trigger = Input::Trigger::kHold, .holdMs = 300 }));
+
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.0f, 1000) == 0);
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.35f, 1350) == 0);  // long enough, but no modifier yet
+	SF_CHECK(kb.Send(kShift, 1.0f, 0.0f, 1360) == 0);
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.40f, 1400) == 1);
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.50f, 1500) == 0);  // once per press
+
+	SF_CHECK(kb.Send(kKey, 0.0f, 0.55f, 1550) == 0);
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.0f, 2000) == 0);
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.31f, 2310) == 1);  // a new press holds again
+}
+
+SF_TEST(HoldInsideDebounce)
+{
+	Keyboard kb;
+	SF_CHECK(kb.bindings.Add({ .action = kAction, .key = kKey, .trigger = Input::Trigger::kHold, .holdMs = 100, .debounceMs = 1000 }));
+
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.0f, 1000) == 0);
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.10f, 1100) == 1);
+	SF_CHECK(kb.Send(kKey, 0.0f, 0.15f, 1150) == 0);
+
+	// Second press: its first chance lands inside the window, a later held event outside it.
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.0f, 1200) == 0);
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.15f, 1350) == 0);
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.90f, 2100) == 1);
+	SF_CHECK(kb.Send(kKey, 1.0f, 1.00f, 2200) == 0);
+}
+
+SF_TEST(ReleaseAllForgetsKeys)
+{
+	// A chord whose modifier was let go inside a menu (batch skipped, ReleaseAll()).
+	Keyboard kb;
+	SF_CHECK(kb.bindings.Add({ .action = kAction, .key = kKey, .modifier = kShift }));
+
+	SF_CHECK(kb.Send(kShift, 1.0f, 0.0f, 1000) == 0);
+	kb.bindings.ReleaseAll();
+	SF_CHECK(!kb.bindings.IsDown(kShift));
+	SF_CHECK(kb.Send(kKey, 1.0f, 0.0f, 1100) == 0);
+}
@@ -0,0 +1,219 @@
+// Core::ActorStateStore: lookups, eviction callbacks, handle generations across slot reuse, and
+// the flat index under churn.
+
+#include "Test.h"
+
+#include "SF/Core/ActorStateStore.h"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct Hot
+	{
+		std::uint32_t hits{ 0 };
+		float value{ 0.0f };
+	};
+
+	struct Cold
+	{
+		std::uint64_t untilMs{ 0 };
+	};
+
+	// Two shards: plenty of actors share one, so slots and index runs get reused.
+	using Store = SF::Core::ActorStateStore<Hot, Cold, 2>;
+
+	constexpr auto kNoop = [](std::uint32_t, Hot&) {};
+
+	// An id other than a_id that lands in the same shard.
+	std::uint32_t SameShard(std::uint32_t a_id)
+	{
+		for (auto id = a_id + 1;; ++id) {
+			if (Store::ShardIndex(id) == Store::ShardIndex(a_id)) {
+				return id;
+			}
+		}
+	}
+}
+
+SF_TEST(AcquireFindErase)
+{
+	Store store;
+	SF_CHECK(!store.Find(0x14u));
+
+	{
+		auto st = store.Acquire(0x14u);
+		SF_CHECK(st);
+		SF_CHECK(st->hits == 0);
+		st->hits = 3;
+		st.cold().untilMs = 500;
+	}
+	{
+		auto st = store.Acquire(0x14u);
+		SF_CHECK(st->hits == 3);
+		SF_CHECK(st.cold().untilMs == 500);
+	}
+	{
+		auto st = store.Find(0x14u);
+		SF_CHECK(st && st->hits == 3);
+	}
+	SF_CHECK(store.Size() == 1);
+
+	std::uint32_t evicted = 0;
+	std::uint64_t evictedUntil = 0;
+	SF_CHECK(store.Erase(0x14u, [&](std::uint32_t a_id, Hot& a_hot, Cold& a_cold) {
+		evicted = a_id;
+		evictedUntil = a_cold.untilMs;
+		SF_CHECK(a_hot.hits == 3);
+	}));
+	SF_CHECK(evicted == 0x14u);
+	SF_CHECK(evictedUntil == 500);
+	SF_CHECK(!store.Find(0x14u));
+	SF_CHECK(!store.Erase(0x14u, kNoop));
+	SF_CHECK(store.Size() == 0);
+
+	// Coming back after an erase starts from a value-initialised entry, cold column included.
+	auto st = store.Acquire(0x14u);
+	SF_CHECK(st->hits == 0);
+	SF_CHECK(st.cold().untilMs == 0);
+}
+
+SF_TEST(HandleAfterReuse)
+{
+	Store store;
+	const std::uint32_t a = 0x14;
+	const std::uint32_t b = SameShard(a);
+
+	Store::Handle ha;
+	{
+		auto st = store.Acquire(a);
+		st->hits = 7;
+		ha = st.handle();
+	}
+	SF_CHECK(ha);
+	{
+		auto st = store.Find(ha);
+		SF_CHECK(st && st->hits == 7);
+	}
+
+	SF_CHECK(store.Erase(a, kNoop));
+	SF_CHECK(!store.Find(ha));
+
+	// b takes the freed slot; a's handle must not reach b's state.
+	Store::Handle hb;
+	{
+		auto st = store.Acquire(b);
+		st->hits = 9;
+		hb = st.handle();
+	}
+	SF_CHECK(hb.slot == ha.slot);
+	SF_CHECK(hb != ha);
+	SF_CHECK(!store.Find(ha));
+	{
+		auto st = store.Find(hb);
+		SF_CHECK(st && st->hits == 9);
+	}
+
+	SF_CHECK(!store.Find(Store::Handle{}));
+}
+
+SF_TEST(ClearAndEraseIf)
+{
+	Store store;
+	constexpr std::uint32_t kActors = 300;
+	for (std::uint32_t id = 1; id <= kActors; ++id) {
+		store.Acquire(id)->hits = id;
+	}
+	SF_CHECK(store.Size() == kActors);
+	const auto bytes = store.GetStats().bytes;
+
+	std::uint32_t odd = 0;
+	SF_CHECK(store.EraseIf([](std::uint32_t a_id, Hot& a_hot) { return a_id % 2 == 0 && a_hot.hits == a_id; }) == kActors / 2);
+	for (std::uint32_t id = 1; id <= kActors; ++id) {
+		auto st = store.Find(id);
+		SF_CHECK(static_cast<bool>(st) == (id % 2 == 1));
+		if (st) {
+			SF_CHECK(st->hits == id);
+			++odd;
+		}
+	}
+	SF_CHECK(odd == kActors / 2);
+
+	std::size_t visited = 0;
+	SF_CHECK(store.Clear([&](std::uint32_t, Hot&, Cold&) { ++visited; }) == kActors / 2);
+	SF_CHECK(visited == kActors / 2);
+	SF_CHECK(store.Size() == 0);
+	SF_CHECK(!store.Find(1u));
+
+	// Slots and index tables are kept: refilling the same population does not grow the store.
+	for (std::uint32_t id = 1; id <= kActors; ++id) {
+		SF_CHECK(store.Acquire(id)->hits == 0);
+	}
+	const auto stats = store.GetStats();
+	SF_CHECK(stats.entries == kActors);
+	SF_CHECK(stats.bytes == bytes);
+}
+
+SF_TEST(IndexChurn)
+{
+	// Interleaved inserts and erases; every live id must stay reachable (backward-shift delete).
+	Store store;
+	std::vector<bool> live(4096, false);
+	std::uint32_t rng = 1;
+	for (int i = 0; i < 50000; ++i) {
+		rng ^= rng << 13;
+		rng ^= rng >> 17;
+		rng ^= rng << 5;
+		const std::uint32_t id = 0xFF000000u | (rng & 4095u);
+		if (rng & 0x10000u) {
+			store.Acquire(id)->hits = id;
+			live[id & 4095u] = true;
+		} else {
+			SF_CHECK(store.Erase(id, kNoop) == live[id & 4095u]);
+			live[id & 4095u] = false;
+		}
+	}
+
+	std::size_t expected = 0;
+	for (std::uint32_t k = 0; k < live.size(); ++k) {
+		const auto id = 0xFF000000u | k;
+		auto st = store.Find(id);
+		SF_CHECK(static_cast<bool>(st) == live[k]);
+		if (st) {
+			SF_CHECK(st->hits == id);
+			++expected;
+		}
+	}
+	SF_CHECK(store.Size() == expected);
+}
+
+SF_TEST(ConcurrentAcquire)
+{
+	// Threads hammering overlapping actors: the shard lock held by an Accessor serialises them.
+	Store store;
+	constexpr std::uint32_t kThreads = 4;
+	constexpr std::uint32_t kPerThread = 20000;
+	constexpr std::uint32_t kActors = 64;
+
+	std::vector<std::thread> threads;
+	for (std::uint32_t t = 0; t < kThreads; ++t) {
+		threads.emplace_back([&store, t] {
+			for (std::uint32_t i = 0; i < kPerThread; ++i) {
+				++store.Acquire((i + t) % kActors + 1)->hits;
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	std::uint64_t total = 0;
+	for (std::uint32_t id = 1; id <= kActors; ++id) {
+		auto st = store.Find(id);
+		SF_CHECK(st);
+		total += st ? st->hits : 0;
+	}
+	SF_CHECK(total == std::uint64_t{ kThreads } * kPerThread);
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <string_view>
+#include <vector>
+
+namespace SF::Test
+{
+	// Minimal host-side check harness, like bench/Bench.h: no framework dependency.
+	//
+	// SF_TEST(Name) { ... } registers a case; SF_CHECK* record a failure and carry on, so one run
+	// reports every broken expectation of a case. Each test executable links TestMain.cpp:
+	//
+	//   sf_test_tracker                   every case
+	//   sf_test_tracker UnarmedPairing    just that one
+
+	using Fn = void (*)();
+
+	struct Case
+	{
+		std::string_view name;
+		Fn fn;
+	};
+
+	namespace detail
+	{
+		inline std::vector<Case>& Cases()
+		{
+			static std::vector<Case> cases;
+			return cases;
+		}
+
+		inline int g_failures = 0;
+
+		inline bool Register(std::string_view a_name, Fn a_fn)
+		{
+			Cases().push_back({ a_name, a_fn });
+			return true;
+		}
+
+		inline void Fail(const char* a_file, int a_line, const char* a_what)
+		{
+			std::fprintf(stderr, "%s:%d: check failed: %s\n", a_file, a_line, a_what);
+			++g_failures;
+		}
+
+		inline void FailNear(const char* a_file, int a_line, const char* a_what, double a_got, double a_want)
+		{
+			std::fprintf(stderr, "%s:%d: check failed: %s (got %.6f, want %.6f)\n", a_file, a_line, a_what, a_got, a_want);
+			++g_failures;
+		}
+	}
+
+	// Runs the cases named in a_argv (all of them if none). Returns the process exit code.
+	int Run(int a_argc, char** a_argv);
+}
+
+#define SF_TEST(a_name)                                                                      \
+	static void a_name();                                                                    \
+	[[maybe_unused]] static const bool a_name##Registered = SF::Test::detail::Register(#a_name, a_name); \
+	static void a_name()
+
+#define SF_CHECK(a_expr)                                          \
+	do {                                                          \
+		if (!(a_expr)) {                                          \
+			SF::Test::detail::Fail(__FILE__, __LINE__, #a_expr);  \
+		}                                                         \
+	} while (false)
+
+#define SF_CHECK_NEAR(a_got, a_want)                                                                        \
+	do {                                                                                                    \
+		const double sfGot = static_cast<double>(a_got);                                                   \
+		const double sfWant = static_cast<double>(a_want);                                                  \
+		if (!(std::abs(sfGot - sfWant) <= 1e-4)) {                                                          \
+			SF::Test::detail::FailNear(__FILE__, __LINE__, #a_got " == " #a_want, sfGot, sfWant);           \
+		}                                                                                                   \
+	} while (false)
@@ -0,0 +1,40 @@
+#include "Test.h"
+
+#include <cstdio>
+#include <string_view>
+
+namespace SF::Test
+{
+	int Run(int a_argc, char** a_argv)
+	{
+		int ran = 0;
+		for (const auto& c : detail::Cases()) {
+			if (a_argc > 1) {
+				bool wanted = false;
+				for (int i = 1; i < a_argc; ++i) {
+					wanted = wanted || c.name == std::string_view{ a_argv[i] };
+				}
+				if (!wanted) {
+					continue;
+				}
+			}
+
+			const int before = detail::g_failures;
+			c.fn();
+			++ran;
+			std::printf("%-40.*s %s\n", static_cast<int>(c.name.size()), c.name.data(),
+				detail::g_failures == before ? "ok" : "FAILED");
+		}
+
+		if (ran == 0) {
+			std::fprintf(stderr, "no test case matched\n");
+			return 1;
+		}
+		return detail::g_failures == 0 ? 0 : 1;
+	}
+}
+
+int main(int a_argc, char** a_argv)
+{
+	return SF::Test::Run(a_argc, a_argv);
+}
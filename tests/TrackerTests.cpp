@@ -0,0 +1,222 @@
+// LightAttack::Tracker windows on mock actors, with time from a Core::Clock::Fake: every event
+// is stamped with FrameMs(), as the anim-event sink does in game. Boundaries come from the
+// default Config snapshot, so the cases follow a retuned default.
+
+#include "Test.h"
+
+#include "SF/Core/AnimTag.h"
+#include "SF/Core/Clock.h"
+#include "SF/Core/Config.h"
+#include "SF/Engine/Mock/World.h"
+#include "SF/Logic/LightAttackTracker.h"
+
+#include <cstdint>
+#include <string_view>
+
+namespace
+{
+	namespace AnimTag = SF::Core::AnimTag;
+	namespace Clock = SF::Core::Clock;
+	namespace LA = SF::Logic::LightAttack;
+	using SF::Engine::Weapon;
+	using SF::Engine::WeaponKind;
+
+	constexpr std::uint32_t kActor = 0x14;
+	constexpr Weapon kSword{ WeaponKind::kOneHand, 0x12EB7, 10.0f };   // 6 + 10 = 16 per swing
+	constexpr Weapon kDagger{ WeaponKind::kOneHand, 0x1397E, 5.0f };   // 6 + 5 = 11 per swing
+
+	const LA::Tunables& Cfg()
+	{
+		return SF::Core::Config::Get().lightAttack;
+	}
+
+	struct Scene
+	{
+		explicit Scene(Weapon a_left, Weapon a_right, float a_stamina = 100.0f) :
+			actor(world.Spawn(kActor, a_stamina))
+		{
+			actor.Equip(true, a_left);
+			actor.Equip(false, a_right);
+		}
+
+		LA::Outcome Fire(std::string_view a_tag)
+		{
+			return tracker.OnEvent(actor, AnimTag::Classify(a_tag), Clock::FrameMs());
+		}
+
+		Clock::Fake clock;
+		SF::Engine::Mock::World world;
+		SF::Engine::Mock::Actor& actor;
+		LA::Tracker tracker;
+	};
+}
+
+SF_TEST(UnarmedPairing)
+{
+	// Sword in the right hand, left hand empty: the swing sound names the empty hand, and a
+	// weaponSwing inside the pairing window is that unarmed punch.
+	{
+		Scene s{ Weapon{}, kSword };
+		const auto hint = s.Fire("SoundPlay.WPNSwingUnarmed");
+		SF_CHECK(hint.action == LA::Action::kPairingHint);
+		SF_CHECK(hint.left);
+		SF_CHECK(hint.treatAsUnarmed);
+
+		s.clock.Step(Cfg().unarmedPairWindowMs);
+		const auto swing = s.Fire("weaponSwing");
+		SF_CHECK(swing.action == LA::Action::kSpend);
+		SF_CHECK(swing.left);
+		SF_CHECK(swing.treatAsUnarmed);
+		SF_CHECK(swing.ambiguous);
+		SF_CHECK_NEAR(swing.finalCost, Cfg().baseUnarmed);
+		SF_CHECK_NEAR(s.actor.Stamina(), 100.0f - Cfg().baseUnarmed);
+	}
+
+	// One millisecond late: no pairing, no recent explicit hand -> the default right sword.
+	{
+		Scene s{ Weapon{}, kSword };
+		(void)s.Fire("SoundPlay.WPNSwingUnarmed");
+
+		s.clock.Step(Cfg().unarmedPairWindowMs + 1);
+		const auto swing = s.Fire("weaponSwing");
+		SF_CHECK(swing.action == LA::Action::kSpend);
+		SF_CHECK(!swing.left);
+		SF_CHECK(!swing.treatAsUnarmed);
+		SF_CHECK(swing.weapon == kSword.formID);
+		SF_CHECK_NEAR(swing.finalCost, 16.0f);
+	}
+}
+
+SF_TEST(ExplicitHandTags)
+{
+	// Dual wield: an explicit left tag resolves the next weaponSwing inside the window.
+	{
+		Scene s{ kDagger, kSword };
+		const auto start = s.Fire("attackStartLeft");
+		SF_CHECK(start.action == LA::Action::kStart);
+		SF_CHECK(start.left);
+		SF_CHECK(!start.ambiguous);
+
+		s.clock.Step(Cfg().explicitHandWindowMs);
+		const auto swing = s.Fire("weaponSwing");
+		SF_CHECK(swing.action == LA::Action::kSpend);
+		SF_CHECK(swing.left);
+		SF_CHECK(swing.ambiguous);
+		SF_CHECK(swing.weapon == kDagger.formID);
+		SF_CHECK_NEAR(swing.finalCost, 11.0f);
+	}
+
+	// Past the window the swing falls back to the right hand (implicit session).
+	{
+		Scene s{ kDagger, kSword };
+		(void)s.Fire("attackStartLeft");
+
+		s.clock.Step(Cfg().explicitHandWindowMs + 1);
+		const auto swing = s.Fire("weaponSwing");
+		SF_CHECK(swing.action == LA::Action::kSpend);
+		SF_CHECK(!swing.left);
+		SF_CHECK(swing.weapon == kSword.formID);
+	}
+
+	// Both hands named recently: the more recent one wins.
+	{
+		Scene s{ kDagger, kSword };
+		(void)s.Fire("attackStartLeft");
+		s.clock.Step(50);
+		(void)s.Fire("attackStartRight");
+		s.clock.Step(50);
+		const auto swing = s.Fire("weaponSwing");
+		SF_CHECK(!swing.left);
+		SF_CHECK(swing.weapon == kSword.formID);
+	}
+}
+
+SF_TEST(SessionTimeout)
+{
+	// A fresh unspent session keeps its start snapshot; a stale one is re-snapshotted.
+	{
+		Scene s{ Weapon{}, kSword };
+		const auto first = s.Fire("attackStartRight");
+		SF_CHECK_NEAR(first.startStamina, 100.0f);
+
+		s.actor.SetStamina(60.0f);
+		s.clock.Step(Cfg().sessionTimeoutMs);
+		const auto kept = s.Fire("attackStartRight");
+		SF_CHECK(kept.action == LA::Action::kStart);
+		SF_CHECK_NEAR(kept.startStamina, 100.0f);
+
+		s.clock.Step(Cfg().sessionTimeoutMs + 1);
+		const auto restarted = s.Fire("attackStartRight");
+		SF_CHECK_NEAR(restarted.startStamina, 60.0f);
+	}
+
+	// The spend charges against the start snapshot while the session is fresh: vanilla drain
+	// between start and swing is cancelled.
+	{
+		Scene s{ Weapon{}, kSword };
+		(void)s.Fire("attackStartRight");
+
+		s.actor.SetStamina(70.0f);
+		s.clock.Step(Cfg().sessionTimeoutMs);
+		const auto swing = s.Fire("weaponRightSwing");
+		SF_CHECK(swing.action == LA::Action::kSpend);
+		SF_CHECK_NEAR(swing.staminaBefore, 70.0f);
+		SF_CHECK_NEAR(swing.startStamina, 100.0f);
+		SF_CHECK_NEAR(swing.staminaAfter, 84.0f);
+		SF_CHECK_NEAR(s.actor.Stamina(), 84.0f);
+	}
+
+	// After the timeout the start is stale: the swing opens a new session at current stamina.
+	{
+		Scene s{ Weapon{}, kSword };
+		(void)s.Fire("attackStartRight");
+
+		s.actor.SetStamina(70.0f);
+		s.clock.Step(Cfg().sessionTimeoutMs + 1);
+		const auto swing = s.Fire("weaponRightSwing");
+		SF_CHECK(swing.action == LA::Action::kSpend);
+		SF_CHECK_NEAR(swing.startStamina, 70.0f);
+		SF_CHECK_NEAR(swing.staminaAfter, 54.0f);
+		SF_CHECK_NEAR(s.actor.Stamina(), 54.0f);
+	}
+}
+
+SF_TEST(DamagePenaltyExpiry)
+{
+	// 10 stamina against a 16 cost: partial pay, AttackDamageMult scaled by the paid ratio until
+	// the penalty window has passed; any later event of the actor lifts it.
+	Scene s{ Weapon{}, kSword, 10.0f };
+	const auto foot = AnimTag::Classify("FootLeft");
+	SF_CHECK(!s.tracker.WantsEvent(foot));
+
+	(void)s.Fire("attackStartRight");
+	s.clock.Step(10);
+	const auto swing = s.Fire("weaponRightSwing");
+	SF_CHECK(swing.action == LA::Action::kSpend);
+	SF_CHECK(swing.insufficient);
+	SF_CHECK(swing.ScalesDamage());
+	SF_CHECK_NEAR(swing.ratio, 10.0f / 16.0f);
+	SF_CHECK_NEAR(s.actor.AttackDamageMult(), 10.0f / 16.0f);
+	SF_CHECK_NEAR(s.actor.Stamina(), 0.0f);
+	SF_CHECK(s.tracker.ActiveDamageScales() == 1);
+
+	// Unrelated tags now get past the fast reject so the penalty can expire on them.
+	SF_CHECK(s.tracker.WantsEvent(foot));
+
+	s.clock.Step(Cfg().damagePenaltyWindowMs);
+	const auto inside = s.Fire("FootLeft");
+	SF_CHECK(inside.action == LA::Action::kNone);
+	SF_CHECK(!inside.penaltyExpired);
+	SF_CHECK_NEAR(s.actor.AttackDamageMult(), 10.0f / 16.0f);
+
+	s.clock.Step(1);
+	const auto after = s.Fire("FootLeft");
+	SF_CHECK(after.penaltyExpired);
+	SF_CHECK_NEAR(s.actor.AttackDamageMult(), 1.0f);
+	SF_CHECK(s.tracker.ActiveDamageScales() == 0);
+	SF_CHECK(!s.tracker.WantsEvent(foot));
+
+	const auto peek = s.tracker.Peek(kActor);
+	SF_CHECK(peek.has_value());
+	SF_CHECK(peek && !peek->dmgScaleApplied);
+}
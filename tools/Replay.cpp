@@ -0,0 +1,710 @@
+// Replays animation-event streams through the light-attack logic (SF/Logic/LightAttackTracker.h,
+// the same code the plugin runs) against mock actors and prints every decision.
+//
+// Stream format, one event per line, '#' starts a comment:
+//
+//   <time ms> <actor hex> <tag> <left> <right> <stamina> [power 0|1] [cost mult]
+//
+//   left/right: none | fist | 1h[:weight] | 2h[:weight] | ranged
+//   stamina   : engine value when the event fired, or '-' to carry the simulated value
+//               (starts at --stamina, becomes the enforced target after each spend)
+//
+// Output has one line per decision (start, pairing hint, spend, skip, penalty expiry), so a
+// run can be saved and diffed later:
+//
+//   sf_replay stream.txt > stream.golden
+//   sf_replay stream.txt --golden stream.golden        exit 1 and show the first diffs on change
+//
+// Throughput (output off, state reset per pass):
+//
+//   sf_replay stream.txt --repeat 200
+//   sf_replay --synthetic 1000000 --actors 200 --repeat 5
+//   sf_replay --synthetic 500 --emit > synthetic.txt   write the generated stream
+//
+// Live view (tools/TelemetryView.cpp), paced to the stream's timestamps:
+//
+//   sf_replay --synthetic 200000 --actors 20 --telemetry sf.telemetry [--speed 4]
+//   sf_telemetry --file sf.telemetry
+//
+// Animation pack dictionaries (Core/AnimTagDict.h), with the behavior project every replayed
+// actor's graph is taken to have for project-scoped files:
+//
+//   sf_replay mco_fight.txt --tags SunderForge/AnimTags --project DefaultMale
+//
+// Options: --quiet, --stamina <initial>, --seed <n>, --config <SunderForge.json> (tunables)
+
+#include "SF/Core/AnimTag.h"
+#include "SF/Core/AnimTagDict.h"
+#include "SF/Core/Config.h"
+#include "SF/Core/ConfigText.h"
+#include "SF/Core/Latency.h"
+#include "SF/Core/SharedMemory.h"
+#include "SF/Core/Telemetry.h"
+#include "SF/Engine/Mock/World.h"
+#include "SF/Logic/LightAttackTracker.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace
+{
+	namespace LA = SF::Logic::LightAttack;
+	namespace AnimTag = SF::Core::AnimTag;
+
+	struct Event
+	{
+		std::uint32_t timeMs{ 0 };
+		std::uint32_t actor{ 0 };
+		std::string tag;
+		LA::Weapon left;
+		LA::Weapon right;
+		bool hasStamina{ false };
+		float stamina{ 0.0f };
+		bool power{ false };
+		float mult{ 1.0f };
+	};
+
+	// ---------------------------
+	// Parsing / formatting
+	// ---------------------------
+	bool ParseWeapon(std::string_view a_text, LA::Weapon& a_out)
+	{
+		a_out = {};
+		std::string_view kind = a_text;
+		float weight = 0.0f;
+		if (const auto colon = a_text.find(':'); colon != std::string_view::npos) {
+			kind = a_text.substr(0, colon);
+			weight = std::strtof(std::string(a_text.substr(colon + 1)).c_str(), nullptr);
+		}
+
+		if (kind == "none") {
+			a_out.kind = LA::WeaponKind::kNone;
+		} else if (kind == "fist") {
+			a_out.kind = LA::WeaponKind::kUnarmed;
+		} else if (kind == "1h") {
+			a_out.kind = LA::WeaponKind::kOneHand;
+		} else if (kind == "2h") {
+			a_out.kind = LA::WeaponKind::kTwoHand;
+		} else if (kind == "ranged") {
+			a_out.kind = LA::WeaponKind::kNonMelee;
+		} else {
+			return false;
+		}
+		a_out.weight = weight;
+		a_out.formID = a_out.IsWeapon() ? 0x800u + static_cast<std::uint32_t>(a_out.kind) : 0u;
+		return true;
+	}
+
+	std::string FormatWeapon(const LA::Weapon& a_weap)
+	{
+		char buf[32];
+		switch (a_weap.kind) {
+		case LA::WeaponKind::kUnarmed:
+			return "fist";
+		case LA::WeaponKind::kOneHand:
+			std::snprintf(buf, sizeof(buf), "1h:%g", a_weap.weight);
+			return buf;
+		case LA::WeaponKind::kTwoHand:
+			std::snprintf(buf, sizeof(buf), "2h:%g", a_weap.weight);
+			return buf;
+		case LA::WeaponKind::kNonMelee:
+			return "ranged";
+		default:
+			return "none";
+		}
+	}
+
+	bool LoadStream(const char* a_path, std::vector<Event>& a_out)
+	{
+		std::ifstream in(a_path);
+		if (!in) {
+			std::fprintf(stderr, "cannot open %s\n", a_path);
+			return false;
+		}
+
+		std::string line;
+		for (std::size_t lineNo = 1; std::getline(in, line); ++lineNo) {
+			if (const auto hash = line.find('#'); hash != std::string::npos) {
+				line.resize(hash);
+			}
+			std::istringstream ls(line);
+			std::string time, actor, tag, left, right, stamina;
+			if (!(ls >> time)) {
+				continue;  // blank
+			}
+			if (!(ls >> actor >> tag >> left >> right >> stamina)) {
+				std::fprintf(stderr, "%s:%zu: expected <time> <actor> <tag> <left> <right> <stamina>\n", a_path, lineNo);
+				return false;
+			}
+
+			Event e;
+			e.timeMs = static_cast<std::uint32_t>(std::strtoul(time.c_str(), nullptr, 10));
+			e.actor = static_cast<std::uint32_t>(std::strtoul(actor.c_str(), nullptr, 16));
+			e.tag = tag;
+			if (!ParseWeapon(left, e.left) || !ParseWeapon(right, e.right)) {
+				std::fprintf(stderr, "%s:%zu: bad weapon '%s' / '%s'\n", a_path, lineNo, left.c_str(), right.c_str());
+				return false;
+			}
+			if (stamina != "-") {
+				e.hasStamina = true;
+				e.stamina = std::strtof(stamina.c_str(), nullptr);
+			}
+			int power = 0;
+			if (ls >> power) {
+				e.power = power != 0;
+				ls >> e.mult;
+			}
+			a_out.push_back(std::move(e));
+		}
+		return true;
+	}
+
+	void EmitStream(const std::vector<Event>& a_events)
+	{
+		std::printf("# time actor tag left right stamina power mult\n");
+		for (const auto& e : a_events) {
+			const auto l = FormatWeapon(e.left);
+			const auto r = FormatWeapon(e.right);
+			if (e.hasStamina) {
+				std::printf("%u %08X %s %s %s %g %d %g\n", e.timeMs, e.actor, e.tag.c_str(), l.c_str(), r.c_str(), e.stamina, e.power ? 1 : 0, e.mult);
+			} else {
+				std::printf("%u %08X %s %s %s - %d %g\n", e.timeMs, e.actor, e.tag.c_str(), l.c_str(), r.c_str(), e.power ? 1 : 0, e.mult);
+			}
+		}
+	}
+
+	std::string_view ActionName(LA::Action a_action)
+	{
+		switch (a_action) {
+		case LA::Action::kPairingHint:
+			return "hint";
+		case LA::Action::kStart:
+			return "start";
+		case LA::Action::kSpend:
+			return "spend";
+		case LA::Action::kSkip:
+			return "skip";
+		default:
+			return "none";
+		}
+	}
+
+	std::string_view ReasonName(LA::SkipReason a_reason)
+	{
+		switch (a_reason) {
+		case LA::SkipReason::kDuplicate:
+			return "duplicate";
+		case LA::SkipReason::kNotMelee:
+			return "notMelee";
+		case LA::SkipReason::kZeroBaseCost:
+			return "zeroBaseCost";
+		case LA::SkipReason::kZeroFinalCost:
+			return "zeroFinalCost";
+		default:
+			return "-";
+		}
+	}
+
+	std::string FormatOutcome(const Event& a_event, const LA::Outcome& a_out)
+	{
+		char buf[384];
+		const char flags[] = {
+			a_out.power ? 'P' : '.',
+			a_out.twoHanded ? '2' : '.',
+			a_out.ambiguous ? 'A' : '.',
+			a_out.treatAsUnarmed ? 'U' : '.',
+			a_out.insufficient ? 'I' : '.',
+			'\0'
+		};
+		const auto action = ActionName(a_out.action);
+		const auto reason = ReasonName(a_out.reason);
+		std::snprintf(buf, sizeof(buf),
+			"%u %08X %-5.*s %-20s hand=%c session=%c flags=%s reason=%-13.*s base=%.3f mult=%.3f final=%.3f start=%.3f before=%.3f after=%.3f ratio=%.3f",
+			a_event.timeMs, a_event.actor,
+			static_cast<int>(action.size()), action.data(),
+			a_event.tag.c_str(),
+			a_out.left ? 'L' : 'R', a_out.session == 0 ? 'L' : 'R', flags,
+			static_cast<int>(reason.size()), reason.data(),
+			a_out.baseCost, a_out.entryMult, a_out.finalCost, a_out.startStamina,
+			a_out.staminaBefore, a_out.staminaAfter, a_out.ratio);
+		return buf;
+	}
+
+	// ---------------------------
+	// Replay
+	// ---------------------------
+	struct Totals
+	{
+		std::uint64_t events{ 0 };
+		std::uint64_t rejected{ 0 };  // dropped by the plugin's fast path before the state lock
+		std::uint64_t starts{ 0 };
+		std::uint64_t spends{ 0 };
+		std::uint64_t skips{ 0 };
+		std::uint64_t penalties{ 0 };
+		double stamina{ 0.0 };  // total charged
+	};
+
+	// --telemetry: publishes like Events::TelemetryExport does in game, into a file-backed region,
+	// every 250 ms of stream time, sleeping to follow the stream (--speed scales it).
+	class TelemetryPublisher
+	{
+	public:
+		static constexpr std::uint32_t kPublishMs = 250;
+
+		bool Open(const char* a_path, double a_speed)
+		{
+			if (!_memory.CreateFileBacked(a_path, SF::Core::Telemetry::kRegionBytes)) {
+				std::fprintf(stderr, "cannot create telemetry region %s\n", a_path);
+				return false;
+			}
+			SF::Core::Telemetry::Init(_memory.Data(), static_cast<std::uint32_t>(::getpid()));
+			_speed = a_speed;
+			return true;
+		}
+
+		void OnEvent(std::uint32_t a_timeMs, LA::Tracker& a_tracker)
+		{
+			if (!_started) {
+				_started = true;
+				_firstMs = a_timeMs;
+				_nextMs = a_timeMs;
+				_wallStart = std::chrono::steady_clock::now();
+			}
+			if (_speed > 0.0) {
+				const std::chrono::duration<double, std::milli> offset{ (a_timeMs - _firstMs) / _speed };
+				std::this_thread::sleep_until(_wallStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(offset));
+			}
+			if (a_timeMs >= _nextMs) {
+				Publish(a_tracker);
+				_nextMs = a_timeMs + kPublishMs;
+			}
+		}
+
+		void Publish(LA::Tracker& a_tracker)
+		{
+			namespace TM = SF::Core::Telemetry;
+			_snapshot.publishes++;
+			_snapshot.timeUs = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count());
+			TM::SampleCounters(_snapshot);
+			const auto stats = a_tracker.GetStats();
+			_snapshot.gauges[static_cast<std::size_t>(TM::Gauge::kTrackedActors)] = stats.entries;
+			_snapshot.gauges[static_cast<std::size_t>(TM::Gauge::kTrackedBytes)] = stats.bytes;
+			TM::SampleLatency(_snapshot);
+			_snapshot.recentCount = static_cast<std::uint32_t>(SF::Core::FlightRecorder::Latest(_snapshot.recent));
+			TM::Publish(*static_cast<TM::Region*>(_memory.Data()), _snapshot);
+		}
+
+	private:
+		SF::Core::SharedMemory _memory;
+		SF::Core::Telemetry::Snapshot _snapshot{};
+		double _speed{ 1.0 };
+		bool _started{ false };
+		std::uint32_t _firstMs{ 0 };
+		std::uint32_t _nextMs{ 0 };
+		std::chrono::steady_clock::time_point _wallStart;
+	};
+
+	// Behavior project of every replayed actor's graph (--project).
+	std::string g_project;
+
+	// Same calls as the LightAttack subscriber of Events::AnimEventBus; mock actors stand in for RE::Actor.
+	// a_lines == nullptr: no output. a_telemetry: publish live counters while replaying.
+	Totals Replay(const std::vector<Event>& a_events, float a_initialStamina, std::vector<std::string>* a_lines,
+		TelemetryPublisher* a_telemetry = nullptr)
+	{
+		SF::Engine::Mock::World world;
+		LA::Tracker tracker;
+		Totals totals;
+		const auto& dict = SF::Core::AnimTagDict::Get();
+
+		for (const auto& e : a_events) {
+			++totals.events;
+
+			auto tag = dict.Classify(e.tag);
+			if (tag.Any(AnimTag::kFlagScoped)) {
+				tag = dict.ForProject(e.tag, g_project);
+			}
+			if (a_telemetry) {
+				SF::Core::Telemetry::CountTag(tag);
+				a_telemetry->OnEvent(e.timeMs, tracker);
+			}
+
+			auto* actor = world.Find(e.actor);
+			if (!actor) {
+				actor = &world.Spawn(e.actor, a_initialStamina);
+			}
+			actor->Equip(true, e.left);
+			actor->Equip(false, e.right);
+			actor->SetPowerAttacking(e.power);
+			actor->SetCostMult(e.mult);
+			if (e.hasStamina) {
+				actor->SetStamina(e.stamina);
+			}
+
+			if (!tracker.WantsEvent(tag)) {
+				++totals.rejected;
+				continue;
+			}
+
+			std::optional<SF::Core::Latency::Scope> timer;
+			if (a_telemetry) {
+				timer.emplace(SF::Core::Latency::Probe::kLightAttackAnim);
+			}
+			const auto out = tracker.OnEvent(*actor, tag, e.timeMs);
+			timer.reset();
+
+			if (out.penaltyExpired && a_lines) {
+				char buf[64];
+				std::snprintf(buf, sizeof(buf), "%u %08X expire", e.timeMs, e.actor);
+				a_lines->emplace_back(buf);
+			}
+
+			switch (out.action) {
+			case LA::Action::kNone:
+				continue;
+			case LA::Action::kStart:
+				++totals.starts;
+				break;
+			case LA::Action::kSkip:
+				++totals.skips;
+				break;
+			case LA::Action::kSpend:
+				++totals.spends;
+				totals.stamina += out.staminaBefore - out.staminaAfter;
+				break;
+			default:
+				break;
+			}
+
+			if (out.ScalesDamage()) {
+				++totals.penalties;
+			}
+
+			if (a_lines) {
+				a_lines->push_back(FormatOutcome(e, out));
+			}
+		}
+		if (a_telemetry) {
+			a_telemetry->Publish(tracker);
+		}
+		return totals;
+	}
+
+	// ---------------------------
+	// Synthetic input
+	// ---------------------------
+	class Rng
+	{
+	public:
+		explicit Rng(std::uint32_t a_seed) :
+			_s(a_seed ? a_seed : 1u)
+		{}
+
+		std::uint32_t Next()
+		{
+			_s ^= _s << 13;
+			_s ^= _s >> 17;
+			_s ^= _s << 5;
+			return _s;
+		}
+
+		std::uint32_t Below(std::uint32_t a_n) { return Next() % a_n; }
+
+	private:
+		std::uint32_t _s;
+	};
+
+	// Per actor: a loadout and a mix of swing patterns, interleaved with the engine noise
+	// (footsteps, sounds) that makes up most of the real stream.
+	std::vector<Event> Synthesize(std::size_t a_count, std::uint32_t a_actors, std::uint32_t a_seed)
+	{
+		static constexpr const char* kNoise[] = { "FootLeft", "FootRight", "SoundPlay.NPCHumanCombatShieldBash", "tailCombatIdle", "IdleStop", "weaponDraw" };
+
+		struct Loadout
+		{
+			LA::Weapon left;
+			LA::Weapon right;
+		};
+
+		Rng rng{ a_seed };
+		std::vector<Loadout> loadouts(a_actors);
+		for (auto& l : loadouts) {
+			switch (rng.Below(5)) {
+			case 0:
+				l = { {}, {} };  // fists
+				break;
+			case 1:
+				l = { { LA::WeaponKind::kOneHand, 0x801, 10.0f }, { LA::WeaponKind::kOneHand, 0x802, 12.0f } };
+				break;
+			case 2:
+				l = { { LA::WeaponKind::kTwoHand, 0x803, 22.0f }, { LA::WeaponKind::kTwoHand, 0x803, 22.0f } };
+				break;
+			case 3:
+				l = { {}, { LA::WeaponKind::kOneHand, 0x804, 9.0f } };  // sword + free hand
+				break;
+			default:
+				l = { { LA::WeaponKind::kNonMelee, 0x805, 12.0f }, {} };
+				break;
+			}
+		}
+
+		std::vector<Event> events;
+		events.reserve(a_count);
+		std::uint32_t now = 1000;
+
+		auto push = [&](std::uint32_t a_actor, const char* a_tag, bool a_power = false) {
+			Event e;
+			e.timeMs = now;
+			e.actor = 0xFF000800u + a_actor;
+			e.tag = a_tag;
+			e.left = loadouts[a_actor].left;
+			e.right = loadouts[a_actor].right;
+			e.power = a_power;
+			events.push_back(std::move(e));
+			now += 1 + rng.Below(6);
+		};
+
+		while (events.size() < a_count) {
+			const auto actor = rng.Below(a_actors);
+			const bool power = rng.Below(8) == 0;
+			const auto first = events.size();
+			switch (rng.Below(10)) {
+			case 0:
+				push(actor, "attackStart", power);
+				push(actor, "weaponSwing", power);
+				break;
+			case 1:
+				push(actor, "attackStartLeft", power);
+				push(actor, "weaponLeftSwing", power);
+				break;
+			case 2:
+				push(actor, "attackStartRight", power);
+				push(actor, "WeaponSwing", power);
+				push(actor, "weaponSwing", power);  // second swing, no new start
+				break;
+			case 3:
+				push(actor, "SoundPlay.WPNSwingUnarmed");
+				push(actor, "weaponSwing");
+				break;
+			default:
+				push(actor, kNoise[rng.Below(static_cast<std::uint32_t>(std::size(kNoise)))]);
+				break;
+			}
+			// Stamina regenerates between patterns; the engine reports it on the first event.
+			events[first].hasStamina = true;
+			events[first].stamina = static_cast<float>(20 + rng.Below(130));
+		}
+		events.resize(a_count);
+		return events;
+	}
+
+	int DiffGolden(const char* a_path, const std::vector<std::string>& a_lines)
+	{
+		std::ifstream in(a_path);
+		if (!in) {
+			std::fprintf(stderr, "cannot open golden %s\n", a_path);
+			return 2;
+		}
+
+		std::vector<std::string> golden;
+		for (std::string line; std::getline(in, line);) {
+			if (!line.empty() && line.back() == '\r') {
+				line.pop_back();
+			}
+			golden.push_back(std::move(line));
+		}
+
+		constexpr int kMaxShown = 10;
+		int shown = 0;
+		std::size_t diffs = 0;
+		const auto n = std::max(golden.size(), a_lines.size());
+		for (std::size_t i = 0; i < n; ++i) {
+			const std::string* want = i < golden.size() ? &golden[i] : nullptr;
+			const std::string* got = i < a_lines.size() ? &a_lines[i] : nullptr;
+			if (want && got && *want == *got) {
+				continue;
+			}
+			++diffs;
+			if (shown++ < kMaxShown) {
+				std::printf("@@ line %zu\n- %s\n+ %s\n", i + 1, want ? want->c_str() : "<missing>", got ? got->c_str() : "<missing>");
+			}
+		}
+
+		if (diffs) {
+			std::printf("%zu line(s) differ from %s\n", diffs, a_path);
+			return 1;
+		}
+		std::printf("matches %s (%zu lines)\n", a_path, golden.size());
+		return 0;
+	}
+
+	void PrintTotals(const Totals& a_totals)
+	{
+		std::fprintf(stderr, "events=%llu fastRejected=%llu starts=%llu spends=%llu skips=%llu penalties=%llu staminaCharged=%.1f\n",
+			static_cast<unsigned long long>(a_totals.events),
+			static_cast<unsigned long long>(a_totals.rejected),
+			static_cast<unsigned long long>(a_totals.starts),
+			static_cast<unsigned long long>(a_totals.spends),
+			static_cast<unsigned long long>(a_totals.skips),
+			static_cast<unsigned long long>(a_totals.penalties),
+			a_totals.stamina);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const char* streamPath = nullptr;
+	const char* goldenPath = nullptr;
+	const char* configPath = nullptr;
+	const char* tagsPath = nullptr;
+	const char* telemetryPath = nullptr;
+	double speed = 1.0;
+	std::size_t synthetic = 0;
+	std::uint32_t actors = 20;
+	std::uint32_t seed = 12345;
+	unsigned repeat = 0;
+	float initialStamina = 100.0f;
+	bool quiet = false;
+	bool emit = false;
+
+	for (int i = 1; i < argc; ++i) {
+		const std::string_view arg = argv[i];
+		const bool hasValue = i + 1 < argc;
+		if (arg == "--golden" && hasValue) {
+			goldenPath = argv[++i];
+		} else if (arg == "--config" && hasValue) {
+			configPath = argv[++i];
+		} else if (arg == "--tags" && hasValue) {
+			tagsPath = argv[++i];
+		} else if (arg == "--project" && hasValue) {
+			g_project = argv[++i];
+		} else if (arg == "--synthetic" && hasValue) {
+			synthetic = std::strtoull(argv[++i], nullptr, 10);
+		} else if (arg == "--actors" && hasValue) {
+			actors = std::max(1u, static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10)));
+		} else if (arg == "--seed" && hasValue) {
+			seed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (arg == "--repeat" && hasValue) {
+			repeat = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (arg == "--stamina" && hasValue) {
+			initialStamina = std::strtof(argv[++i], nullptr);
+		} else if (arg == "--telemetry" && hasValue) {
+			telemetryPath = argv[++i];
+		} else if (arg == "--speed" && hasValue) {
+			speed = std::strtod(argv[++i], nullptr);
+		} else if (arg == "--quiet") {
+			quiet = true;
+		} else if (arg == "--emit") {
+			emit = true;
+		} else if (!streamPath && !arg.starts_with("--")) {
+			streamPath = argv[i];
+		} else {
+			std::fprintf(stderr, "unknown argument '%s'\n", argv[i]);
+			return 2;
+		}
+	}
+
+	if (!streamPath && synthetic == 0) {
+		std::fprintf(stderr,
+			"usage: %s <stream.txt> | --synthetic <events> [--actors N] [--seed S]\n"
+			"          [--golden file] [--repeat N] [--stamina initial] [--config file] [--quiet] [--emit]\n"
+			"          [--tags file|dir [--project name]]\n"
+			"          [--telemetry file [--speed x]]\n",
+			argv[0]);
+		return 2;
+	}
+
+	if (configPath) {
+		auto result = SF::Core::Config::Parse(SF::Core::ConfigText::ReadAllText(configPath));
+		for (const auto& e : result.errors) {
+			std::fprintf(stderr, "config error: %s\n", e.c_str());
+		}
+		for (const auto& w : result.warnings) {
+			std::fprintf(stderr, "config warning: %s\n", w.c_str());
+		}
+		if (result.malformed) {
+			return 2;
+		}
+		SF::Core::Config::Publish(std::move(result.snapshot));
+	}
+
+	if (tagsPath) {
+		auto result = SF::Core::AnimTagDict::Load(tagsPath);
+		for (const auto& e : result.errors) {
+			std::fprintf(stderr, "tags error: %s\n", e.c_str());
+		}
+		for (const auto& w : result.warnings) {
+			std::fprintf(stderr, "tags warning: %s\n", w.c_str());
+		}
+		if (result.files == 0) {
+			std::fprintf(stderr, "%s: no tag dictionary loaded\n", tagsPath);
+			return 2;
+		}
+		const auto& dict = *result.dictionary;
+		std::fprintf(stderr, "tags: %zu file(s), %zu rule(s), %zu tags (%zu project-scoped), longest probe %zu\n",
+			result.files, result.rules, dict.Size(), dict.Scoped(), dict.MaxProbe());
+		SF::Core::AnimTagDict::Publish(std::move(result.dictionary));
+	}
+
+	std::vector<Event> events;
+	if (streamPath) {
+		if (!LoadStream(streamPath, events)) {
+			return 2;
+		}
+	} else {
+		events = Synthesize(synthetic, actors, seed);
+	}
+
+	if (emit) {
+		EmitStream(events);
+		return 0;
+	}
+
+	int rc = 0;
+	std::vector<std::string> lines;
+	TelemetryPublisher telemetry;
+	if (telemetryPath && !telemetry.Open(telemetryPath, speed)) {
+		return 2;
+	}
+	const auto totals = Replay(events, initialStamina, &lines, telemetryPath ? &telemetry : nullptr);
+
+	if (goldenPath) {
+		rc = DiffGolden(goldenPath, lines);
+	} else if (!quiet && repeat == 0) {
+		for (const auto& line : lines) {
+			std::printf("%s\n", line.c_str());
+		}
+	}
+	PrintTotals(totals);
+
+	if (repeat > 0 && !events.empty()) {
+		volatile std::uint64_t sink = 0;
+		const auto t0 = std::chrono::steady_clock::now();
+		for (unsigned r = 0; r < repeat; ++r) {
+			sink = sink + Replay(events, initialStamina, nullptr).spends;
+		}
+		const auto t1 = std::chrono::steady_clock::now();
+
+		const double secs = std::chrono::duration<double>(t1 - t0).count();
+		const double total = static_cast<double>(events.size()) * repeat;
+		std::fprintf(stderr, "throughput: %.0f events/s (%.1f ns/event, %u pass(es) x %zu events)\n",
+			total / secs, secs * 1e9 / total, repeat, events.size());
+	}
+
+	return rc;
+}
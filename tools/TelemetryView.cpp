@@ -0,0 +1,171 @@
+// Watches the live telemetry a writer publishes into a shared region (SF/Core/Telemetry.h):
+// the plugin in game (named shared memory "Sunderandforged.Telemetry", Windows), or
+// sf_replay --telemetry <file> (a file-backed region, any OS).
+//
+// Counters are shown as totals and per-second rates between two snapshots; gauges as sampled;
+// hook latency percentiles as the plugin's histograms report them; then the newest
+// flight-recorder records. Reading never blocks the writer: a read that overlaps a publish is
+// simply retried.
+//
+// Usage: sf_telemetry [--file <path> | --name <mapping>] [--interval <ms>] [--once]
+
+#include "SF/Core/FlightRecorder.h"
+#include "SF/Core/SharedMemory.h"
+#include "SF/Core/Telemetry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <thread>
+
+namespace
+{
+	namespace TM = SF::Core::Telemetry;
+	namespace FR = SF::Core::FlightRecorder;
+
+	std::string_view KindName(FR::Kind a_kind)
+	{
+		switch (a_kind) {
+		case FR::Kind::kStart:
+			return "start";
+		case FR::Kind::kUnarmedSound:
+			return "unarmedSound";
+		case FR::Kind::kSpend:
+			return "spend";
+		case FR::Kind::kSkip:
+			return "skip";
+		case FR::Kind::kBlockedHit:
+			return "blockedHit";
+		default:
+			return "?";
+		}
+	}
+
+	std::string_view StatusText(TM::ReadStatus a_status)
+	{
+		switch (a_status) {
+		case TM::ReadStatus::kEmpty:
+			return "waiting for the first publish";
+		case TM::ReadStatus::kMismatch:
+			return "layout mismatch: the writer was built from a different Core/Telemetry.h";
+		case TM::ReadStatus::kBusy:
+			return "writer busy, retrying";
+		default:
+			return "ok";
+		}
+	}
+
+	void Render(const TM::Snapshot& a_now, const TM::Snapshot* a_prev, std::uint32_t a_pid)
+	{
+		const double dt = a_prev && a_now.timeUs > a_prev->timeUs ? static_cast<double>(a_now.timeUs - a_prev->timeUs) / 1e6 : 0.0;
+		std::printf("Sunderandforged telemetry  pid=%u  publish #%llu\n\n", a_pid, static_cast<unsigned long long>(a_now.publishes));
+
+		std::printf("%-20s %14s %12s\n", "counter", "total", "per sec");
+		for (std::size_t i = 0; i < TM::kCounters; ++i) {
+			double total = static_cast<double>(a_now.counters[i]);
+			double rate = dt > 0.0 ? static_cast<double>(a_now.counters[i] - a_prev->counters[i]) / dt : 0.0;
+			if (static_cast<TM::Counter>(i) == TM::Counter::kBlockedStaminaMilli) {
+				total /= 1000.0;
+				rate /= 1000.0;
+			}
+			const auto name = TM::kCounterNames[i];
+			std::printf("%-20.*s %14.0f %12.1f\n", static_cast<int>(name.size()), name.data(), total, rate);
+		}
+
+		std::printf("\n%-20s %14s\n", "gauge", "value");
+		for (std::size_t i = 0; i < TM::kGauges; ++i) {
+			const auto name = TM::kGaugeNames[i];
+			std::printf("%-20.*s %14llu\n", static_cast<int>(name.size()), name.data(), static_cast<unsigned long long>(a_now.gauges[i]));
+		}
+
+		std::printf("\n%-20s %12s %10s %10s %10s %10s\n", "hook latency (us)", "calls", "p50", "p99", "p99.9", "max");
+		for (std::size_t i = 0; i < SF::Core::Latency::kProbes; ++i) {
+			const auto& row = a_now.latency[i];
+			if (row.count == 0) {
+				continue;
+			}
+			const auto name = SF::Core::Latency::kProbeNames[i];
+			std::printf("%-20.*s %12llu %10.2f %10.2f %10.2f %10.2f\n", static_cast<int>(name.size()), name.data(),
+				static_cast<unsigned long long>(row.count), row.p50Us, row.p99Us, row.p999Us, row.maxUs);
+		}
+
+		std::printf("\nrecent (ms before publish)\n");
+		const auto n = std::min<std::size_t>(a_now.recentCount, TM::kRecent);
+		for (std::size_t i = 0; i < n; ++i) {
+			const auto& r = a_now.recent[i];
+			const double ago = r.timeUs <= a_now.timeUs ? static_cast<double>(a_now.timeUs - r.timeUs) / 1000.0 : 0.0;
+			const auto kind = KindName(r.kind);
+			std::printf("%9.1f %08X %-12.*s cost=%7.2f base=%7.2f before=%7.2f after=%7.2f\n", ago, r.actor,
+				static_cast<int>(kind.size()), kind.data(), r.cost, r.baseCost, r.staminaBefore, r.staminaAfter);
+		}
+		std::fflush(stdout);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const char* file = nullptr;
+	const char* name = "Sunderandforged.Telemetry";
+	unsigned intervalMs = 500;
+	bool once = false;
+
+	for (int i = 1; i < argc; ++i) {
+		const std::string_view arg = argv[i];
+		const bool hasValue = i + 1 < argc;
+		if (arg == "--file" && hasValue) {
+			file = argv[++i];
+		} else if (arg == "--name" && hasValue) {
+			name = argv[++i];
+		} else if (arg == "--interval" && hasValue) {
+			intervalMs = std::max(50u, static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10)));
+		} else if (arg == "--once") {
+			once = true;
+		} else {
+			std::fprintf(stderr, "usage: %s [--file <path> | --name <mapping>] [--interval <ms>] [--once]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	SF::Core::SharedMemory memory;
+	const bool opened = file ? memory.OpenFileBacked(file, TM::kRegionBytes) : memory.OpenNamed(name, TM::kRegionBytes);
+	if (!opened) {
+		std::fprintf(stderr, "cannot open %s '%s'%s\n", file ? "file" : "shared memory", file ? file : name,
+			file ? "" : " (is the game running with Telemetry.PublishMs > 0? elsewhere use --file)");
+		return 1;
+	}
+	const auto& region = *static_cast<const TM::Region*>(memory.Data());
+
+	TM::Snapshot now{};
+	TM::Snapshot prev{};
+	bool havePrev = false;
+	for (;;) {
+		const auto status = TM::Read(region, now);
+		if (once) {
+			if (status != TM::ReadStatus::kOk) {
+				const auto text = StatusText(status);
+				std::fprintf(stderr, "%.*s\n", static_cast<int>(text.size()), text.data());
+				return 1;
+			}
+			Render(now, nullptr, region.header.writerPid);
+			return 0;
+		}
+
+		std::printf("\x1b[H\x1b[J");  // home + clear
+		if (status == TM::ReadStatus::kOk) {
+			const bool fresh = !havePrev || now.publishes != prev.publishes;
+			Render(now, havePrev && fresh ? &prev : nullptr, region.header.writerPid);
+			if (fresh) {
+				prev = now;
+				havePrev = true;
+			}
+		} else {
+			const auto text = StatusText(status);
+			std::printf("%.*s\n", static_cast<int>(text.size()), text.data());
+			std::fflush(stdout);
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+	}
+}
@@ -0,0 +1,198 @@
+// Decodes a flight-recorder dump (Sunderandforged.sftr / Sunderandforged_crash.sftr).
+//
+// Records from all threads are merged by timestamp. Times are printed relative to the
+// oldest record in the file.
+//
+// Usage: sf_tracedecode <file.sftr> [--csv] [--actor <hex FormID>]
+
+#include "SF/Core/FlightRecorder.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+	namespace FR = SF::Core::FlightRecorder;
+
+	struct Entry
+	{
+		std::uint32_t thread{ 0 };
+		FR::Record rec{};
+	};
+
+	std::string_view KindName(FR::Kind a_kind)
+	{
+		switch (a_kind) {
+		case FR::Kind::kStart:
+			return "start";
+		case FR::Kind::kUnarmedSound:
+			return "unarmedSound";
+		case FR::Kind::kSpend:
+			return "spend";
+		case FR::Kind::kSkip:
+			return "skip";
+		case FR::Kind::kBlockedHit:
+			return "blockedHit";
+		default:
+			return "?";
+		}
+	}
+
+	std::string_view ReasonName(FR::SkipReason a_reason)
+	{
+		switch (a_reason) {
+		case FR::SkipReason::kNone:
+			return "";
+		case FR::SkipReason::kDuplicate:
+			return "duplicate";
+		case FR::SkipReason::kNotMelee:
+			return "notMelee";
+		case FR::SkipReason::kZeroBaseCost:
+			return "zeroBaseCost";
+		case FR::SkipReason::kZeroFinalCost:
+			return "zeroFinalCost";
+		default:
+			return "?";
+		}
+	}
+
+	char HandChar(std::uint8_t a_hand)
+	{
+		return a_hand == FR::kHandLeft ? 'L' : a_hand == FR::kHandRight ? 'R' : '-';
+	}
+
+	void FlagString(std::uint8_t a_flags, char (&a_out)[6])
+	{
+		a_out[0] = (a_flags & FR::kFlagPower) ? 'P' : '.';
+		a_out[1] = (a_flags & FR::kFlagTwoHanded) ? '2' : '.';
+		a_out[2] = (a_flags & FR::kFlagAmbiguous) ? 'A' : '.';
+		a_out[3] = (a_flags & FR::kFlagUnarmed) ? 'U' : '.';
+		a_out[4] = (a_flags & FR::kFlagInsufficient) ? 'I' : '.';
+		a_out[5] = '\0';
+	}
+
+	bool Load(const char* a_path, std::vector<Entry>& a_out)
+	{
+		std::ifstream in(a_path, std::ios::binary);
+		if (!in) {
+			std::fprintf(stderr, "cannot open %s\n", a_path);
+			return false;
+		}
+
+		FR::FileHeader header{};
+		if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != FR::kFileMagic) {
+			std::fprintf(stderr, "%s: not a flight-recorder dump\n", a_path);
+			return false;
+		}
+		if (header.version != FR::kFileVersion || header.recordSize != sizeof(FR::Record)) {
+			std::fprintf(stderr, "%s: unsupported version %u (record size %u)\n", a_path, header.version, header.recordSize);
+			return false;
+		}
+
+		for (std::uint32_t t = 0; t < header.threadCount; ++t) {
+			FR::ThreadHeader th{};
+			if (!in.read(reinterpret_cast<char*>(&th), sizeof(th))) {
+				std::fprintf(stderr, "%s: truncated (thread %u of %u)\n", a_path, t, header.threadCount);
+				return !a_out.empty();
+			}
+			for (std::uint32_t i = 0; i < th.recordCount; ++i) {
+				Entry e{ th.threadIndex, {} };
+				if (!in.read(reinterpret_cast<char*>(&e.rec), sizeof(e.rec))) {
+					std::fprintf(stderr, "%s: truncated (thread %u)\n", a_path, th.threadIndex);
+					return !a_out.empty();
+				}
+				a_out.push_back(e);
+			}
+		}
+		return true;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const char* path = nullptr;
+	bool csv = false;
+	bool filterActor = false;
+	std::uint32_t actor = 0;
+
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--csv") == 0) {
+			csv = true;
+		} else if (std::strcmp(argv[i], "--actor") == 0 && i + 1 < argc) {
+			filterActor = true;
+			actor = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 16));
+		} else if (!path) {
+			path = argv[i];
+		} else {
+			path = nullptr;
+			break;
+		}
+	}
+
+	if (!path) {
+		std::fprintf(stderr, "usage: %s <file.sftr> [--csv] [--actor <hex FormID>]\n", argv[0]);
+		return 2;
+	}
+
+	std::vector<Entry> entries;
+	if (!Load(path, entries)) {
+		return 1;
+	}
+
+	std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+		return a.rec.timeUs < b.rec.timeUs;
+	});
+
+	const std::uint64_t t0 = entries.empty() ? 0 : entries.front().rec.timeUs;
+
+	if (csv) {
+		std::printf("time_us,thread,actor,kind,tag,hand,session,flags,reason,cost,base_cost,start_stamina,stamina_before,stamina_after\n");
+	} else {
+		std::printf("%12s %3s %8s %-12s %-20s %1s %1s %-5s %-13s %8s %8s %8s %8s %8s\n",
+			"t(ms)", "thr", "actor", "kind", "tag", "H", "S", "flags", "reason", "cost", "base", "start", "before", "after");
+	}
+
+	std::size_t shown = 0;
+	for (const auto& e : entries) {
+		const auto& r = e.rec;
+		if (filterActor && r.actor != actor) {
+			continue;
+		}
+
+		const auto kind = KindName(r.kind);
+		const auto tag = SF::Core::AnimTag::Name(r.tag);
+		const auto reason = ReasonName(r.reason);
+		char flags[6];
+		FlagString(r.flags, flags);
+
+		if (csv) {
+			std::printf("%llu,%u,%08X,%.*s,%.*s,%c,%c,%s,%.*s,%g,%g,%g,%g,%g\n",
+				static_cast<unsigned long long>(r.timeUs - t0), e.thread, r.actor,
+				static_cast<int>(kind.size()), kind.data(),
+				static_cast<int>(tag.size()), tag.data(),
+				HandChar(r.hand), HandChar(r.session), flags,
+				static_cast<int>(reason.size()), reason.data(),
+				r.cost, r.baseCost, r.startStamina, r.staminaBefore, r.staminaAfter);
+		} else {
+			std::printf("%12.3f %3u %08X %-12.*s %-20.*s %c %c %-5s %-13.*s %8.2f %8.2f %8.2f %8.2f %8.2f\n",
+				static_cast<double>(r.timeUs - t0) / 1000.0, e.thread, r.actor,
+				static_cast<int>(kind.size()), kind.data(),
+				static_cast<int>(tag.size()), tag.data(),
+				HandChar(r.hand), HandChar(r.session), flags,
+				static_cast<int>(reason.size()), reason.data(),
+				r.cost, r.baseCost, r.startStamina, r.staminaBefore, r.staminaAfter);
+		}
+		++shown;
+	}
+
+	if (!csv) {
+		std::printf("%zu record(s)\n", shown);
+	}
+	return 0;
+}